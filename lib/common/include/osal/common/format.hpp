@@ -47,6 +47,23 @@ struct fmt::formatter<OsalMutexType> : fmt::formatter<std::string_view> {
         switch (value) {
             case OsalMutexType::eRecursive: name = "recursive"; break;
             case OsalMutexType::eNonRecursive: name = "non-recursive"; break;
+            case OsalMutexType::eAdaptive: name = "adaptive"; break;
+        }
+
+        return fmt::formatter<std::string_view>::format(name, ctx);
+    }
+};
+
+template <>
+struct fmt::formatter<OsalMutexProtocol> : fmt::formatter<std::string_view> {
+    template <typename FormatContext>
+    auto format(OsalMutexProtocol value, FormatContext& ctx)
+    {
+        std::string_view name;
+        switch (value) {
+            case OsalMutexProtocol::eNoPriorityProtocol: name = "none"; break;
+            case OsalMutexProtocol::ePriorityInheritance: name = "priority-inheritance"; break;
+            case OsalMutexProtocol::ePriorityCeiling: name = "priority-ceiling"; break;
         }
 
         return fmt::formatter<std::string_view>::format(name, ctx);
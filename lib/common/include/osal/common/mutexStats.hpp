@@ -0,0 +1,64 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "osal/Mutex.h"
+
+#include <cstdint>
+
+/// Records acquisition of the mutex in the given statistics.
+/// @param stats            Statistics of the locked mutex.
+/// @param contended        Flag indicating if mutex was locked by someone else during the first locking attempt.
+/// @param waitStartNs      Timestamp in ns taken right before the calling thread started to wait for the mutex.
+/// @note This function must be called by the new owner right after the mutex is locked. Recursive locks of the same
+///       mutex are not recorded.
+void mutexStatsOnLock(OsalMutexStats* stats, bool contended, std::uint64_t waitStartNs);
+
+/// Represents release of the mutex prepared by its owner, which should be recorded after the successful unlock.
+struct MutexStatsRelease {
+    bool record;
+    std::uint64_t holdNs;
+};
+
+/// Prepares recording of the release of the mutex in the given statistics.
+/// @param stats            Statistics of the mutex to be unlocked.
+/// @return Release to be passed to mutexStatsOnUnlock() after the mutex is successfully unlocked.
+/// @note This function must be called right before the mutex is unlocked. Statistics are not modified, when the calling
+///       thread doesn't own the mutex. Only the last recursive unlock of the same mutex is recorded.
+MutexStatsRelease mutexStatsPrepareUnlock(OsalMutexStats* stats);
+
+/// Records release of the mutex in the given statistics.
+/// @param stats            Statistics of the unlocked mutex.
+/// @param release          Release prepared by mutexStatsPrepareUnlock().
+/// @note This function must be called only after the mutex was successfully unlocked.
+void mutexStatsOnUnlock(OsalMutexStats* stats, MutexStatsRelease release);
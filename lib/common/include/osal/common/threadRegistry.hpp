@@ -0,0 +1,75 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "osal/Thread.h"
+
+/// Represents entry of the registry of live OSAL threads.
+/// @note Entry lives on the stack of the registered thread, so registering a thread doesn't allocate any memory.
+struct ThreadRegistryEntry {
+    OsalThreadInfo info;
+    ThreadRegistryEntry* prev;
+    ThreadRegistryEntry* next;
+};
+
+/// Adds the given entry to the registry of live threads.
+/// @param entry            Entry to be added. It has to describe the calling thread.
+void threadRegistryAdd(ThreadRegistryEntry* entry);
+
+/// Removes the given entry from the registry of live threads.
+/// @param entry            Entry to be removed.
+void threadRegistryRemove(ThreadRegistryEntry* entry);
+
+/// Checks if the given thread is still registered as live.
+/// @param id               Kernel id of the thread to be checked.
+/// @param startTimestampNs Start timestamp of the thread to be checked.
+/// @return True if the thread is registered, false otherwise.
+/// @note Registry has to be locked by the calling thread. Thread stays registered until the lock is released, because
+///       entry is removed only after its thread function returns. Start timestamp distinguishes reused kernel ids.
+bool threadRegistryContains(uint32_t id, uint64_t startTimestampNs);
+
+/// Locks the registry of live threads.
+/// @note This function is meant to be used only by the fork handlers and by the queries of the live threads, so that
+///       registry is consistent with the state of the threads.
+void threadRegistryLock();
+
+/// Unlocks the registry of live threads.
+/// @note This function is meant to be used only by the fork handlers and by the queries of the live threads, so that
+///       registry is consistent with the state of the threads.
+void threadRegistryUnlock();
+
+/// Drops all entries from the registry except the given one.
+/// @param survivor         Entry to be kept in the registry or nullptr if none should be kept.
+/// @note This function is meant to be used in the child process after fork(), where only the forking thread exists.
+///       Registry has to be locked by the calling thread.
+void threadRegistryReset(ThreadRegistryEntry* survivor);
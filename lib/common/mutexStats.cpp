@@ -0,0 +1,276 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#include "osal/common/mutexStats.hpp"
+
+#include "osal/Mutex.h"
+#include "osal/Thread.h"
+#include "osal/common/logger.hpp"
+#include "osal/timestamp.h"
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+/// Returns mutex protecting the registry of the profiled mutexes.
+/// @return Mutex protecting the registry of the profiled mutexes.
+static OsalMutex* registryMutex()
+{
+    static OsalMutex mutex{};
+    static const bool cCreated = (osalMutexCreate(&mutex, OsalMutexType::eNonRecursive) == OsalError::eOk);
+    return cCreated ? &mutex : nullptr;
+}
+
+/// Head of the intrusive list of the registered mutex statistics.
+static OsalMutexStats* registryHead{}; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+/// Increments the given statistics counter.
+/// @param counter          Counter to be incremented.
+/// @note Counters are modified only by the mutex owner, so there is no need for the atomic read-modify-write.
+static void increment(std::uint64_t& counter)
+{
+    std::atomic_ref value(counter);
+    value.store(value.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+/// Returns index of the histogram bucket for the given duration.
+/// @param durationNs       Duration in ns to be recorded.
+/// @return Index of the histogram bucket for the given duration.
+static std::size_t histogramBucket(std::uint64_t durationNs)
+{
+    auto bucket = static_cast<std::size_t>(std::bit_width(durationNs));
+    return (bucket < cOsalMutexStatsBuckets) ? bucket : (cOsalMutexStatsBuckets - 1);
+}
+
+/// Copies the public part of the given statistics into the snapshot.
+/// @param stats            Statistics to be copied.
+/// @param snapshot         Output argument where the statistics will be stored.
+static void takeSnapshot(OsalMutexStats* stats, OsalMutexStats* snapshot)
+{
+    auto load = [](std::uint64_t& value) { return std::atomic_ref(value).load(std::memory_order_relaxed); };
+
+    *snapshot = OsalMutexStats{};
+    snapshot->name = stats->name;
+    snapshot->acquisitions = load(stats->acquisitions);
+    snapshot->contentions = load(stats->contentions);
+    snapshot->maxHoldNs = load(stats->maxHoldNs);
+
+    for (std::size_t i = 0; i < cOsalMutexStatsBuckets; ++i) {
+        snapshot->waitHistogram[i] = load(stats->waitHistogram[i]);
+        snapshot->holdHistogram[i] = load(stats->holdHistogram[i]);
+    }
+}
+
+void mutexStatsOnLock(OsalMutexStats* stats, bool contended, std::uint64_t waitStartNs)
+{
+    std::atomic_ref owner(stats->owner);
+    auto threadId = osalThreadId();
+    if (owner.load(std::memory_order_relaxed) == threadId) {
+        ++stats->depth;
+        return;
+    }
+
+    auto now = osalTimestampNs();
+    owner.store(threadId, std::memory_order_relaxed);
+    stats->depth = 1;
+    stats->lockTimestampNs = now;
+
+    increment(stats->acquisitions);
+    if (contended) {
+        increment(stats->contentions);
+        increment(stats->waitHistogram[histogramBucket(now - waitStartNs)]);
+    }
+    else {
+        increment(stats->waitHistogram[0]);
+    }
+}
+
+MutexStatsRelease mutexStatsPrepareUnlock(OsalMutexStats* stats)
+{
+    std::atomic_ref owner(stats->owner);
+    if (owner.load(std::memory_order_relaxed) != osalThreadId() || --stats->depth != 0)
+        return {};
+
+    owner.store(0, std::memory_order_relaxed);
+    return {true, osalTimestampNs() - stats->lockTimestampNs};
+}
+
+void mutexStatsOnUnlock(OsalMutexStats* stats, MutexStatsRelease release)
+{
+    if (!release.record)
+        return;
+
+    // Mutex is already unlocked, so the next owner can record its own release concurrently.
+    std::atomic_ref(stats->holdHistogram[histogramBucket(release.holdNs)]).fetch_add(1, std::memory_order_relaxed);
+
+    std::atomic_ref maxHoldNs(stats->maxHoldNs);
+    auto current = maxHoldNs.load(std::memory_order_relaxed);
+    while (release.holdNs > current) {
+        if (maxHoldNs.compare_exchange_weak(current, release.holdNs, std::memory_order_relaxed))
+            break;
+    }
+}
+
+OsalError osalMutexEnableStats(OsalMutex* mutex, OsalMutexStats* stats, const char* name)
+{
+    if (mutex == nullptr || !mutex->initialized || stats == nullptr || name == nullptr) {
+        MutexLogger::error("Failed to enable mutex stats: invalid argument");
+        return OsalError::eInvalidArgument;
+    }
+
+    if (mutex->processShared) {
+        MutexLogger::error("Failed to enable mutex stats: mutex is process-shared");
+        return OsalError::eInvalidArgument;
+    }
+
+    if (mutex->stats != nullptr) {
+        MutexLogger::error("Failed to enable mutex stats: stats already enabled");
+        return OsalError::eInvalidArgument;
+    }
+
+    auto* registry = registryMutex();
+    if (registry == nullptr) {
+        MutexLogger::error("Failed to enable mutex stats: registry is not available");
+        return OsalError::eOsError;
+    }
+
+    *stats = OsalMutexStats{};
+    stats->name = name;
+
+    osalMutexLock(registry);
+    stats->next = registryHead;
+    if (registryHead != nullptr)
+        registryHead->prev = stats;
+
+    registryHead = stats;
+    osalMutexUnlock(registry);
+
+    mutex->stats = stats;
+    MutexLogger::trace("Enabled mutex stats: name={}", name);
+    return OsalError::eOk;
+}
+
+OsalError osalMutexDisableStats(OsalMutex* mutex)
+{
+    if (mutex == nullptr || !mutex->initialized || mutex->stats == nullptr) {
+        MutexLogger::error("Failed to disable mutex stats: invalid argument");
+        return OsalError::eInvalidArgument;
+    }
+
+    auto* stats = mutex->stats;
+    auto* registry = registryMutex();
+
+    osalMutexLock(registry);
+    if (stats->prev != nullptr)
+        stats->prev->next = stats->next;
+    else
+        registryHead = stats->next;
+
+    if (stats->next != nullptr)
+        stats->next->prev = stats->prev;
+
+    osalMutexUnlock(registry);
+
+    stats->prev = nullptr;
+    stats->next = nullptr;
+    mutex->stats = nullptr;
+    MutexLogger::trace("Disabled mutex stats: name={}", stats->name);
+    return OsalError::eOk;
+}
+
+OsalError osalMutexGetStats(OsalMutex* mutex, OsalMutexStats* snapshot)
+{
+    if (mutex == nullptr || !mutex->initialized || mutex->stats == nullptr || snapshot == nullptr) {
+        MutexLogger::error("Failed to get mutex stats: invalid argument");
+        return OsalError::eInvalidArgument;
+    }
+
+    takeSnapshot(mutex->stats, snapshot);
+    return OsalError::eOk;
+}
+
+OsalError osalMutexResetStats(OsalMutex* mutex)
+{
+    if (mutex == nullptr || !mutex->initialized || mutex->stats == nullptr) {
+        MutexLogger::error("Failed to reset mutex stats: invalid argument");
+        return OsalError::eInvalidArgument;
+    }
+
+    auto* stats = mutex->stats;
+    auto reset = [](std::uint64_t& value) { std::atomic_ref(value).store(0, std::memory_order_relaxed); };
+
+    reset(stats->acquisitions);
+    reset(stats->contentions);
+    reset(stats->maxHoldNs);
+
+    for (std::size_t i = 0; i < cOsalMutexStatsBuckets; ++i) {
+        reset(stats->waitHistogram[i]);
+        reset(stats->holdHistogram[i]);
+    }
+
+    return OsalError::eOk;
+}
+
+size_t osalMutexStatsTopContended(OsalMutexStats* snapshots, size_t count)
+{
+    auto* registry = registryMutex();
+    if (snapshots == nullptr || count == 0 || registry == nullptr)
+        return 0;
+
+    std::size_t size = 0;
+
+    osalMutexLock(registry);
+    for (auto* stats = registryHead; stats != nullptr; stats = stats->next) {
+        OsalMutexStats snapshot{};
+        takeSnapshot(stats, &snapshot);
+
+        // Keep output array sorted with insertion sort. It is expected to be short, so this is cheaper than
+        // copying all registered statistics and sorting them afterwards.
+        auto position = size;
+        while (position > 0 && snapshots[position - 1].contentions < snapshot.contentions)
+            --position;
+
+        if (position == count)
+            continue;
+
+        auto last = (size < count) ? size++ : (count - 1);
+        for (auto i = last; i > position; --i)
+            snapshots[i] = snapshots[i - 1];
+
+        snapshots[position] = snapshot;
+    }
+
+    osalMutexUnlock(registry);
+    return size;
+}
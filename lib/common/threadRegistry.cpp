@@ -0,0 +1,143 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#include "osal/common/threadRegistry.hpp"
+
+#include "osal/Mutex.h"
+#include "osal/Thread.h"
+
+#include <cstddef>
+
+/// Returns mutex protecting the registry of the live threads.
+/// @return Mutex protecting the registry of the live threads.
+static OsalMutex* registryMutex()
+{
+    static OsalMutex mutex{};
+    static const bool cCreated = (osalMutexCreate(&mutex, OsalMutexType::eNonRecursive) == OsalError::eOk);
+    return cCreated ? &mutex : nullptr;
+}
+
+/// Head of the intrusive list of the registered threads.
+static ThreadRegistryEntry* registryHead{}; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+void threadRegistryAdd(ThreadRegistryEntry* entry)
+{
+    auto* registry = registryMutex();
+    if (registry == nullptr)
+        return;
+
+    osalMutexLock(registry);
+    entry->prev = nullptr;
+    entry->next = registryHead;
+    if (registryHead != nullptr)
+        registryHead->prev = entry;
+
+    registryHead = entry;
+    osalMutexUnlock(registry);
+}
+
+void threadRegistryRemove(ThreadRegistryEntry* entry)
+{
+    auto* registry = registryMutex();
+    if (registry == nullptr)
+        return;
+
+    osalMutexLock(registry);
+    if (entry->prev != nullptr)
+        entry->prev->next = entry->next;
+    else if (registryHead == entry)
+        registryHead = entry->next;
+
+    if (entry->next != nullptr)
+        entry->next->prev = entry->prev;
+
+    osalMutexUnlock(registry);
+
+    entry->prev = nullptr;
+    entry->next = nullptr;
+}
+
+bool threadRegistryContains(uint32_t id, uint64_t startTimestampNs)
+{
+    for (auto* entry = registryHead; entry != nullptr; entry = entry->next) {
+        if (entry->info.id == id && entry->info.startTimestampNs == startTimestampNs)
+            return true;
+    }
+
+    return false;
+}
+
+void threadRegistryLock()
+{
+    if (auto* registry = registryMutex())
+        osalMutexLock(registry);
+}
+
+void threadRegistryUnlock()
+{
+    if (auto* registry = registryMutex())
+        osalMutexUnlock(registry);
+}
+
+void threadRegistryReset(ThreadRegistryEntry* survivor)
+{
+    registryHead = survivor;
+    if (survivor != nullptr) {
+        survivor->prev = nullptr;
+        survivor->next = nullptr;
+    }
+}
+
+OsalError osalThreadEnumerate(OsalThreadInfo* infos, size_t size, size_t* count)
+{
+    if ((infos == nullptr && size != 0) || count == nullptr)
+        return OsalError::eInvalidArgument;
+
+    auto* registry = registryMutex();
+    if (registry == nullptr)
+        return OsalError::eOsError;
+
+    std::size_t total = 0;
+
+    osalMutexLock(registry);
+    for (auto* entry = registryHead; entry != nullptr; entry = entry->next) {
+        if (total < size)
+            infos[total] = entry->info;
+
+        ++total;
+    }
+
+    osalMutexUnlock(registry);
+
+    *count = total;
+    return OsalError::eOk;
+}
@@ -36,11 +36,6 @@
 
 namespace osal {
 
-struct ErrorCategory : std::error_category {
-    [[nodiscard]] const char* name() const noexcept override;
-    [[nodiscard]] std::string message(int value) const override;
-};
-
 const char* ErrorCategory::name() const noexcept
 {
     return "osal";
@@ -58,15 +53,10 @@ std::string ErrorCategory::message(int value) const
         case OsalError::eNotLocked: return "not locked";
         case OsalError::eLocked: return "locked";
         case OsalError::eTimeout: return "timeout";
+        case OsalError::eOwnerDead: return "owner dead";
+        case OsalError::eSchedulingFallback: return "scheduling fallback";
         default: return "(unrecognized error)";
     }
 }
 
 } // namespace osal
-
-// NOLINTNEXTLINE(readability-identifier-naming)
-std::error_code make_error_code(OsalError error)
-{
-    static const osal::ErrorCategory cErrorCategory{};
-    return {static_cast<int>(error), cErrorCategory};
-}
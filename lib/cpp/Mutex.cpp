@@ -33,7 +33,11 @@
 #include "osal/Mutex.hpp"
 
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
 
 namespace osal {
 
@@ -42,9 +46,15 @@ Mutex::Mutex(OsalMutexType type)
     osalMutexCreate(&m_mutex, type);
 }
 
+Mutex::Mutex(OsalMutexConfig config)
+{
+    osalMutexCreateEx(&m_mutex, config);
+}
+
 Mutex::Mutex(Mutex&& other) noexcept
 {
     std::swap(m_mutex, other.m_mutex);
+    std::swap(m_stats, other.m_stats);
 }
 
 Mutex::~Mutex()
@@ -53,35 +63,67 @@ Mutex::~Mutex()
         osalMutexDestroy(&m_mutex);
 }
 
-std::error_code Mutex::lock()
+std::error_code Mutex::tryLockIsr()
 {
-    return osalMutexLock(&m_mutex);
+    return osalMutexTryLockIsr(&m_mutex);
 }
 
-std::error_code Mutex::tryLock()
+std::error_code Mutex::timedLock(Timeout timeout)
 {
-    return osalMutexTryLock(&m_mutex);
+    if (timeout.isInfinity())
+        return lock();
+
+    auto deadlineNs = std::chrono::duration_cast<std::chrono::nanoseconds>(timeout.deadline().time_since_epoch());
+    return osalMutexTimedLockUntil(&m_mutex, deadlineNs.count());
 }
 
-std::error_code Mutex::tryLockIsr()
+std::error_code Mutex::unlockIsr()
 {
-    return osalMutexTryLockIsr(&m_mutex);
+    return osalMutexUnlockIsr(&m_mutex);
 }
 
-std::error_code Mutex::timedLock(Timeout timeout)
+std::error_code Mutex::setSpinBudget(std::uint32_t spinBudget)
+{
+    return osalMutexSetSpinBudget(&m_mutex, spinBudget);
+}
+
+std::error_code Mutex::enableStats(const char* name)
 {
-    std::uint32_t timeoutMs = std::chrono::duration_cast<std::chrono::milliseconds>(timeout.timeLeft()).count();
-    return osalMutexTimedLock(&m_mutex, timeoutMs);
+    if (m_stats)
+        return OsalError::eInvalidArgument;
+
+    auto stats = std::make_unique<OsalMutexStats>();
+    if (auto error = osalMutexEnableStats(&m_mutex, stats.get(), name))
+        return error;
+
+    m_stats = std::move(stats);
+    return OsalError::eOk;
 }
 
-std::error_code Mutex::unlock()
+std::error_code Mutex::disableStats()
 {
-    return osalMutexUnlock(&m_mutex);
+    if (auto error = osalMutexDisableStats(&m_mutex))
+        return error;
+
+    m_stats.reset();
+    return OsalError::eOk;
 }
 
-std::error_code Mutex::unlockIsr()
+std::error_code Mutex::stats(OsalMutexStats& snapshot)
 {
-    return osalMutexUnlockIsr(&m_mutex);
+    return osalMutexGetStats(&m_mutex, &snapshot);
+}
+
+std::error_code Mutex::resetStats()
+{
+    return osalMutexResetStats(&m_mutex);
+}
+
+std::vector<OsalMutexStats> topContendedMutexes(std::size_t count)
+{
+    std::vector<OsalMutexStats> snapshots(count);
+    snapshots.resize(osalMutexStatsTopContended(snapshots.data(), snapshots.size()));
+    return snapshots;
 }
 
 } // namespace osal
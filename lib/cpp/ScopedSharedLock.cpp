@@ -4,7 +4,7 @@
 /// @author Kuba Sejdak
 /// @copyright BSD 2-Clause License
 ///
-/// Copyright (c) 2020-2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
 /// All rights reserved.
 ///
 /// Redistribution and use in source and binary forms, with or without
@@ -30,52 +30,24 @@
 ///
 /////////////////////////////////////////////////////////////////////////////////////
 
-#include "osal/ScopedLock.hpp"
+#include "osal/ScopedSharedLock.hpp"
 
 namespace osal {
 
-ScopedLock::ScopedLock(Mutex& mutex)
+ScopedSharedLock::ScopedSharedLock(SharedMutex& mutex)
     : m_mutex(mutex)
-{
-    lock();
-}
+    , m_locked(!m_mutex.lockShared())
+{}
 
-ScopedLock::ScopedLock(Mutex& mutex, Timeout timeout)
+ScopedSharedLock::ScopedSharedLock(SharedMutex& mutex, Timeout timeout)
     : m_mutex(mutex)
-{
-    timedLock(timeout);
-}
-
-ScopedLock::~ScopedLock()
-{
-    unlock();
-}
-
-std::error_code ScopedLock::lock()
-{
-    auto error = m_mutex.lock();
-    if (!error)
-        m_locked = true;
-
-    return error;
-}
-
-std::error_code ScopedLock::timedLock(Timeout timeout)
-{
-    auto error = m_mutex.timedLock(timeout);
-    if (!error)
-        m_locked = true;
-
-    return error;
-}
+    , m_locked(!m_mutex.timedLockShared(timeout))
+{}
 
-std::error_code ScopedLock::unlock()
+ScopedSharedLock::~ScopedSharedLock()
 {
-    auto error = m_mutex.unlock();
-    if (!error)
-        m_locked = false;
-
-    return error;
+    if (m_locked)
+        m_mutex.unlockShared();
 }
 
 } // namespace osal
@@ -42,6 +42,11 @@ Semaphore::Semaphore(unsigned int initialValue)
     osalSemaphoreCreate(&m_semaphore, initialValue);
 }
 
+Semaphore::Semaphore(unsigned int initialValue, OsalSemaphoreType type)
+{
+    osalSemaphoreCreateEx(&m_semaphore, initialValue, type);
+}
+
 Semaphore::Semaphore(Semaphore&& other) noexcept
 {
     std::swap(m_semaphore, other.m_semaphore);
@@ -58,11 +63,21 @@ std::error_code Semaphore::wait()
     return osalSemaphoreWait(&m_semaphore);
 }
 
+std::error_code Semaphore::wait(unsigned int count)
+{
+    return osalSemaphoreWaitMany(&m_semaphore, count);
+}
+
 std::error_code Semaphore::tryWait()
 {
     return osalSemaphoreTryWait(&m_semaphore);
 }
 
+std::error_code Semaphore::tryWait(unsigned int count)
+{
+    return osalSemaphoreTryWaitMany(&m_semaphore, count);
+}
+
 std::error_code Semaphore::tryWaitIsr()
 {
     return osalSemaphoreTryWaitIsr(&m_semaphore);
@@ -70,8 +85,20 @@ std::error_code Semaphore::tryWaitIsr()
 
 std::error_code Semaphore::timedWait(Timeout timeout)
 {
-    std::uint32_t timeoutMs = std::chrono::duration_cast<std::chrono::milliseconds>(timeout.timeLeft()).count();
-    return osalSemaphoreTimedWait(&m_semaphore, timeoutMs);
+    if (timeout.isInfinity())
+        return wait();
+
+    auto deadlineNs = std::chrono::duration_cast<std::chrono::nanoseconds>(timeout.deadline().time_since_epoch());
+    return osalSemaphoreTimedWaitUntil(&m_semaphore, deadlineNs.count());
+}
+
+std::error_code Semaphore::timedWait(unsigned int count, Timeout timeout)
+{
+    if (timeout.isInfinity())
+        return wait(count);
+
+    auto deadlineNs = std::chrono::duration_cast<std::chrono::nanoseconds>(timeout.deadline().time_since_epoch());
+    return osalSemaphoreTimedWaitManyUntil(&m_semaphore, count, deadlineNs.count());
 }
 
 std::error_code Semaphore::signal()
@@ -79,9 +106,19 @@ std::error_code Semaphore::signal()
     return osalSemaphoreSignal(&m_semaphore);
 }
 
+std::error_code Semaphore::signal(unsigned int count)
+{
+    return osalSemaphoreSignalMany(&m_semaphore, count);
+}
+
 std::error_code Semaphore::signalIsr()
 {
     return osalSemaphoreSignalIsr(&m_semaphore);
 }
 
+std::error_code Semaphore::nativeHandle(int& handle)
+{
+    return osalSemaphoreNativeHandle(&m_semaphore, &handle);
+}
+
 } // namespace osal
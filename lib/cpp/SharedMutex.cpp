@@ -0,0 +1,103 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#include "osal/SharedMutex.hpp"
+
+#include <chrono>
+
+namespace osal {
+
+SharedMutex::SharedMutex(OsalRwLockPolicy policy)
+{
+    osalRwLockCreate(&m_rwLock, policy);
+}
+
+SharedMutex::SharedMutex(SharedMutex&& other) noexcept
+{
+    std::swap(m_rwLock, other.m_rwLock);
+}
+
+SharedMutex::~SharedMutex()
+{
+    if (m_rwLock.initialized)
+        osalRwLockDestroy(&m_rwLock);
+}
+
+std::error_code SharedMutex::lock()
+{
+    return osalRwLockWriteLock(&m_rwLock);
+}
+
+std::error_code SharedMutex::tryLock()
+{
+    return osalRwLockWriteTryLock(&m_rwLock);
+}
+
+std::error_code SharedMutex::timedLock(Timeout timeout)
+{
+    if (timeout.isInfinity())
+        return lock();
+
+    auto deadlineNs = std::chrono::duration_cast<std::chrono::nanoseconds>(timeout.deadline().time_since_epoch());
+    return osalRwLockWriteTimedLockUntil(&m_rwLock, deadlineNs.count());
+}
+
+std::error_code SharedMutex::unlock()
+{
+    return osalRwLockWriteUnlock(&m_rwLock);
+}
+
+std::error_code SharedMutex::lockShared()
+{
+    return osalRwLockReadLock(&m_rwLock);
+}
+
+std::error_code SharedMutex::tryLockShared()
+{
+    return osalRwLockReadTryLock(&m_rwLock);
+}
+
+std::error_code SharedMutex::timedLockShared(Timeout timeout)
+{
+    if (timeout.isInfinity())
+        return lockShared();
+
+    auto deadlineNs = std::chrono::duration_cast<std::chrono::nanoseconds>(timeout.deadline().time_since_epoch());
+    return osalRwLockReadTimedLockUntil(&m_rwLock, deadlineNs.count());
+}
+
+std::error_code SharedMutex::unlockShared()
+{
+    return osalRwLockReadUnlock(&m_rwLock);
+}
+
+} // namespace osal
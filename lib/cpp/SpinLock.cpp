@@ -0,0 +1,85 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#include "osal/SpinLock.hpp"
+
+#include <utility>
+
+namespace osal {
+
+SpinLock::SpinLock(OsalSpinLockType type)
+{
+    osalSpinLockCreate(&m_spinLock, type);
+}
+
+SpinLock::SpinLock(SpinLock&& other) noexcept
+{
+    std::swap(m_spinLock, other.m_spinLock);
+}
+
+SpinLock::~SpinLock()
+{
+    if (m_spinLock.initialized)
+        osalSpinLockDestroy(&m_spinLock);
+}
+
+std::error_code SpinLock::lock()
+{
+    return osalSpinLockLock(&m_spinLock);
+}
+
+std::error_code SpinLock::tryLock()
+{
+    return osalSpinLockTryLock(&m_spinLock);
+}
+
+std::error_code SpinLock::unlock()
+{
+    return osalSpinLockUnlock(&m_spinLock);
+}
+
+std::error_code SpinLock::lockIsr()
+{
+    return osalSpinLockLockIsr(&m_spinLock);
+}
+
+std::error_code SpinLock::tryLockIsr()
+{
+    return osalSpinLockTryLockIsr(&m_spinLock);
+}
+
+std::error_code SpinLock::unlockIsr()
+{
+    return osalSpinLockUnlockIsr(&m_spinLock);
+}
+
+} // namespace osal
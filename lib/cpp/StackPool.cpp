@@ -0,0 +1,70 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#include "osal/StackPool.hpp"
+
+#include <utility>
+
+namespace osal {
+
+StackPool::StackPool(std::size_t stackSize, std::size_t count, bool guardPages)
+{
+    osalStackPoolCreate(&m_pool, {stackSize, count, guardPages});
+}
+
+StackPool::StackPool(StackPool&& other) noexcept
+{
+    std::swap(m_pool, other.m_pool);
+}
+
+StackPool::~StackPool()
+{
+    if (m_pool.initialized)
+        osalStackPoolDestroy(&m_pool);
+}
+
+std::error_code StackPool::acquire(void*& stack)
+{
+    return osalStackPoolAcquire(&m_pool, &stack);
+}
+
+std::error_code StackPool::release(void* stack)
+{
+    return osalStackPoolRelease(&m_pool, stack);
+}
+
+std::size_t StackPool::stackSize() const
+{
+    return osalStackPoolStackSize(&m_pool);
+}
+
+} // namespace osal
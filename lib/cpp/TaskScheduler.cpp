@@ -0,0 +1,188 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#include "osal/TaskScheduler.hpp"
+
+#include "osal/Error.hpp"
+#include "osal/ScopedLock.hpp"
+
+#include <utility>
+
+namespace osal {
+namespace detail {
+
+void RootTask::promise_type::FinalAwaiter::await_suspend(std::coroutine_handle<promise_type> handle) const noexcept
+{
+    handle.promise().scheduler->finished(handle.promise());
+}
+
+/// Executes the given task as the top-level coroutine.
+/// @param task                 Task to be executed.
+/// @return Handle to the top-level coroutine.
+static RootTask runRoot(Task<void> task)
+{
+    co_await task;
+}
+
+} // namespace detail
+
+TaskScheduler::~TaskScheduler()
+{
+    // Destroying top-level coroutine destroys also all tasks awaited by it.
+    while (m_tasks != nullptr) {
+        auto* promise = std::exchange(m_tasks, m_tasks->next);
+        std::coroutine_handle<RootPromise>::from_promise(*promise).destroy();
+    }
+}
+
+std::error_code TaskScheduler::spawn(Task<void> task)
+{
+    if (!task.valid())
+        return OsalError::eInvalidArgument;
+
+    auto root = detail::runRoot(std::move(task));
+    if (!root.handle())
+        return OsalError::eOsError;
+
+    auto& promise = root.handle().promise();
+    promise.scheduler = this;
+
+    {
+        ScopedLock lock(m_mutex);
+        promise.next = m_tasks;
+        if (m_tasks != nullptr)
+            m_tasks->prev = &promise;
+
+        m_tasks = &promise;
+
+        if (m_readyTail != nullptr)
+            m_readyTail->nextReady = &promise;
+        else
+            m_readyHead = &promise;
+
+        m_readyTail = &promise;
+        m_tasksCount.fetch_add(1);
+    }
+
+    m_wakeup.notify();
+    return OsalError::eOk;
+}
+
+std::error_code TaskScheduler::run()
+{
+    while (!m_stopRequested.exchange(false)) {
+        bool resumed = resumeSpawned();
+        resumed = resumeWaiters() || resumed;
+
+        if (m_tasksCount.load() == 0)
+            break;
+
+        if (!resumed)
+            m_wakeup.idle(m_waiters, m_pollInterval);
+    }
+
+    return OsalError::eOk;
+}
+
+void TaskScheduler::stop()
+{
+    m_stopRequested.store(true);
+    m_wakeup.notify();
+}
+
+std::error_code TaskScheduler::unlock(Mutex& mutex)
+{
+    auto error = mutex.unlock();
+    if (!error)
+        m_wakeup.notify();
+
+    return error;
+}
+
+std::error_code TaskScheduler::signal(Semaphore& semaphore)
+{
+    auto error = semaphore.signal();
+    if (!error)
+        m_wakeup.notify();
+
+    return error;
+}
+
+void TaskScheduler::suspend(detail::TaskWaiter& waiter)
+{
+    m_waiters.add(waiter);
+}
+
+void TaskScheduler::finished(RootPromise& promise)
+{
+    {
+        ScopedLock lock(m_mutex);
+        if (promise.prev != nullptr)
+            promise.prev->next = promise.next;
+        else
+            m_tasks = promise.next;
+
+        if (promise.next != nullptr)
+            promise.next->prev = promise.prev;
+    }
+
+    std::coroutine_handle<RootPromise>::from_promise(promise).destroy();
+    m_tasksCount.fetch_sub(1);
+}
+
+bool TaskScheduler::resumeSpawned()
+{
+    RootPromise* promise{};
+    {
+        ScopedLock lock(m_mutex);
+        promise = std::exchange(m_readyHead, nullptr);
+        m_readyTail = nullptr;
+    }
+
+    bool resumed = (promise != nullptr);
+    while (promise != nullptr) {
+        // Task can finish during resume() and release its promise, so the next one has to be read first.
+        auto* next = std::exchange(promise->nextReady, nullptr);
+        std::coroutine_handle<RootPromise>::from_promise(*promise).resume();
+        promise = next;
+    }
+
+    return resumed;
+}
+
+bool TaskScheduler::resumeWaiters()
+{
+    // Waiter is part of the coroutine frame, so it can't be accessed after the coroutine is resumed.
+    return m_waiters.completeReady([](detail::TaskWaiter& waiter) { waiter.handle.resume(); });
+}
+
+} // namespace osal
@@ -34,12 +34,31 @@
 
 #include "osal/Error.h"
 
+#include <string>
 #include <system_error>
 #include <type_traits>
 
+namespace osal {
+
+/// Represents error category of all error codes created from OsalError enum.
+struct ErrorCategory : std::error_category {
+    [[nodiscard]] const char* name() const noexcept override;
+    [[nodiscard]] std::string message(int value) const override;
+};
+
+/// Global instance of the OSAL error category.
+/// @note This object is constant-initialized, so it can be used inline without any function-local static guards.
+inline const ErrorCategory cErrorCategory{};
+
+} // namespace osal
+
 /// Creates error code value for OsalError enum.
 /// @return std::error_code value created from OsalError enum.
-std::error_code make_error_code(OsalError error); // NOLINT(readability-identifier-naming)
+/// @note This function is inline, because it is called on every (also uncontended) path of the C++ API.
+inline std::error_code make_error_code(OsalError error) // NOLINT(readability-identifier-naming)
+{
+    return {static_cast<int>(error), osal::cErrorCategory};
+}
 
 namespace std {
 
@@ -0,0 +1,554 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "osal/Error.hpp"
+#include "osal/Fiber.h"
+#include "osal/Mutex.hpp"
+#include "osal/ScopedLock.hpp"
+#include "osal/Semaphore.hpp"
+#include "osal/Thread.hpp"
+#include "osal/Timeout.hpp"
+#include "osal/WaiterSet.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <new>
+#include <string_view>
+#include <system_error>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace osal {
+
+/// Default size of the stack of each fiber.
+inline constexpr std::size_t cFiberStackSize = 16 * 1024;
+
+/// Represents M:N scheduler of stackful fibers. Fibers are executed cooperatively by a small number of carrier
+/// threads. Each fiber has its own stack, so it can run ordinary blocking-style code, as long as it blocks only
+/// through the methods of this scheduler (lock(), wait(), sleep() and yield()), which switch to other fibers instead
+/// of blocking the carrier thread.
+/// @tparam cCarriers           Number of carrier threads.
+/// @tparam cStackSize          Stack size of each fiber.
+/// @tparam cPriority           Priority of the carrier threads.
+/// @tparam cCarrierStackSize   Stack size of the carrier threads.
+/// @note Fibers are distributed among carriers upon spawn and never migrate. This way OS mutexes locked by the fiber
+///       are always unlocked by the same thread, so awaited mutexes must not be recursive.
+/// @note Readiness of mutexes and semaphores is checked with tryLock() and tryWait() after each round of execution
+///       of the ready fibers. Releasing them with unlock() and signal() of the scheduler wakes up the carriers
+///       immediately. Objects released in any other way are noticed by the fallback polling, which costs one check
+///       per awaited object every poll interval and adds up to one poll interval of latency.
+/// @note Sleeping fibers are kept in the deadline-ordered heap, so they cost nothing until they expire.
+/// @note Each fiber is allocated from the heap together with its stack, without guard pages.
+/// @note Fibers are supported only on platforms providing fiber contexts (see osal/Fiber.h).
+template <std::size_t cCarriers,
+          std::size_t cStackSize = cFiberStackSize,
+          OsalThreadPriority cPriority = cOsalThreadDefaultPriority,
+          std::size_t cCarrierStackSize = cOsalThreadDefaultStackSize>
+class FiberScheduler {
+    static_assert(cCarriers > 0, "FiberScheduler requires at least one carrier");
+
+public:
+    /// Default interval between checks of the awaited mutexes and semaphores, when carrier has nothing else to do.
+    static constexpr Duration cPollInterval = 1ms;
+
+    /// Default constructor.
+    /// @note This constructor creates scheduler without any carriers. It can be later started with start() method.
+    FiberScheduler() = default;
+
+    /// Constructor.
+    /// @param namePrefix       Prefix of the carrier thread names. Each name is suffixed with the carrier index.
+    /// @param pollInterval     Interval between fallback checks of the awaited mutexes and semaphores, when carrier
+    ///                         has nothing else to do. Duration::max() disables polling, in which case the awaited
+    ///                         objects have to be released only with unlock() and signal() or by the fibers of
+    ///                         the same carrier.
+    /// @note This constructor immediately starts all carrier threads.
+    explicit FiberScheduler(std::string_view namePrefix, Duration pollInterval = cPollInterval)
+        : m_pollInterval(pollInterval)
+    {
+        start(namePrefix);
+    }
+
+    /// Copy constructor.
+    /// @note This constructor is deleted, because FiberScheduler is not meant to be copy-constructed.
+    FiberScheduler(const FiberScheduler&) = delete;
+
+    /// Move constructor.
+    /// @note This constructor is deleted, because carriers keep reference to the scheduler.
+    FiberScheduler(FiberScheduler&&) = delete;
+
+    /// Destructor.
+    /// @note This destructor gracefully shuts down the scheduler, so it blocks until all fibers are finished.
+    ~FiberScheduler() { shutdown(); }
+
+    /// Copy assignment operator.
+    /// @return Reference to self.
+    /// @note This operator is deleted, because FiberScheduler is not meant to be copy-assigned.
+    FiberScheduler& operator=(const FiberScheduler&) = delete;
+
+    /// Move assignment operator.
+    /// @return Reference to self.
+    /// @note This operator is deleted, because FiberScheduler is not meant to be move-assigned.
+    FiberScheduler& operator=(FiberScheduler&&) = delete;
+
+    /// Starts all carrier threads.
+    /// @param namePrefix       Prefix of the carrier thread names. Each name is suffixed with the carrier index.
+    /// @return Error code of the operation.
+    std::error_code start(std::string_view namePrefix = {})
+    {
+        if (m_startedCarriers != 0 || m_running.exchange(true))
+            return OsalError::eThreadAlreadyStarted;
+
+        std::error_code result;
+        for (std::size_t i = 0; i < cCarriers; ++i) {
+            auto name = detail::makeWorkerName(namePrefix, i);
+
+            auto error = m_threads[i].start(std::string_view(name.data()), [this, i] { carrierLoop(i); });
+            if (error && error != OsalError::eSchedulingFallback) {
+                shutdown();
+                return error;
+            }
+
+            ++m_startedCarriers;
+            if (error)
+                result = error;
+        }
+
+        return result;
+    }
+
+    /// Gracefully shuts down the scheduler. New fibers are rejected, already spawned ones are executed until they
+    /// finish and all carrier threads are joined.
+    /// @return Error code of the operation.
+    std::error_code shutdown()
+    {
+        if (!m_running.exchange(false))
+            return OsalError::eOk;
+
+        for (std::size_t i = 0; i < m_startedCarriers; ++i)
+            m_carriers[i].wakeup.notify();
+
+        for (std::size_t i = 0; i < m_startedCarriers; ++i)
+            m_threads[i].join();
+
+        // Fibers spawned concurrently with the shutdown could be left never started.
+        for (auto& carrier : m_carriers) {
+            while (auto* fiber = carrier.ready.head) {
+                carrier.ready.head = fiber->next;
+                fiber->destroy(fiber);
+                carrier.fibersCount.fetch_sub(1);
+            }
+
+            carrier.ready.tail = nullptr;
+        }
+
+        return OsalError::eOk;
+    }
+
+    /// Creates new fiber executing the given function.
+    /// @tparam Function        Type of user function to be executed.
+    /// @tparam Args            Types of user arguments to be passed to the user function.
+    /// @param function         User function to be executed.
+    /// @param args             User arguments to be passed to the user function.
+    /// @return Error code of the operation.
+    /// @note This method can be called from any thread, including fibers of this scheduler.
+    template <typename Function, typename... Args>
+        requires std::invocable<std::decay_t<Function>, std::decay_t<Args>...>
+    std::error_code spawn(Function&& function, Args&&... args)
+    {
+        using FiberType = FiberImpl<std::tuple<std::decay_t<Function>, std::decay_t<Args>...>>;
+
+        if (!m_running.load())
+            return OsalError::eInvalidArgument;
+
+        // Fiber control block and its stack are allocated together, stack occupies the end of the block.
+        constexpr auto cHeaderSize = (sizeof(FiberType) + alignof(std::max_align_t) - 1)
+                                   & ~(alignof(std::max_align_t) - 1);
+        auto* memory = ::operator new(cHeaderSize + cStackSize, std::nothrow);
+        if (memory == nullptr)
+            return OsalError::eOsError;
+
+        auto* fiber = std::construct_at(static_cast<FiberType*>(memory),
+                                        std::forward<Function>(function),
+                                        std::forward<Args>(args)...);
+        auto* stack = static_cast<std::byte*>(memory) + cHeaderSize;
+        if (auto error = osalFiberContextCreate(&fiber->context, stack, cStackSize, fiberEntry, fiber)) {
+            fiber->destroy(fiber);
+            return error;
+        }
+
+        auto& carrier = m_carriers[m_nextCarrier.fetch_add(1) % cCarriers];
+        fiber->carrier = &carrier;
+        carrier.fibersCount.fetch_add(1);
+        {
+            ScopedLock lock(carrier.mutex);
+            carrier.ready.push(fiber);
+        }
+
+        carrier.wakeup.notify();
+        return OsalError::eOk;
+    }
+
+    /// Locks the given mutex. If called from the fiber, then other fibers are executed while waiting.
+    /// @param mutex            Mutex to be locked.
+    /// @param timeout          Maximal time to wait for the mutex.
+    /// @return Error code of the operation.
+    std::error_code lock(Mutex& mutex, Timeout timeout = Timeout::infinity())
+    {
+        return suspend(detail::pollMutex, &mutex, timeout, [&mutex, &timeout] { return mutex.timedLock(timeout); });
+    }
+
+    /// Decrements the given semaphore. If called from the fiber, then other fibers are executed while waiting.
+    /// @param semaphore        Semaphore to be decremented.
+    /// @param timeout          Maximal time to wait for the semaphore.
+    /// @return Error code of the operation.
+    std::error_code wait(Semaphore& semaphore, Timeout timeout = Timeout::infinity())
+    {
+        return suspend(detail::pollSemaphore, &semaphore, timeout, [&semaphore, &timeout] {
+            return semaphore.timedWait(timeout);
+        });
+    }
+
+    /// Unlocks the given mutex and wakes up the carriers, so that fiber waiting for it is resumed without delay.
+    /// @param mutex            Mutex to be unlocked.
+    /// @return Error code of the operation.
+    /// @note This method can be called from any thread owning the mutex, including fibers of this scheduler.
+    std::error_code unlock(Mutex& mutex)
+    {
+        auto error = mutex.unlock();
+        if (!error)
+            notifyAll();
+
+        return error;
+    }
+
+    /// Increments the given semaphore and wakes up the carriers, so that fiber waiting for it is resumed without
+    /// delay.
+    /// @param semaphore        Semaphore to be incremented.
+    /// @return Error code of the operation.
+    /// @note This method can be called from any thread, including fibers of this scheduler.
+    std::error_code signal(Semaphore& semaphore)
+    {
+        auto error = semaphore.signal();
+        if (!error)
+            notifyAll();
+
+        return error;
+    }
+
+    /// Suspends the caller until the given timeout expires. If called from the fiber, then other fibers are executed
+    /// while waiting.
+    /// @param timeout          Timeout to be waited for.
+    /// @return Error code of the operation (always OsalError::eOk).
+    std::error_code wait(Timeout timeout)
+    {
+        return suspend(nullptr, nullptr, timeout, [&timeout] {
+            sleepUntilExpired(timeout);
+            return std::error_code{};
+        });
+    }
+
+    /// Suspends the caller for the specified amount of time. If called from the fiber, then other fibers are
+    /// executed while waiting.
+    /// @tparam Representation  Signed arithmetic type representing the number of ticks in the clock's duration.
+    /// @tparam Period          A std::ratio type representing the tick period of the clock, in seconds.
+    /// @param duration         Amount of time for which the caller should be suspended.
+    template <typename Representation, typename Period>
+    void sleep(const std::chrono::duration<Representation, Period>& duration)
+    {
+        wait(Timeout(std::chrono::duration_cast<Duration>(duration)));
+    }
+
+    /// Lets other fibers from the same carrier run. If called outside of the fiber, then it yields the thread.
+    void yield()
+    {
+        auto* fiber = currentFiber();
+        if (fiber == nullptr) {
+            thread::yield();
+            return;
+        }
+
+        fiber->state = FiberState::eYielded;
+        switchToCarrier(*fiber);
+    }
+
+    /// Checks if the caller is a fiber of this scheduler.
+    /// @return Flag indicating if the caller is a fiber of this scheduler.
+    [[nodiscard]] bool insideFiber() { return currentFiber() != nullptr; }
+
+    /// Returns number of fibers, which are not finished yet.
+    /// @return Number of fibers, which are not finished yet.
+    [[nodiscard]] std::size_t fibersCount() const
+    {
+        std::size_t count = 0;
+        for (const auto& carrier : m_carriers)
+            count += carrier.fibersCount.load();
+
+        return count;
+    }
+
+private:
+    struct Carrier;
+
+    /// Represents reason, for which fiber has switched back to its carrier.
+    enum class FiberState {
+        eYielded,
+        eWaiting,
+        eFinished
+    };
+
+    /// Represents part of the fiber, which doesn't depend on the type of the user function.
+    /// @note Child and sibling are used only by sleeping fibers, which are kept in the deadline-ordered heap.
+    struct Fiber {
+        OsalFiberContext context{};
+        Carrier* carrier{};
+        Fiber* next{};
+        FiberState state{};
+        bool (*poll)(void*){};
+        void* object{};
+        Timeout timeout{Timeout::infinity()};
+        std::error_code result;
+        Fiber* child{};
+        Fiber* sibling{};
+        void (*run)(Fiber*){};
+        void (*destroy)(Fiber*){};
+    };
+
+    /// Represents fiber executing the given user function.
+    /// @tparam Callable        Type of the stored user function and its arguments.
+    template <typename Callable>
+    struct FiberImpl : Fiber {
+        template <typename... Args>
+        explicit FiberImpl(Args&&... args)
+            : callable(std::forward<Args>(args)...)
+        {
+            this->run = [](Fiber* fiber) {
+                std::apply(
+                    [](auto&& function, auto&&... arguments) {
+                        std::invoke(std::forward<decltype(function)>(function),
+                                    std::forward<decltype(arguments)>(arguments)...);
+                    },
+                    std::move(static_cast<FiberImpl*>(fiber)->callable));
+            };
+            this->destroy = [](Fiber* fiber) {
+                std::destroy_at(static_cast<FiberImpl*>(fiber));
+                ::operator delete(static_cast<void*>(fiber));
+            };
+        }
+
+        Callable callable;
+    };
+
+    /// Represents intrusive FIFO queue of fibers.
+    struct FiberQueue {
+        void push(Fiber* fiber)
+        {
+            fiber->next = nullptr;
+            if (tail != nullptr)
+                tail->next = fiber;
+            else
+                head = fiber;
+
+            tail = fiber;
+        }
+
+        Fiber* head{};
+        Fiber* tail{};
+    };
+
+    /// Represents state of the single carrier thread.
+    struct Carrier {
+        Mutex mutex;
+        detail::Wakeup wakeup;
+        FiberQueue ready;
+        detail::WaiterSet<Fiber> waiting;
+        OsalFiberContext context{};
+        std::atomic<Fiber*> current{};
+        std::atomic<std::uint32_t> id{};
+        std::atomic<bool> started{};
+        std::atomic<std::size_t> fibersCount{};
+    };
+
+    /// First function executed by each fiber.
+    /// @param param            Fiber to be executed.
+    static void fiberEntry(void* param)
+    {
+        auto* fiber = static_cast<Fiber*>(param);
+        fiber->run(fiber);
+        fiber->state = FiberState::eFinished;
+        osalFiberContextSwitch(&fiber->context, &fiber->carrier->context);
+    }
+
+    /// Returns fiber, which is the caller.
+    /// @return Fiber, which is the caller or nullptr if caller is not a fiber of this scheduler.
+    Fiber* currentFiber()
+    {
+        auto id = thread::id();
+        for (auto& carrier : m_carriers) {
+            if (carrier.started.load(std::memory_order_acquire) && carrier.id.load(std::memory_order_relaxed) == id)
+                return carrier.current.load(std::memory_order_relaxed);
+        }
+
+        return nullptr;
+    }
+
+    /// Switches from the given fiber back to its carrier.
+    /// @param fiber            Fiber to be suspended.
+    static void switchToCarrier(Fiber& fiber) { osalFiberContextSwitch(&fiber.context, &fiber.carrier->context); }
+
+    /// Suspends the calling fiber until the given object is acquired or the timeout expires.
+    /// @tparam BlockingCall    Type of the function used when caller is not a fiber.
+    /// @param poll             Function trying to acquire the object (nullptr for pure timers).
+    /// @param object           Object to be acquired.
+    /// @param timeout          Maximal time to wait.
+    /// @param blockingCall     Function blocking the caller, used when caller is not a fiber.
+    /// @return Error code of the operation.
+    template <typename BlockingCall>
+    std::error_code suspend(bool (*poll)(void*), void* object, Timeout timeout, BlockingCall blockingCall)
+    {
+        auto* fiber = currentFiber();
+        if (fiber == nullptr)
+            return blockingCall();
+
+        fiber->poll = poll;
+        fiber->object = object;
+        fiber->timeout = timeout;
+        if (detail::WaiterSet<Fiber>::complete(*fiber))
+            return fiber->result;
+
+        fiber->state = FiberState::eWaiting;
+        switchToCarrier(*fiber);
+        return fiber->result;
+    }
+
+    /// Executes all fibers, which are ready to run.
+    /// @param carrier          Carrier executing the fibers.
+    /// @return Flag indicating if any fiber has been executed.
+    bool runReady(Carrier& carrier)
+    {
+        Fiber* fiber{};
+        {
+            ScopedLock lock(carrier.mutex);
+            fiber = std::exchange(carrier.ready.head, nullptr);
+            carrier.ready.tail = nullptr;
+        }
+
+        bool executed = (fiber != nullptr);
+        while (fiber != nullptr) {
+            auto* next = fiber->next;
+            carrier.current.store(fiber, std::memory_order_relaxed);
+            osalFiberContextSwitch(&carrier.context, &fiber->context);
+            carrier.current.store(nullptr, std::memory_order_relaxed);
+
+            // State is handled only after the switch, so that fiber is never queued before its context is saved.
+            switch (fiber->state) {
+                case FiberState::eYielded: {
+                    ScopedLock lock(carrier.mutex);
+                    carrier.ready.push(fiber);
+                    break;
+                }
+                case FiberState::eWaiting: carrier.waiting.add(*fiber); break;
+                case FiberState::eFinished:
+                    fiber->destroy(fiber);
+                    carrier.fibersCount.fetch_sub(1);
+                    break;
+            }
+
+            fiber = next;
+        }
+
+        return executed;
+    }
+
+    /// Moves all fibers, which waits can be completed, to the ready queue.
+    /// @param carrier          Carrier owning the fibers.
+    /// @return Flag indicating if any fiber has become ready.
+    static bool pollWaiting(Carrier& carrier)
+    {
+        FiberQueue completed;
+        if (!carrier.waiting.completeReady([&completed](Fiber& fiber) { completed.push(&fiber); }))
+            return false;
+
+        ScopedLock lock(carrier.mutex);
+        if (carrier.ready.tail != nullptr)
+            carrier.ready.tail->next = completed.head;
+        else
+            carrier.ready.head = completed.head;
+
+        carrier.ready.tail = completed.tail;
+        return true;
+    }
+
+    /// Wakes up all carriers, because any of them may have fibers waiting for the released object.
+    void notifyAll()
+    {
+        for (auto& carrier : m_carriers)
+            carrier.wakeup.notify();
+    }
+
+    /// Main loop of each carrier thread.
+    /// @param index            Index of the carrier.
+    void carrierLoop(std::size_t index)
+    {
+        auto& carrier = m_carriers[index];
+        carrier.id.store(thread::id(), std::memory_order_relaxed);
+        carrier.started.store(true, std::memory_order_release);
+
+        while (true) {
+            bool progress = runReady(carrier);
+            progress = pollWaiting(carrier) || progress;
+
+            if (!m_running.load() && carrier.fibersCount.load() == 0)
+                return;
+
+            if (!progress)
+                carrier.wakeup.idle(carrier.waiting, m_pollInterval);
+        }
+    }
+
+    std::array<Carrier, cCarriers> m_carriers;
+    std::array<Thread<cPriority, cCarrierStackSize>, cCarriers> m_threads;
+    Duration m_pollInterval{cPollInterval};
+    std::atomic<std::size_t> m_nextCarrier{};
+    std::atomic<bool> m_running{};
+    std::size_t m_startedCarriers{};
+};
+
+} // namespace osal
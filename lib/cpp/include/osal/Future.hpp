@@ -0,0 +1,210 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "osal/Error.hpp"
+#include "osal/Semaphore.hpp"
+#include "osal/Timeout.hpp"
+
+#include <cassert>
+#include <optional>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+namespace osal {
+
+template <typename T>
+class Future;
+
+namespace detail {
+
+/// Helper type giving OSAL executors access to the producer side of the Future.
+struct FutureAccess {
+    /// Binds the given future to a new asynchronous operation.
+    /// @tparam T               Type of the result.
+    /// @param future           Future to be bound.
+    /// @return Error code of the operation.
+    template <typename T>
+    static std::error_code prepare(Future<T>& future)
+    {
+        if (future.m_pending)
+            return OsalError::eInvalidArgument;
+
+        future.m_pending = true;
+        future.m_done = false;
+        future.m_value.reset();
+        return OsalError::eOk;
+    }
+
+    /// Cancels binding of the future, when operation could not be started.
+    /// @tparam T               Type of the result.
+    /// @param future           Future to be released.
+    template <typename T>
+    static void cancel(Future<T>& future)
+    {
+        future.m_pending = false;
+    }
+
+    /// Stores the result in the future and wakes up its consumer.
+    /// @tparam T               Type of the result.
+    /// @tparam Value           Type of the value to be stored (none for void results).
+    /// @param future           Future to be fulfilled.
+    /// @param value            Result to be stored.
+    /// @note Future must not be accessed after this call, because its owner may destroy it immediately.
+    template <typename T, typename... Value>
+    static void fulfil(Future<T>& future, Value&&... value)
+    {
+        future.m_value.emplace(std::forward<Value>(value)...);
+        future.m_ready.signal();
+    }
+};
+
+} // namespace detail
+
+/// Represents result of the asynchronous operation delivered by one of the OSAL executors (e.g. osal::ThreadPool).
+/// @tparam T                   Type of the result. It can be void.
+/// @note Future is neither copyable nor movable, because executor writes the result directly into it. This way no
+///       shared state has to be allocated. Destroying future with pending operation blocks until it is finished.
+/// @note Future can be reused for another operation, once its result has been taken with get().
+template <typename T>
+class Future {
+public:
+    /// Default constructor.
+    /// @note This constructor creates future, which is not bound to any operation.
+    Future() = default;
+
+    /// Copy constructor.
+    /// @note This constructor is deleted, because Future is not meant to be copy-constructed.
+    Future(const Future&) = delete;
+
+    /// Move constructor.
+    /// @note This constructor is deleted, because Future is not meant to be move-constructed.
+    Future(Future&&) = delete;
+
+    /// Destructor.
+    /// @note If operation is still pending, then this destructor blocks until it is finished.
+    ~Future()
+    {
+        if (m_pending && !m_done)
+            m_ready.wait();
+    }
+
+    /// Copy assignment operator.
+    /// @return Reference to self.
+    /// @note This operator is deleted, because Future is not meant to be copy-assigned.
+    Future& operator=(const Future&) = delete;
+
+    /// Move assignment operator.
+    /// @return Reference to self.
+    /// @note This operator is deleted, because Future is not meant to be move-assigned.
+    Future& operator=(Future&&) = delete;
+
+    /// Checks if future is bound to an operation, whose result has not been taken yet.
+    /// @return Flag indicating if future is bound to an operation.
+    [[nodiscard]] bool valid() const { return m_pending; }
+
+    /// Checks if result of the operation is available. This function never blocks.
+    /// @return Flag indicating if result of the operation is available.
+    bool ready()
+    {
+        if (m_pending && !m_done)
+            m_done = !m_ready.tryWait();
+
+        return m_done;
+    }
+
+    /// Blocks the caller until result of the operation is available.
+    /// @return Error code of the operation.
+    std::error_code wait()
+    {
+        if (!m_pending)
+            return OsalError::eInvalidArgument;
+
+        if (!m_done) {
+            if (auto error = m_ready.wait())
+                return error;
+
+            m_done = true;
+        }
+
+        return OsalError::eOk;
+    }
+
+    /// Blocks the caller until result of the operation is available or the specified time elapses.
+    /// @param timeout          Maximal time to wait for the result.
+    /// @return Error code of the operation.
+    std::error_code timedWait(Timeout timeout)
+    {
+        if (!m_pending)
+            return OsalError::eInvalidArgument;
+
+        if (!m_done) {
+            if (auto error = m_ready.timedWait(timeout))
+                return error;
+
+            m_done = true;
+        }
+
+        return OsalError::eOk;
+    }
+
+    /// Waits for the result of the operation and takes it from the future.
+    /// @return Result of the operation.
+    /// @note Future has to be bound to an operation. After this call it is no longer bound and can be reused.
+    T get()
+    {
+        assert(m_pending);
+        wait();
+        m_pending = false;
+
+        if constexpr (!std::is_void_v<T>)
+            return std::move(*m_value);
+    }
+
+private:
+    friend struct detail::FutureAccess;
+
+    /// Helper type used to store the result of void operations.
+    struct Empty {};
+
+    /// Helper type representing storage of the result.
+    using Storage = std::conditional_t<std::is_void_v<T>, Empty, T>;
+
+    Semaphore m_ready{0};
+    std::optional<Storage> m_value;
+    bool m_pending{};
+    bool m_done{};
+};
+
+} // namespace osal
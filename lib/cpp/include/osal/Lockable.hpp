@@ -0,0 +1,135 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "osal/Timeout.hpp"
+#include "osal/timestamp.hpp"
+
+#include <chrono>
+#include <concepts>
+#include <system_error>
+
+namespace osal {
+
+/// Describes OSAL primitive, which can be exclusively locked, try-locked and unlocked (e.g. Mutex, SharedMutex or
+/// SpinLock). All operations report their result via std::error_code.
+template <typename T>
+concept Lockable = requires(T& lockable) {
+    { lockable.lock() } -> std::same_as<std::error_code>;
+    { lockable.tryLock() } -> std::same_as<std::error_code>;
+    { lockable.unlock() } -> std::same_as<std::error_code>;
+};
+
+/// Describes OSAL primitive, which additionally to Lockable can be locked with a timeout (e.g. Mutex or SharedMutex).
+template <typename T>
+concept TimedLockable = Lockable<T> && requires(T& lockable, Timeout timeout) {
+    { lockable.timedLock(timeout) } -> std::same_as<std::error_code>;
+};
+
+/// Adapter, which exposes OSAL lockable primitive via the BasicLockable and Lockable named requirements of the
+/// standard library. This allows using OSAL primitives with std::lock(), std::scoped_lock, std::unique_lock or
+/// std::condition_variable_any.
+/// @tparam T           Type of the adapted OSAL primitive.
+/// @note Standard interface has no way of reporting errors from lock() and unlock(). OSAL build does not use
+///       exceptions, so errors from these calls are silently dropped.
+template <Lockable T>
+class LockableAdapter {
+public:
+    /// Constructor.
+    /// @param lockable     OSAL primitive, for which all the operations should be performed.
+    explicit LockableAdapter(T& lockable)
+        : m_lockable(lockable)
+    {}
+
+    /// Locks the underlying primitive.
+    void lock() { m_lockable.lock(); }
+
+    /// Tries to lock the underlying primitive without blocking.
+    /// @return Flag indicating if the primitive has been locked.
+    bool try_lock() { return !m_lockable.tryLock(); } // NOLINT(readability-identifier-naming)
+
+    /// Unlocks the underlying primitive.
+    void unlock() { m_lockable.unlock(); }
+
+    /// Returns reference to the adapted OSAL primitive.
+    /// @return Reference to the adapted OSAL primitive.
+    T& native() { return m_lockable; }
+
+protected:
+    T& m_lockable;
+};
+
+/// Adapter, which exposes OSAL timed lockable primitive via the TimedLockable named requirement of the standard
+/// library. This allows using OSAL primitives with std::unique_lock::try_lock_for() and similar APIs.
+/// @tparam T           Type of the adapted OSAL primitive.
+template <TimedLockable T>
+class TimedLockableAdapter : public LockableAdapter<T> {
+public:
+    using LockableAdapter<T>::LockableAdapter;
+
+    /// Tries to lock the underlying primitive, blocking for at most the specified duration.
+    /// @tparam Representation      Arithmetic type representing the number of ticks.
+    /// @tparam Period              A std::ratio type representing the tick period.
+    /// @param duration             Maximal duration of the wait.
+    /// @return Flag indicating if the primitive has been locked.
+    /// @note Duration is rounded up to the resolution of the osal::Duration.
+    template <typename Representation, typename Period>
+    bool try_lock_for(const std::chrono::duration<Representation, Period>& duration) // NOLINT(readability-identifier-naming)
+    {
+        if (duration <= duration.zero())
+            return this->try_lock();
+
+        return !this->m_lockable.timedLock(std::chrono::ceil<Duration>(duration));
+    }
+
+    /// Tries to lock the underlying primitive, blocking until the specified time point at most.
+    /// @tparam ClockType           Clock of the given time point.
+    /// @tparam DurationType        Duration type of the given time point.
+    /// @param timePoint            Time point, after which the wait should be abandoned.
+    /// @return Flag indicating if the primitive has been locked.
+    template <typename ClockType, typename DurationType>
+    bool try_lock_until(const std::chrono::time_point<ClockType, DurationType>& timePoint) // NOLINT(readability-identifier-naming)
+    {
+        return try_lock_for(timePoint - ClockType::now());
+    }
+};
+
+/// Deduction guide for LockableAdapter.
+template <typename T>
+LockableAdapter(T&) -> LockableAdapter<T>;
+
+/// Deduction guide for TimedLockableAdapter.
+template <typename T>
+TimedLockableAdapter(T&) -> TimedLockableAdapter<T>;
+
+} // namespace osal
@@ -36,7 +36,11 @@
 #include "osal/Mutex.h"
 #include "osal/Timeout.hpp"
 
+#include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <system_error>
+#include <vector>
 
 namespace osal {
 
@@ -47,6 +51,10 @@ public:
     /// @param type         Mutex type.
     explicit Mutex(OsalMutexType type = cOsalMutexDefaultType);
 
+    /// Constructor. Creates new mutex with the given configuration.
+    /// @param config       Mutex configuration (type, priority protocol and ceiling).
+    explicit Mutex(OsalMutexConfig config);
+
     /// Copy constructor.
     /// @note This constructor is deleted, because Mutex is not meant to be copy-constructed.
     Mutex(const Mutex&) = delete;
@@ -72,13 +80,26 @@ public:
     /// is released. If mutex is recursive, then it can be locked multiple times by the same thread.
     /// @return Error code of the operation.
     /// @note If mutex is non-recursive, then calling this function twice by the same thread will result in a deadlock.
-    std::error_code lock();
+    /// @note Uncontended lock of the non-recursive mutex is done inline without calling the C API.
+    std::error_code lock()
+    {
+        if (isFastPathEnabled() && osalMutexImplFastLock(&m_mutex.impl))
+            return OsalError::eOk;
+
+        return osalMutexLock(&m_mutex);
+    }
 
     /// Locks the given mutex. If it is currently locked any thread, then it returns immediately with a proper error.
     /// @return Error code of the operation.
     /// @note If mutex is non-recursive, then calling this function twice by the same thread will not result in a
     /// deadlock.
-    std::error_code tryLock();
+    std::error_code tryLock()
+    {
+        if (isFastPathEnabled() && osalMutexImplFastLock(&m_mutex.impl))
+            return OsalError::eOk;
+
+        return osalMutexTryLock(&m_mutex);
+    }
 
     /// Locks the given mutex. If it is currently locked any thread, then it returns immediately with a proper error.
     /// @return Error code of the operation.
@@ -95,7 +116,14 @@ public:
     /// Unlocks the given mutex.
     /// @return Error code of the operation.
     /// @note Unlocking mutex that was already locked by another thread invokes undefined behavior.
-    std::error_code unlock();
+    /// @note Uncontended unlock of the non-recursive mutex is done inline without calling the C API.
+    std::error_code unlock()
+    {
+        if (isFastPathEnabled() && osalMutexImplFastUnlock(&m_mutex.impl))
+            return OsalError::eOk;
+
+        return osalMutexUnlock(&m_mutex);
+    }
 
     /// Unlocks the given mutex.
     /// @return Error code of the operation.
@@ -103,8 +131,52 @@ public:
     /// @note Unlocking mutex that was already locked by another thread invokes undefined behavior.
     std::error_code unlockIsr();
 
+    /// Sets the maximal number of spin iterations, which adaptive mutex performs under contention before parking
+    /// the calling thread in the kernel.
+    /// @param spinBudget   Maximal number of spin iterations. Value 0 disables spinning.
+    /// @return Error code of the operation.
+    /// @note This function can be called only for OsalMutexType::eAdaptive mutexes.
+    std::error_code setSpinBudget(std::uint32_t spinBudget);
+
+    /// Enables statistics mode of the given mutex and registers it in the process-wide registry of profiled mutexes.
+    /// @param name         Name of the mutex used in the statistics reports. It has to remain valid until statistics
+    ///                     are disabled or mutex is destroyed.
+    /// @return Error code of the operation.
+    /// @note This function should be called only when mutex is unlocked.
+    /// @note Mutex with enabled statistics doesn't use the inline fast path.
+    std::error_code enableStats(const char* name);
+
+    /// Disables statistics mode of the given mutex and removes it from the registry of profiled mutexes.
+    /// @return Error code of the operation.
+    /// @note This function should be called only when mutex is unlocked.
+    std::error_code disableStats();
+
+    /// Returns the snapshot of the statistics of the given mutex.
+    /// @param snapshot     Output argument where the statistics will be stored.
+    /// @return Error code of the operation.
+    std::error_code stats(OsalMutexStats& snapshot);
+
+    /// Resets all statistics of the given mutex to zero.
+    /// @return Error code of the operation.
+    std::error_code resetStats();
+
+private:
+    /// Checks if lock/unlock operations can use the inline uncontended fast path.
+    /// @return Flag indicating if lock/unlock operations can use the inline uncontended fast path.
+    [[nodiscard]] bool isFastPathEnabled() const
+    {
+        return m_mutex.initialized && m_mutex.type != OsalMutexType::eRecursive
+            && m_mutex.protocol == OsalMutexProtocol::eNoPriorityProtocol && m_mutex.stats == nullptr;
+    }
+
 private:
     OsalMutex m_mutex{};
+    std::unique_ptr<OsalMutexStats> m_stats;
 };
 
+/// Returns the snapshots of the statistics of the most contended mutexes from the registry of profiled mutexes.
+/// @param count            Maximal number of the returned snapshots.
+/// @return Snapshots of the statistics in the order of descending contention.
+std::vector<OsalMutexStats> topContendedMutexes(std::size_t count);
+
 } // namespace osal
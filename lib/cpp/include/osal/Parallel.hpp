@@ -0,0 +1,242 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "osal/Thread.hpp"
+#include "osal/WorkStealingExecutor.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace osal {
+
+/// Grain size value, which makes parallel algorithms select it automatically.
+inline constexpr std::size_t cAutoGrain = 0;
+
+namespace detail {
+
+/// Number of chunks per worker created when grain size is selected automatically. More than one chunk per worker
+/// leaves room for stealing when iterations have uneven cost.
+inline constexpr std::size_t cChunksPerWorker = 8;
+
+/// Returns grain size to be used for the given range.
+/// @param size                 Number of elements in the range.
+/// @param grain                Grain size requested by the user or cAutoGrain.
+/// @param workers              Number of workers in the executor.
+/// @return Grain size to be used for the given range.
+inline std::size_t selectGrain(std::size_t size, std::size_t grain, std::size_t workers)
+{
+    if (grain != cAutoGrain)
+        return grain;
+
+    return std::max<std::size_t>(size / (workers * cChunksPerWorker), 1);
+}
+
+/// Checks if parallel algorithm should be executed serially by the caller.
+/// @param size                 Number of elements in the range.
+/// @param grain                Grain size to be used for the range.
+/// @param workers              Number of workers in the executor.
+/// @return Flag indicating if parallel algorithm should be executed serially by the caller.
+inline bool runSerially(std::size_t size, std::size_t grain, std::size_t workers)
+{
+    return size <= grain || workers == 1 || thread::cpuCount() == 1;
+}
+
+/// Represents state shared by all chunks of the single parallelFor() call.
+template <typename Executor, typename Function>
+struct ParallelForContext {
+    Executor& executor;
+    TaskGroup& group;
+    Function& function;
+    std::size_t grain;
+};
+
+/// Executes the given range of parallelFor() by splitting it in halves and submitting them to the executor until
+/// they are not bigger than the grain size.
+/// @tparam Context             Type of the shared state.
+/// @tparam Index               Type of the range index.
+/// @param context              State shared by all chunks.
+/// @param first                First index of the range.
+/// @param last                 Index one past the last index of the range.
+template <typename Context, std::integral Index>
+void parallelForRange(Context& context, Index first, Index last)
+{
+    while (static_cast<std::size_t>(last - first) > context.grain) {
+        auto middle = static_cast<Index>(first + (last - first) / 2);
+        if (context.executor.submit(context.group, [&context, middle, last] {
+                parallelForRange(context, middle, last);
+            })) {
+            // Executor is not running, so the right half has to be executed by the caller.
+            parallelForRange(context, middle, last);
+        }
+
+        last = middle;
+    }
+
+    for (auto i = first; i < last; ++i)
+        std::invoke(context.function, i);
+}
+
+/// Represents state shared by all chunks of the single parallelReduce() call.
+template <typename Executor, typename T, typename Transform, typename Reduce>
+struct ParallelReduceContext {
+    using ValueType = T;
+
+    Executor& executor;
+    const T& identity;
+    Transform& transform;
+    Reduce& reduce;
+    std::size_t grain;
+};
+
+/// Reduces the given range of parallelReduce() by splitting it in halves and submitting them to the executor until
+/// they are not bigger than the grain size.
+/// @tparam Context             Type of the shared state.
+/// @tparam Index               Type of the range index.
+/// @param context              State shared by all chunks.
+/// @param first                First index of the range.
+/// @param last                 Index one past the last index of the range.
+/// @return Result of the reduction of the given range.
+template <typename Context, std::integral Index>
+typename Context::ValueType parallelReduceRange(Context& context, Index first, Index last)
+{
+    if (static_cast<std::size_t>(last - first) <= context.grain) {
+        auto result = context.identity;
+        for (auto i = first; i < last; ++i)
+            result = std::invoke(context.reduce, std::move(result), std::invoke(context.transform, i));
+
+        return result;
+    }
+
+    auto middle = static_cast<Index>(first + (last - first) / 2);
+    auto right = context.identity;
+    TaskGroup group;
+    auto error = context.executor.submit(group, [&context, &right, middle, last] {
+        right = parallelReduceRange(context, middle, last);
+    });
+
+    auto left = parallelReduceRange(context, first, middle);
+    if (error)
+        right = parallelReduceRange(context, middle, last);
+    else
+        context.executor.wait(group);
+
+    return std::invoke(context.reduce, std::move(left), std::move(right));
+}
+
+} // namespace detail
+
+/// Invokes the given function for each index from the given range using workers of the given executor.
+/// @tparam Executor            Type of the executor.
+/// @tparam Index               Type of the range index.
+/// @tparam Function            Type of the function to be invoked.
+/// @param executor             Executor, which workers should be used.
+/// @param first                First index of the range.
+/// @param last                 Index one past the last index of the range.
+/// @param grain                Maximal number of indexes processed serially as a single task or cAutoGrain.
+/// @param function             Function to be invoked with each index.
+/// @note This function returns once the function has been invoked for all indexes. Order of invocations is not
+///       specified.
+/// @note If executor has only one worker, there is only one CPU available or executor is not running, then the
+///       whole range is processed serially by the caller.
+template <typename Executor, std::integral Index, typename Function>
+    requires std::invocable<Function&, Index>
+void parallelFor(Executor& executor, Index first, Index last, std::size_t grain, Function&& function)
+{
+    if (last <= first)
+        return;
+
+    auto size = static_cast<std::size_t>(last - first);
+    grain = detail::selectGrain(size, grain, Executor::workersCount());
+    if (detail::runSerially(size, grain, Executor::workersCount())) {
+        for (auto i = first; i < last; ++i)
+            std::invoke(function, i);
+
+        return;
+    }
+
+    TaskGroup group;
+    detail::ParallelForContext<Executor, std::remove_reference_t<Function>> context{executor, group, function, grain};
+    detail::parallelForRange(context, first, last);
+    executor.wait(group);
+}
+
+/// Reduces the given range using workers of the given executor.
+/// @tparam Executor            Type of the executor.
+/// @tparam Index               Type of the range index.
+/// @tparam T                   Type of the result.
+/// @tparam Transform           Type of the function converting index into the value.
+/// @tparam Reduce              Type of the function combining two values.
+/// @param executor             Executor, which workers should be used.
+/// @param first                First index of the range.
+/// @param last                 Index one past the last index of the range.
+/// @param grain                Maximal number of indexes processed serially as a single task or cAutoGrain.
+/// @param identity             Identity element of the reduction.
+/// @param transform            Function converting index into the value.
+/// @param reduce               Function combining two values. It has to be associative.
+/// @return Result of the reduction.
+/// @note Values are always combined in the order of the indexes, so reduce doesn't have to be commutative.
+/// @note If executor has only one worker, there is only one CPU available or executor is not running, then the
+///       whole range is processed serially by the caller.
+template <typename Executor, std::integral Index, typename T, typename Transform, typename Reduce>
+    requires std::invocable<Transform&, Index>
+          && std::invocable<Reduce&, T, std::invoke_result_t<Transform&, Index>>
+          && std::invocable<Reduce&, T, T>
+T parallelReduce(Executor& executor,
+                 Index first,
+                 Index last,
+                 std::size_t grain,
+                 T identity,
+                 Transform&& transform,
+                 Reduce&& reduce)
+{
+    if (last <= first)
+        return identity;
+
+    auto size = static_cast<std::size_t>(last - first);
+    grain = detail::selectGrain(size, grain, Executor::workersCount());
+    if (detail::runSerially(size, grain, Executor::workersCount()))
+        grain = size;
+
+    using TransformType = std::remove_reference_t<Transform>;
+    using ReduceType = std::remove_reference_t<Reduce>;
+    detail::ParallelReduceContext<Executor, T, TransformType, ReduceType> context{
+        executor, identity, transform, reduce, grain};
+    return detail::parallelReduceRange(context, first, last);
+}
+
+} // namespace osal
@@ -33,27 +33,49 @@
 #pragma once
 
 #include "osal/Error.hpp"
+#include "osal/Lockable.hpp"
 #include "osal/Mutex.hpp"
+#include "osal/Thread.h"
 #include "osal/Timeout.hpp"
 
+#include <cstddef>
 #include <system_error>
+#include <tuple>
+#include <utility>
 
 namespace osal {
 
-/// Helper RAII type to perform automatic lock/unlock on the specified mutex.
+/// Helper RAII type to perform automatic lock/unlock on the specified mutexes.
+/// When more than one mutex is given, all of them are acquired with the try-and-back-off algorithm: the calling
+/// thread blocks on one mutex and only tries to lock the remaining ones. If any of them is busy, then all already
+/// acquired mutexes are released and the next round starts by blocking on the busy one. This way no lock ordering has
+/// to be respected by the callers and deadlock is not possible.
+/// @tparam Mutexes     Types of the locked primitives (e.g. Mutex, SharedMutex or SpinLock).
 /// @note Objects of this class should not be shared across threads.
+template <Lockable... Mutexes>
 class ScopedLock {
+    static_assert(sizeof...(Mutexes) > 0, "ScopedLock requires at least one mutex");
+
 public:
     /// Constructor.
-    /// @param mutex        Mutex for which all the operations should be performed
-    /// @note This constructor automatically locks the underlying mutex.
-    explicit ScopedLock(Mutex& mutex);
+    /// @param mutexes      Mutexes for which all the operations should be performed.
+    /// @note This constructor automatically locks all the underlying mutexes.
+    explicit ScopedLock(Mutexes&... mutexes)
+        : m_mutexes(mutexes...)
+    {
+        m_locked = acquire([this](std::size_t index) { return lockAt(index); });
+    }
 
     /// Constructor.
-    /// @param mutex        Mutex for which all the operations should be performed
-    /// @param timeout      Timeout to wait for the operation.
-    /// @note This constructor automatically locks the underlying mutex.
-    ScopedLock(Mutex& mutex, Timeout timeout);
+    /// @param mutexes      Mutexes for which all the operations should be performed.
+    /// @param timeout      Timeout to wait for the operation. It limits acquisition of all the mutexes together.
+    /// @note This constructor automatically locks all the underlying mutexes.
+    ScopedLock(Mutexes&... mutexes, Timeout timeout)
+        requires(TimedLockable<Mutexes> && ...)
+        : m_mutexes(mutexes...)
+    {
+        m_locked = acquire([this, &timeout](std::size_t index) { return timedLockAt(index, timeout); });
+    }
 
     /// Copy constructor.
     /// @note This constructor is deleted, because ScopedLock is not meant to be copy-constructed.
@@ -64,8 +86,15 @@ public:
     ScopedLock(ScopedLock&& other) noexcept = delete;
 
     /// Destructor.
-    /// @note Destructor automatically unlocks the underlying mutex.
-    ~ScopedLock();
+    /// @note Destructor automatically unlocks all the underlying mutexes.
+    ~ScopedLock()
+    {
+        if (!m_locked)
+            return;
+
+        for (std::size_t i = cCount; i > 0; --i)
+            unlockAt(i - 1);
+    }
 
     /// Copy assignment operator.
     /// @note This operator is deleted, because ScopedLock is not meant to be copy-assigned.
@@ -75,40 +104,104 @@ public:
     /// @note This operator is deleted, because ScopedLock is not meant to be move-assigned.
     ScopedLock& operator=(ScopedLock&&) = delete;
 
-    /// Returns flag indicating if the underlying mutex is locked.
-    /// @return Flag indicating if the underlying mutex is locked.
-    /// @retval true        Underlying mutex is locked.
-    /// @retval false       Underlying mutex is not locked.
+    /// Returns flag indicating if the underlying mutexes are locked.
+    /// @return Flag indicating if the underlying mutexes are locked.
+    /// @retval true        All underlying mutexes are locked.
+    /// @retval false       None of the underlying mutexes is locked.
     operator bool() const { return isAcquired(); } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
 
-    /// Returns flag indicating if the underlying mutex is locked.
-    /// @return Flag indicating if the underlying mutex is locked.
-    /// @retval true        Underlying mutex is locked.
-    /// @retval false       Underlying mutex is not locked.
+    /// Returns flag indicating if the underlying mutexes are locked.
+    /// @return Flag indicating if the underlying mutexes are locked.
+    /// @retval true        All underlying mutexes are locked.
+    /// @retval false       None of the underlying mutexes is locked.
     [[nodiscard]] bool isAcquired() const { return m_locked; }
 
 private:
-    /// Locks the underlying mutex. If it is currently locked any thread, then the calling thread will block until mutex
-    /// is released. If mutex is recursive, then it can be locked multiple times by the same thread.
-    /// @return Error code of the operation.
-    /// @note If mutex is non-recursive, then calling this function twice by the same thread will result in a deadlock.
-    std::error_code lock();
-
-    /// Locks the underlying mutex. If it is currently locked any thread, then the calling thread will block until mutex
-    /// is released or the specified time elapses. If mutex is recursive, then it can be locked multiple times by the
-    /// same thread.
-    /// @param timeout      Timeout to wait for the operation.
-    /// @return Error code of the operation.
-    std::error_code timedLock(Timeout timeout);
-
-    /// Unlocks the given mutex.
-    /// @return Error code of the operation.
-    /// @note Unlocking mutex that was already locked by another thread invokes undefined behavior.
-    std::error_code unlock();
+    /// Acquires all the underlying mutexes with the try-and-back-off algorithm.
+    /// @param blockingLock Function performing blocking (or timed) lock of the mutex with the given index.
+    /// @return Flag indicating if all the mutexes have been acquired.
+    template <typename BlockingLock>
+    bool acquire(BlockingLock blockingLock)
+    {
+        std::size_t first = 0;
+        while (true) {
+            if (blockingLock(first))
+                return false;
+
+            std::size_t busy = cCount;
+            for (std::size_t i = 1; i < cCount; ++i) {
+                auto index = (first + i) % cCount;
+                if (!tryLockAt(index))
+                    continue;
+
+                for (std::size_t j = i; j > 0; --j)
+                    unlockAt((first + j - 1) % cCount);
+
+                busy = index;
+                break;
+            }
+
+            if (busy == cCount)
+                return true;
+
+            first = busy;
+            osalThreadYield();
+        }
+    }
+
+    /// Invokes the given function on the mutex with the specified index.
+    /// @param index        Index of the mutex.
+    /// @param func         Function to be invoked.
+    /// @return Error code returned by the function.
+    template <typename Func>
+    std::error_code visitAt(std::size_t index, Func&& func)
+    {
+        std::error_code error;
+        [&]<std::size_t... cIndexes>(std::index_sequence<cIndexes...>) {
+            ((index == cIndexes ? (error = func(std::get<cIndexes>(m_mutexes)), true) : false) || ...);
+        }(std::index_sequence_for<Mutexes...>{});
+
+        return error;
+    }
+
+    std::error_code lockAt(std::size_t index)
+    {
+        return visitAt(index, [](auto& mutex) { return mutex.lock(); });
+    }
+
+    std::error_code tryLockAt(std::size_t index)
+    {
+        return visitAt(index, [](auto& mutex) { return mutex.tryLock(); });
+    }
+
+    std::error_code timedLockAt(std::size_t index, const Timeout& timeout)
+    {
+        return visitAt(index, [&timeout](auto& mutex) { return mutex.timedLock(timeout); });
+    }
+
+    std::error_code unlockAt(std::size_t index)
+    {
+        return visitAt(index, [](auto& mutex) { return mutex.unlock(); });
+    }
 
 private:
-    Mutex& m_mutex;
+    static constexpr std::size_t cCount = sizeof...(Mutexes);
+    std::tuple<Mutexes&...> m_mutexes;
     bool m_locked{};
 };
 
+/// Deduction guides for the timed variant of ScopedLock. Parameter pack followed by another parameter cannot be
+/// deduced, so the supported numbers of mutexes are listed explicitly.
+template <typename Mutex1>
+ScopedLock(Mutex1&, Timeout) -> ScopedLock<Mutex1>;
+
+template <typename Mutex1, typename Mutex2>
+ScopedLock(Mutex1&, Mutex2&, Timeout) -> ScopedLock<Mutex1, Mutex2>;
+
+template <typename Mutex1, typename Mutex2, typename Mutex3>
+ScopedLock(Mutex1&, Mutex2&, Mutex3&, Timeout) -> ScopedLock<Mutex1, Mutex2, Mutex3>;
+
+template <typename Mutex1, typename Mutex2, typename Mutex3, typename Mutex4>
+ScopedLock(Mutex1&, Mutex2&, Mutex3&, Mutex4&, Timeout) -> ScopedLock<Mutex1, Mutex2, Mutex3, Mutex4>;
+
 } // namespace osal
@@ -0,0 +1,95 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "osal/Error.hpp"
+#include "osal/SharedMutex.hpp"
+#include "osal/Timeout.hpp"
+
+#include <system_error>
+
+namespace osal {
+
+/// Helper RAII type to perform automatic shared lock/unlock on the specified reader-writer lock.
+/// @note Objects of this class should not be shared across threads.
+class ScopedSharedLock {
+public:
+    /// Constructor.
+    /// @param mutex        Reader-writer lock for which all the operations should be performed.
+    /// @note This constructor automatically locks the underlying reader-writer lock for reading.
+    explicit ScopedSharedLock(SharedMutex& mutex);
+
+    /// Constructor.
+    /// @param mutex        Reader-writer lock for which all the operations should be performed.
+    /// @param timeout      Timeout to wait for the operation.
+    /// @note This constructor automatically locks the underlying reader-writer lock for reading.
+    ScopedSharedLock(SharedMutex& mutex, Timeout timeout);
+
+    /// Copy constructor.
+    /// @note This constructor is deleted, because ScopedSharedLock is not meant to be copy-constructed.
+    ScopedSharedLock(const ScopedSharedLock&) = delete;
+
+    /// Move constructor.
+    /// @note This constructor is deleted, because ScopedSharedLock is not meant to be move-constructed.
+    ScopedSharedLock(ScopedSharedLock&& other) noexcept = delete;
+
+    /// Destructor.
+    /// @note Destructor automatically unlocks the underlying reader-writer lock.
+    ~ScopedSharedLock();
+
+    /// Copy assignment operator.
+    /// @note This operator is deleted, because ScopedSharedLock is not meant to be copy-assigned.
+    ScopedSharedLock& operator=(const ScopedSharedLock&) = delete;
+
+    /// Move assignment operator.
+    /// @note This operator is deleted, because ScopedSharedLock is not meant to be move-assigned.
+    ScopedSharedLock& operator=(ScopedSharedLock&&) = delete;
+
+    /// Returns flag indicating if the underlying reader-writer lock is locked for reading.
+    /// @return Flag indicating if the underlying reader-writer lock is locked for reading.
+    /// @retval true        Underlying reader-writer lock is locked for reading.
+    /// @retval false       Underlying reader-writer lock is not locked for reading.
+    operator bool() const { return isAcquired(); } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+
+    /// Returns flag indicating if the underlying reader-writer lock is locked for reading.
+    /// @return Flag indicating if the underlying reader-writer lock is locked for reading.
+    /// @retval true        Underlying reader-writer lock is locked for reading.
+    /// @retval false       Underlying reader-writer lock is not locked for reading.
+    [[nodiscard]] bool isAcquired() const { return m_locked; }
+
+private:
+    SharedMutex& m_mutex;
+    bool m_locked{};
+};
+
+} // namespace osal
@@ -0,0 +1,88 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "osal/Error.hpp"
+#include "osal/SpinLock.hpp"
+
+#include <system_error>
+
+namespace osal {
+
+/// Helper RAII type to perform automatic lock/unlock on the specified spinlock.
+/// @note Objects of this class should not be shared across threads.
+class ScopedSpinLock {
+public:
+    /// Constructor.
+    /// @param spinLock     Spinlock for which all the operations should be performed.
+    /// @note This constructor automatically locks the underlying spinlock.
+    explicit ScopedSpinLock(SpinLock& spinLock);
+
+    /// Copy constructor.
+    /// @note This constructor is deleted, because ScopedSpinLock is not meant to be copy-constructed.
+    ScopedSpinLock(const ScopedSpinLock&) = delete;
+
+    /// Move constructor.
+    /// @note This constructor is deleted, because ScopedSpinLock is not meant to be move-constructed.
+    ScopedSpinLock(ScopedSpinLock&& other) noexcept = delete;
+
+    /// Destructor.
+    /// @note Destructor automatically unlocks the underlying spinlock.
+    ~ScopedSpinLock();
+
+    /// Copy assignment operator.
+    /// @note This operator is deleted, because ScopedSpinLock is not meant to be copy-assigned.
+    ScopedSpinLock& operator=(const ScopedSpinLock&) = delete;
+
+    /// Move assignment operator.
+    /// @note This operator is deleted, because ScopedSpinLock is not meant to be move-assigned.
+    ScopedSpinLock& operator=(ScopedSpinLock&&) = delete;
+
+    /// Returns flag indicating if the underlying spinlock is locked.
+    /// @return Flag indicating if the underlying spinlock is locked.
+    /// @retval true        Underlying spinlock is locked.
+    /// @retval false       Underlying spinlock is not locked.
+    operator bool() const { return isAcquired(); } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+
+    /// Returns flag indicating if the underlying spinlock is locked.
+    /// @return Flag indicating if the underlying spinlock is locked.
+    /// @retval true        Underlying spinlock is locked.
+    /// @retval false       Underlying spinlock is not locked.
+    [[nodiscard]] bool isAcquired() const { return m_locked; }
+
+private:
+    SpinLock& m_spinLock;
+    bool m_locked{};
+};
+
+} // namespace osal
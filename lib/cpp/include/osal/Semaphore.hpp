@@ -47,6 +47,11 @@ public:
     /// @param initialValue     Initial value of the semaphore to be created.
     explicit Semaphore(unsigned int initialValue);
 
+    /// Constructor. Creates new semaphore with the given type.
+    /// @param initialValue     Initial value of the semaphore to be created.
+    /// @param type             Type of the semaphore to be created.
+    Semaphore(unsigned int initialValue, OsalSemaphoreType type);
+
     /// Copy constructor.
     /// @note This constructor is deleted, because Semaphore is not meant to be copy-constructed.
     Semaphore(const Semaphore&) = delete;
@@ -73,11 +78,25 @@ public:
     /// @return Error code of the operation.
     std::error_code wait();
 
+    /// Decrements value of the given semaphore by the given number of tokens. If its value is currently lower than
+    /// that, then the calling thread will block until enough tokens are available. Tokens are taken all at once.
+    /// @param count            Number of tokens to be taken.
+    /// @return Error code of the operation.
+    /// @note For ePollable semaphores count has to be 1.
+    std::error_code wait(unsigned int count);
+
     /// Decrements value of the given semaphore. If its value is currently 0, then it returns immediately
     /// with a proper error.
     /// @return Error code of the operation.
     std::error_code tryWait();
 
+    /// Decrements value of the given semaphore by the given number of tokens. If its value is currently lower than
+    /// that, then it returns immediately with a proper error.
+    /// @param count            Number of tokens to be taken.
+    /// @return Error code of the operation.
+    /// @note For ePollable semaphores count has to be 1.
+    std::error_code tryWait(unsigned int count);
+
     /// Decrements value of the given semaphore. If its value is currently 0, then it returns immediately
     /// with a proper error.
     /// @return Error code of the operation.
@@ -90,17 +109,43 @@ public:
     /// @return Error code of the operation.
     std::error_code timedWait(Timeout timeout);
 
+    /// Decrements value of the given semaphore by the given number of tokens. If its value is currently lower than
+    /// that, then the calling thread will block until enough tokens are available or the specified time elapses.
+    /// @param count            Number of tokens to be taken.
+    /// @param timeout          Maximal time to wait for the operation.
+    /// @return Error code of the operation.
+    /// @note For ePollable semaphores count has to be 1.
+    std::error_code timedWait(unsigned int count, Timeout timeout);
+
     /// Increments value of the given semaphore.
     /// @return Error code of the operation.
-    /// @note There is no upper bound of the semaphore value.
+    /// @note On Linux value of the eStandard semaphore is limited to 2^30 - 1. If it would be exceeded, then the value
+    ///       is not changed and OsalError::eOsError is returned.
     std::error_code signal();
 
+    /// Increments value of the given semaphore by the given number of tokens.
+    /// @param count            Number of tokens to be released.
+    /// @return Error code of the operation.
+    /// @note On Linux value of the eStandard semaphore is limited to 2^30 - 1. If it would be exceeded, then the value
+    ///       is not changed and OsalError::eOsError is returned.
+    /// @note On Linux single-token waiters are woken up first, at most one per released token. Waiters for many tokens
+    ///       are woken up only if some of the released tokens are left for them and then all of them compete for them.
+    std::error_code signal(unsigned int count);
+
     /// Increments value of the given semaphore.
     /// @return Error code of the operation.
     /// @note This function will never block and is supposed to be called from ISR.
-    /// @note There is no upper bound of the semaphore value.
+    /// @note On Linux value of the eStandard semaphore is limited to 2^30 - 1. If it would be exceeded, then the value
+    ///       is not changed and OsalError::eOsError is returned.
     std::error_code signalIsr();
 
+    /// Returns native handle of the ePollable semaphore (file descriptor on Linux), which can be waited on together
+    /// with other platform objects.
+    /// @param handle           Output argument where the native handle will be stored.
+    /// @return Error code of the operation.
+    /// @note Handle should be used only to wait for readiness. Tokens have to be taken with tryWait().
+    std::error_code nativeHandle(int& handle);
+
 private:
     OsalSemaphore m_semaphore{};
 };
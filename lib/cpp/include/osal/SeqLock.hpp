@@ -0,0 +1,203 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "osal/Error.hpp"
+#include "osal/Mutex.hpp"
+#include "osal/ScopedLock.hpp"
+#include "osal/Thread.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <system_error>
+#include <type_traits>
+
+namespace osal {
+
+/// Represents sequence lock protecting the value of the given type. It is meant for the small values, which are
+/// written rarely and read very often from many threads.
+/// @tparam T               Type of the protected value. It has to be trivially copyable.
+/// @note Writers are serialized with osal::Mutex and increment the sequence counter before and after modifying
+///       the value. Readers never lock anything: they copy the value and retry if the sequence counter was odd
+///       or has changed during the copy. Thus readers never block writers, but can be delayed by the constant
+///       stream of writes.
+template <typename T>
+class SeqLock {
+    static_assert(std::is_trivially_copyable_v<T>, "SeqLock can protect only trivially copyable types");
+
+public:
+    /// Constructor. Initializes protected value with the value-initialized object of type T.
+    SeqLock()
+        : SeqLock(T{})
+    {}
+
+    /// Constructor.
+    /// @param value            Initial value of the protected object.
+    explicit SeqLock(const T& value) { write(value); }
+
+    /// Copy constructor.
+    /// @note This constructor is deleted, because SeqLock is not meant to be copy-constructed.
+    SeqLock(const SeqLock&) = delete;
+
+    /// Move constructor.
+    /// @note This constructor is deleted, because SeqLock is not meant to be move-constructed.
+    SeqLock(SeqLock&&) = delete;
+
+    /// Destructor.
+    ~SeqLock() = default;
+
+    /// Copy assignment operator.
+    /// @note This operator is deleted, because SeqLock is not meant to be copy-assigned.
+    SeqLock& operator=(const SeqLock&) = delete;
+
+    /// Move assignment operator.
+    /// @note This operator is deleted, because SeqLock is not meant to be move-assigned.
+    SeqLock& operator=(SeqLock&&) = delete;
+
+    /// Returns the consistent copy of the protected value. If writer modifies the value during the copy, then
+    /// the copy is retried.
+    /// @return Consistent copy of the protected value.
+    [[nodiscard]] T load() const
+    {
+        T value;
+        for (std::uint32_t attempts = 1; !tryLoad(value); ++attempts) {
+            // Give the CPU to the writer, which could have been preempted in the middle of the update.
+            if (attempts % cAttemptsBeforeYield == 0)
+                osalThreadYield();
+        }
+
+        return value;
+    }
+
+    /// Tries to copy the protected value once.
+    /// @param value            Output argument where the copy of the protected value will be stored.
+    /// @return Flag indicating if the copy is consistent. If not, then the value of the output argument is
+    ///         unspecified.
+    bool tryLoad(T& value) const
+    {
+        auto sequence = m_sequence.load(std::memory_order_acquire);
+        if ((sequence & 1U) != 0)
+            return false;
+
+        Storage copy;
+        for (std::size_t i = 0; i < cWords; ++i)
+            copy[i] = std::atomic_ref(m_storage[i]).load(std::memory_order_relaxed);
+
+        // Fence orders data loads above before the sequence load below (see H. Boehm, "Can Seqlocks Get Along
+        // With Programming Language Memory Models?").
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (m_sequence.load(std::memory_order_relaxed) != sequence)
+            return false;
+
+        std::memcpy(&value, copy.data(), sizeof(T));
+        return true;
+    }
+
+    /// Replaces the protected value with the given one.
+    /// @param value            New value of the protected object.
+    /// @return Error code of the operation.
+    std::error_code store(const T& value)
+    {
+        ScopedLock lock(m_writerMutex);
+        if (!lock)
+            return OsalError::eLocked;
+
+        write(value);
+        return OsalError::eOk;
+    }
+
+    /// Modifies the protected value with the given function. Other writers are blocked during the whole update.
+    /// @tparam Func            Type of the function to be called.
+    /// @param func             Function called with the reference to the copy of the current value. Modified copy
+    ///                         becomes the new protected value.
+    /// @return Error code of the operation.
+    template <typename Func>
+    std::error_code update(Func&& func)
+    {
+        ScopedLock lock(m_writerMutex);
+        if (!lock)
+            return OsalError::eLocked;
+
+        // Only writers modify the value and they are serialized, so the copy is always consistent here.
+        T value;
+        std::memcpy(&value, m_storage.data(), sizeof(T));
+        func(value);
+        write(value);
+        return OsalError::eOk;
+    }
+
+    /// Returns the current value of the sequence counter. It is incremented twice by each write.
+    /// @return Current value of the sequence counter.
+    [[nodiscard]] std::uint32_t sequence() const { return m_sequence.load(std::memory_order_acquire); }
+
+private:
+    /// Writes the given value into the storage.
+    /// @param value            New value of the protected object.
+    /// @note This function has to be called with writer mutex locked or from the constructor.
+    void write(const T& value)
+    {
+        Storage copy{};
+        std::memcpy(copy.data(), &value, sizeof(T));
+
+        auto sequence = m_sequence.load(std::memory_order_relaxed);
+        m_sequence.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        for (std::size_t i = 0; i < cWords; ++i)
+            std::atomic_ref(m_storage[i]).store(copy[i], std::memory_order_relaxed);
+
+        m_sequence.store(sequence + 2, std::memory_order_release);
+    }
+
+private:
+    /// Type of the words used to copy the protected value atomically.
+    using Word = std::uintptr_t;
+
+    /// Number of words needed to store the protected value.
+    static constexpr std::size_t cWords = (sizeof(T) + sizeof(Word) - 1) / sizeof(Word);
+
+    /// Type of the storage of the protected value.
+    using Storage = std::array<Word, cWords>;
+
+    /// Number of failed read attempts, after which reader yields the CPU.
+    static constexpr std::uint32_t cAttemptsBeforeYield = 64;
+
+    std::atomic<std::uint32_t> m_sequence{};
+    mutable Storage m_storage{};
+    Mutex m_writerMutex;
+};
+
+} // namespace osal
@@ -0,0 +1,115 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "osal/Error.hpp"
+#include "osal/RwLock.h"
+#include "osal/Timeout.hpp"
+
+#include <system_error>
+
+namespace osal {
+
+/// Represents OSAL reader-writer lock handle. It can be locked exclusively by one writer or shared by many readers.
+class SharedMutex {
+public:
+    /// Constructor. Creates new reader-writer lock with the given policy.
+    /// @param policy           Policy of the reader-writer lock.
+    explicit SharedMutex(OsalRwLockPolicy policy = cOsalRwLockDefaultPolicy);
+
+    /// Copy constructor.
+    /// @note This constructor is deleted, because SharedMutex is not meant to be copy-constructed.
+    SharedMutex(const SharedMutex&) = delete;
+
+    /// Move constructor.
+    /// @param other            Object to be moved from.
+    SharedMutex(SharedMutex&& other) noexcept;
+
+    /// Destructor.
+    ~SharedMutex();
+
+    /// Copy assignment operator.
+    /// @return Reference to self.
+    /// @note This operator is deleted, because SharedMutex is not meant to be copy-assigned.
+    SharedMutex& operator=(const SharedMutex&) = delete;
+
+    /// Move assignment operator.
+    /// @return Reference to self.
+    /// @note This operator is deleted, because SharedMutex is not meant to be move-assigned.
+    SharedMutex& operator=(SharedMutex&&) = delete;
+
+    /// Locks the given reader-writer lock for writing. If it is currently locked by anyone, then the calling thread
+    /// will block until the lock is released.
+    /// @return Error code of the operation.
+    std::error_code lock();
+
+    /// Locks the given reader-writer lock for writing. If it is currently locked by anyone, then it returns
+    /// immediately with a proper error.
+    /// @return Error code of the operation.
+    std::error_code tryLock();
+
+    /// Locks the given reader-writer lock for writing. If it is currently locked by anyone, then the calling thread
+    /// will block until the lock is released or the specified time elapses.
+    /// @param timeout          Maximal time to wait for the operation.
+    /// @return Error code of the operation.
+    std::error_code timedLock(Timeout timeout);
+
+    /// Unlocks the given reader-writer lock previously locked for writing.
+    /// @return Error code of the operation.
+    std::error_code unlock();
+
+    /// Locks the given reader-writer lock for reading. If it cannot be shared right now, then the calling thread
+    /// will block until the lock can be shared.
+    /// @return Error code of the operation.
+    std::error_code lockShared();
+
+    /// Locks the given reader-writer lock for reading. If it cannot be shared right now, then it returns immediately
+    /// with a proper error.
+    /// @return Error code of the operation.
+    std::error_code tryLockShared();
+
+    /// Locks the given reader-writer lock for reading. If it cannot be shared right now, then the calling thread
+    /// will block until the lock can be shared or the specified time elapses.
+    /// @param timeout          Maximal time to wait for the operation.
+    /// @return Error code of the operation.
+    std::error_code timedLockShared(Timeout timeout);
+
+    /// Unlocks the given reader-writer lock previously locked for reading.
+    /// @return Error code of the operation.
+    std::error_code unlockShared();
+
+private:
+    OsalRwLock m_rwLock{};
+};
+
+} // namespace osal
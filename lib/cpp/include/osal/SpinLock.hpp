@@ -0,0 +1,108 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "osal/Error.hpp"
+#include "osal/SpinLock.h"
+
+#include <system_error>
+
+namespace osal {
+
+/// Represents OSAL spinlock handle.
+/// @note Spinlock is meant for the critical sections lasting a few instructions. Longer critical sections should be
+///       protected with osal::Mutex.
+class SpinLock {
+public:
+    /// Constructor. Creates new spinlock with the given type.
+    /// @param type         Spinlock type.
+    explicit SpinLock(OsalSpinLockType type = cOsalSpinLockDefaultType);
+
+    /// Copy constructor.
+    /// @note This constructor is deleted, because SpinLock is not meant to be copy-constructed.
+    SpinLock(const SpinLock&) = delete;
+
+    /// Move constructor.
+    /// @param other        Object to be moved from.
+    SpinLock(SpinLock&& other) noexcept;
+
+    /// Destructor.
+    ~SpinLock();
+
+    /// Copy assignment operator.
+    /// @return Reference to self.
+    /// @note This operator is deleted, because SpinLock is not meant to be copy-assigned.
+    SpinLock& operator=(const SpinLock&) = delete;
+
+    /// Move assignment operator.
+    /// @return Reference to self.
+    /// @note This operator is deleted, because SpinLock is not meant to be move-assigned.
+    SpinLock& operator=(SpinLock&&) = delete;
+
+    /// Locks the given spinlock. If it is currently locked by any thread, then the calling thread will busy-wait
+    /// until the lock is released.
+    /// @return Error code of the operation.
+    std::error_code lock();
+
+    /// Locks the given spinlock. If it is currently locked by any thread, then it returns immediately with a proper
+    /// error.
+    /// @return Error code of the operation.
+    std::error_code tryLock();
+
+    /// Unlocks the given spinlock.
+    /// @return Error code of the operation.
+    /// @note Unlocking spinlock that was locked by another thread invokes undefined behavior.
+    std::error_code unlock();
+
+    /// Locks the given spinlock. If it is currently locked by any thread, then the calling thread will busy-wait
+    /// until the lock is released.
+    /// @return Error code of the operation.
+    /// @note This function is supposed to be called from ISR.
+    std::error_code lockIsr();
+
+    /// Locks the given spinlock. If it is currently locked by any thread, then it returns immediately with a proper
+    /// error.
+    /// @return Error code of the operation.
+    /// @note This function will never block and is supposed to be called from ISR.
+    std::error_code tryLockIsr();
+
+    /// Unlocks the given spinlock.
+    /// @return Error code of the operation.
+    /// @note This function is supposed to be called from ISR.
+    std::error_code unlockIsr();
+
+private:
+    OsalSpinLock m_spinLock{};
+};
+
+} // namespace osal
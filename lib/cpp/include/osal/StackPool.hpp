@@ -0,0 +1,94 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "osal/Error.hpp"
+#include "osal/StackPool.h"
+
+#include <cstddef>
+#include <system_error>
+
+namespace osal {
+
+/// Represents OSAL stack pool handle.
+/// @note Stack pool allocates and pre-faults all stacks upfront. It can be attached to osal::Thread, so that
+///       the thread takes its stack from the pool upon start and returns it after being joined.
+class StackPool {
+public:
+    /// Constructor. Creates new stack pool with the given configuration.
+    /// @param stackSize        Size of each stack in the pool.
+    /// @param count            Number of stacks in the pool.
+    /// @param guardPages       Flag indicating if each stack should be protected with a guard page.
+    StackPool(std::size_t stackSize, std::size_t count, bool guardPages = true);
+
+    /// Copy constructor.
+    /// @note This constructor is deleted, because StackPool is not meant to be copy-constructed.
+    StackPool(const StackPool&) = delete;
+
+    /// Move constructor.
+    /// @param other            Object to be moved from.
+    StackPool(StackPool&& other) noexcept;
+
+    /// Destructor.
+    /// @note All stacks should be released before the pool is destroyed.
+    ~StackPool();
+
+    /// Copy assignment operator.
+    /// @return Reference to self.
+    /// @note This operator is deleted, because StackPool is not meant to be copy-assigned.
+    StackPool& operator=(const StackPool&) = delete;
+
+    /// Move assignment operator.
+    /// @return Reference to self.
+    /// @note This operator is deleted, because StackPool is not meant to be move-assigned.
+    StackPool& operator=(StackPool&&) = delete;
+
+    /// Takes one free stack from the pool. This function never blocks.
+    /// @param stack            Output argument where the lowest address of the acquired stack will be stored.
+    /// @return Error code of the operation.
+    std::error_code acquire(void*& stack);
+
+    /// Returns the given stack back to the pool.
+    /// @param stack            Stack to be returned.
+    /// @return Error code of the operation.
+    std::error_code release(void* stack);
+
+    /// Returns size of each stack managed by the pool.
+    /// @return Size of each stack managed by the pool.
+    [[nodiscard]] std::size_t stackSize() const;
+
+private:
+    OsalStackPool m_pool{};
+};
+
+} // namespace osal
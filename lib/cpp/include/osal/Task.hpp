@@ -0,0 +1,254 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cassert>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace osal {
+
+template <typename T>
+class Task;
+
+namespace detail {
+
+/// Represents part of the Task promise, which doesn't depend on the type of the result.
+class TaskPromiseBase {
+public:
+    /// Allocates memory for the coroutine frame.
+    /// @param size             Size of the coroutine frame.
+    /// @return Allocated memory or nullptr if there is no free memory.
+    /// @note Allocation failure is reported by returning an invalid Task, because exceptions are not used.
+    static void* operator new(std::size_t size) noexcept { return ::operator new(size, std::nothrow); }
+
+    /// Releases memory of the coroutine frame.
+    /// @param ptr              Memory to be released.
+    static void operator delete(void* ptr) noexcept { ::operator delete(ptr); }
+
+    /// Represents awaiter used when coroutine finishes. It transfers execution back to the awaiting coroutine.
+    struct FinalAwaiter {
+        [[nodiscard]] bool await_ready() const noexcept { return false; }
+
+        template <typename Promise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept
+        {
+            auto continuation = handle.promise().m_continuation;
+            return continuation ? continuation : std::noop_coroutine();
+        }
+
+        void await_resume() const noexcept {}
+    };
+
+    /// Task is lazy, so coroutine is started only when it is awaited for the first time.
+    [[nodiscard]] std::suspend_always initial_suspend() const noexcept { return {}; }
+
+    [[nodiscard]] FinalAwaiter final_suspend() const noexcept { return {}; }
+
+    /// Called when exception escapes the coroutine, which can't happen with exceptions disabled.
+    [[noreturn]] void unhandled_exception() const noexcept { std::terminate(); }
+
+    /// Sets coroutine, which should be resumed when this one is finished.
+    /// @param continuation     Coroutine to be resumed.
+    void setContinuation(std::coroutine_handle<> continuation) { m_continuation = continuation; }
+
+private:
+    std::coroutine_handle<> m_continuation;
+};
+
+/// Represents promise of the Task returning value.
+/// @tparam T                   Type of the result.
+template <typename T>
+class TaskPromise : public TaskPromiseBase {
+public:
+    Task<T> get_return_object();
+
+    static Task<T> get_return_object_on_allocation_failure();
+
+    template <typename U>
+        requires std::is_convertible_v<U&&, T>
+    void return_value(U&& value)
+    {
+        m_value.emplace(std::forward<U>(value));
+    }
+
+    /// Returns result of the coroutine.
+    /// @return Result of the coroutine.
+    T result()
+    {
+        assert(m_value);
+        return std::move(*m_value);
+    }
+
+private:
+    std::optional<T> m_value;
+};
+
+/// Represents promise of the Task returning nothing.
+template <>
+class TaskPromise<void> : public TaskPromiseBase {
+public:
+    Task<void> get_return_object();
+
+    static Task<void> get_return_object_on_allocation_failure();
+
+    void return_void() const {}
+
+    void result() const {}
+};
+
+} // namespace detail
+
+/// Represents lazily started coroutine returning value of the given type.
+/// @tparam T                   Type of the result.
+/// @note Task is started when it is awaited with co_await or spawned in the TaskScheduler. Suspended task doesn't
+///       occupy any thread, only the memory of its coroutine frame.
+/// @note Coroutine frame is allocated without throwing. If there is no memory, then returned Task is invalid.
+template <typename T = void>
+class [[nodiscard]] Task {
+public:
+    using promise_type = detail::TaskPromise<T>;
+
+    /// Default constructor.
+    /// @note This constructor creates invalid task, which is not bound to any coroutine.
+    Task() = default;
+
+    /// Constructor.
+    /// @param handle           Handle of the coroutine owned by this task.
+    explicit Task(std::coroutine_handle<promise_type> handle)
+        : m_handle(handle)
+    {}
+
+    /// Copy constructor.
+    /// @note This constructor is deleted, because Task is the only owner of its coroutine.
+    Task(const Task&) = delete;
+
+    /// Move constructor.
+    /// @param other            Task to be moved.
+    Task(Task&& other) noexcept
+        : m_handle(std::exchange(other.m_handle, {}))
+    {}
+
+    /// Destructor.
+    /// @note Coroutine frame is destroyed together with the task, even if it hasn't finished yet.
+    ~Task()
+    {
+        if (m_handle)
+            m_handle.destroy();
+    }
+
+    /// Copy assignment operator.
+    /// @return Reference to self.
+    /// @note This operator is deleted, because Task is the only owner of its coroutine.
+    Task& operator=(const Task&) = delete;
+
+    /// Move assignment operator.
+    /// @param other            Task to be moved.
+    /// @return Reference to self.
+    Task& operator=(Task&& other) noexcept
+    {
+        if (this != &other) {
+            if (m_handle)
+                m_handle.destroy();
+
+            m_handle = std::exchange(other.m_handle, {});
+        }
+
+        return *this;
+    }
+
+    /// Checks if task is bound to the coroutine.
+    /// @return Flag indicating if task is bound to the coroutine.
+    [[nodiscard]] bool valid() const { return static_cast<bool>(m_handle); }
+
+    /// Checks if coroutine has already finished.
+    /// @return Flag indicating if coroutine has already finished.
+    [[nodiscard]] bool done() const { return m_handle && m_handle.done(); }
+
+    /// Returns awaiter, which starts the task and suspends the awaiting coroutine until the task is finished.
+    /// @return Awaiter of the task.
+    auto operator co_await() noexcept
+    {
+        struct Awaiter {
+            std::coroutine_handle<promise_type> handle;
+
+            [[nodiscard]] bool await_ready() const noexcept { return handle.done(); }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept
+            {
+                handle.promise().setContinuation(awaiting);
+                return handle;
+            }
+
+            T await_resume() { return handle.promise().result(); }
+        };
+
+        assert(m_handle);
+        return Awaiter{m_handle};
+    }
+
+private:
+    std::coroutine_handle<promise_type> m_handle;
+};
+
+namespace detail {
+
+template <typename T>
+Task<T> TaskPromise<T>::get_return_object()
+{
+    return Task<T>{std::coroutine_handle<TaskPromise>::from_promise(*this)};
+}
+
+template <typename T>
+Task<T> TaskPromise<T>::get_return_object_on_allocation_failure()
+{
+    return {};
+}
+
+inline Task<void> TaskPromise<void>::get_return_object()
+{
+    return Task<void>{std::coroutine_handle<TaskPromise>::from_promise(*this)};
+}
+
+inline Task<void> TaskPromise<void>::get_return_object_on_allocation_failure()
+{
+    return {};
+}
+
+} // namespace detail
+} // namespace osal
@@ -0,0 +1,281 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "osal/Mutex.hpp"
+#include "osal/Semaphore.hpp"
+#include "osal/Task.hpp"
+#include "osal/Timeout.hpp"
+#include "osal/WaiterSet.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <coroutine>
+#include <cstddef>
+#include <system_error>
+
+namespace osal {
+
+class TaskScheduler;
+
+namespace detail {
+
+/// Represents coroutine suspended in the TaskScheduler until some condition is met or its timeout expires.
+/// @note Child and sibling are used only by pure timers, which are kept in the deadline-ordered heap.
+struct TaskWaiter {
+    /// Tries to acquire the awaited object. For pure timers it is nullptr.
+    bool (*poll)(void* object);
+    void* object;
+    Timeout timeout;
+    std::coroutine_handle<> handle;
+    std::error_code result;
+    TaskWaiter* next;
+    TaskWaiter* child;
+    TaskWaiter* sibling;
+};
+
+/// Represents top-level coroutine owning the task spawned in the TaskScheduler.
+class RootTask {
+public:
+    class promise_type {
+    public:
+        static void* operator new(std::size_t size) noexcept { return ::operator new(size, std::nothrow); }
+
+        static void operator delete(void* ptr) noexcept { ::operator delete(ptr); }
+
+        RootTask get_return_object() { return RootTask{std::coroutine_handle<promise_type>::from_promise(*this)}; }
+
+        static RootTask get_return_object_on_allocation_failure() { return RootTask{}; }
+
+        [[nodiscard]] std::suspend_always initial_suspend() const noexcept { return {}; }
+
+        /// Represents awaiter, which releases the coroutine frame as soon as the spawned task is finished.
+        struct FinalAwaiter {
+            [[nodiscard]] bool await_ready() const noexcept { return false; }
+            void await_suspend(std::coroutine_handle<promise_type> handle) const noexcept;
+            void await_resume() const noexcept {}
+        };
+
+        [[nodiscard]] FinalAwaiter final_suspend() const noexcept { return {}; }
+
+        [[noreturn]] void unhandled_exception() const noexcept { std::terminate(); }
+
+        void return_void() const {}
+
+        TaskScheduler* scheduler{};
+        promise_type* prev{};
+        promise_type* next{};
+        promise_type* nextReady{};
+    };
+
+    RootTask() = default;
+
+    explicit RootTask(std::coroutine_handle<promise_type> handle)
+        : m_handle(handle)
+    {}
+
+    [[nodiscard]] std::coroutine_handle<promise_type> handle() const { return m_handle; }
+
+private:
+    std::coroutine_handle<promise_type> m_handle;
+};
+
+} // namespace detail
+
+/// Represents single-threaded scheduler of the coroutines (osal::Task). All spawned tasks are executed by the thread,
+/// which calls run(). Awaitables provided by the scheduler suspend only the calling coroutine, so a task waiting for
+/// a mutex, semaphore or timeout doesn't occupy any thread, only the memory of its coroutine frame.
+/// @note Awaitables have to be used only by the tasks executed by this scheduler.
+/// @note Mutexes and semaphores are owned by the thread calling run(), so awaited mutexes must not be recursive and
+///       must not be already locked by that thread outside of the scheduler.
+/// @note Readiness of mutexes and semaphores is checked with tryLock() and tryWait() in every iteration of the loop.
+///       Releasing them with unlock() and signal() of the scheduler wakes it up immediately. Objects released
+///       in any other way are noticed by the fallback polling, which costs one check per awaited object every poll
+///       interval and adds up to one poll interval of latency. It can be disabled by passing Duration::max().
+/// @note Pure timers are kept in the deadline-ordered heap, so sleeping tasks cost nothing until they expire.
+/// @note Tasks can be spawned from any thread. Awaitables and run() have to be used by the thread calling run().
+class TaskScheduler {
+public:
+    /// Default interval between checks of the awaited mutexes and semaphores, when scheduler has nothing else to do.
+    static constexpr Duration cPollInterval = 1ms;
+
+    /// Constructor.
+    /// @param pollInterval     Interval between fallback checks of the awaited mutexes and semaphores, when scheduler
+    ///                         has nothing else to do. Duration::max() disables polling, in which case the awaited
+    ///                         objects have to be released only with unlock() and signal() or by the tasks.
+    explicit TaskScheduler(Duration pollInterval = cPollInterval)
+        : m_pollInterval(pollInterval)
+    {}
+
+    /// Copy constructor.
+    /// @note This constructor is deleted, because TaskScheduler is not meant to be copy-constructed.
+    TaskScheduler(const TaskScheduler&) = delete;
+
+    /// Move constructor.
+    /// @note This constructor is deleted, because spawned tasks keep reference to the scheduler.
+    TaskScheduler(TaskScheduler&&) = delete;
+
+    /// Destructor.
+    /// @note All tasks, that haven't finished yet, are destroyed.
+    ~TaskScheduler();
+
+    /// Copy assignment operator.
+    /// @return Reference to self.
+    /// @note This operator is deleted, because TaskScheduler is not meant to be copy-assigned.
+    TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+    /// Move assignment operator.
+    /// @return Reference to self.
+    /// @note This operator is deleted, because TaskScheduler is not meant to be move-assigned.
+    TaskScheduler& operator=(TaskScheduler&&) = delete;
+
+    /// Schedules the given task for execution. Scheduler becomes the owner of the task.
+    /// @param task             Task to be executed.
+    /// @return Error code of the operation.
+    /// @note This method can be called from any thread.
+    std::error_code spawn(Task<void> task);
+
+    /// Executes spawned tasks until all of them are finished or stop() is called.
+    /// @return Error code of the operation.
+    std::error_code run();
+
+    /// Requests run() to return as soon as possible. Unfinished tasks stay suspended and run() can be called again.
+    /// @note This method can be called from any thread.
+    void stop();
+
+    /// Returns number of spawned tasks, which are not finished yet.
+    /// @return Number of spawned tasks, which are not finished yet.
+    [[nodiscard]] std::size_t tasksCount() const { return m_tasksCount.load(); }
+
+    /// Returns awaitable suspending the calling task until the given mutex is locked or the timeout expires.
+    /// @param mutex            Mutex to be locked.
+    /// @param timeout          Maximal time to wait for the mutex.
+    /// @return Awaitable returning error code of the operation.
+    [[nodiscard]] auto lock(Mutex& mutex, Timeout timeout = Timeout::infinity())
+    {
+        return Awaiter{*this, detail::pollMutex, &mutex, timeout};
+    }
+
+    /// Returns awaitable suspending the calling task until the given semaphore is decremented or the timeout expires.
+    /// @param semaphore        Semaphore to be waited for.
+    /// @param timeout          Maximal time to wait for the semaphore.
+    /// @return Awaitable returning error code of the operation.
+    [[nodiscard]] auto wait(Semaphore& semaphore, Timeout timeout = Timeout::infinity())
+    {
+        return Awaiter{*this, detail::pollSemaphore, &semaphore, timeout};
+    }
+
+    /// Unlocks the given mutex and wakes up the scheduler, so that task waiting for it is resumed without delay.
+    /// @param mutex            Mutex to be unlocked.
+    /// @return Error code of the operation.
+    /// @note This method can be called from any thread owning the mutex.
+    std::error_code unlock(Mutex& mutex);
+
+    /// Increments the given semaphore and wakes up the scheduler, so that task waiting for it is resumed without
+    /// delay.
+    /// @param semaphore        Semaphore to be incremented.
+    /// @return Error code of the operation.
+    /// @note This method can be called from any thread.
+    std::error_code signal(Semaphore& semaphore);
+
+    /// Returns awaitable suspending the calling task until the given timeout expires.
+    /// @param timeout          Timeout to be waited for.
+    /// @return Awaitable returning error code of the operation (always OsalError::eOk).
+    [[nodiscard]] auto wait(Timeout timeout) { return Awaiter{*this, nullptr, nullptr, timeout}; }
+
+    /// Returns awaitable suspending the calling task for the specified amount of time.
+    /// @tparam Representation  Signed arithmetic type representing the number of ticks in the clock's duration.
+    /// @tparam Period          A std::ratio type representing the tick period of the clock, in seconds.
+    /// @param duration         Amount of time for which the calling task should be suspended.
+    /// @return Awaitable returning error code of the operation (always OsalError::eOk).
+    template <typename Representation, typename Period>
+    [[nodiscard]] auto sleep(const std::chrono::duration<Representation, Period>& duration)
+    {
+        return wait(Timeout(std::chrono::duration_cast<Duration>(duration)));
+    }
+
+private:
+    friend struct detail::RootTask::promise_type::FinalAwaiter;
+    using RootPromise = detail::RootTask::promise_type;
+
+    /// Represents awaitable suspending the calling task until the object is acquired or the timeout expires.
+    class Awaiter {
+    public:
+        Awaiter(TaskScheduler& scheduler, bool (*poll)(void*), void* object, Timeout timeout)
+            : m_scheduler(scheduler)
+            , m_waiter{poll, object, timeout, {}, {}, nullptr, nullptr, nullptr}
+        {}
+
+        [[nodiscard]] bool await_ready() { return detail::WaiterSet<detail::TaskWaiter>::complete(m_waiter); }
+
+        void await_suspend(std::coroutine_handle<> handle)
+        {
+            m_waiter.handle = handle;
+            m_scheduler.suspend(m_waiter);
+        }
+
+        [[nodiscard]] std::error_code await_resume() const { return m_waiter.result; }
+
+    private:
+        TaskScheduler& m_scheduler;
+        detail::TaskWaiter m_waiter;
+    };
+
+    /// Registers the given waiter as suspended.
+    /// @param waiter           Waiter to be registered.
+    void suspend(detail::TaskWaiter& waiter);
+
+    /// Releases the given root coroutine, when its task is finished.
+    /// @param promise          Promise of the finished root coroutine.
+    void finished(RootPromise& promise);
+
+    /// Resumes all tasks, which have been spawned since the last call.
+    /// @return Flag indicating if any task has been resumed.
+    bool resumeSpawned();
+
+    /// Resumes all suspended tasks, which waiters can be completed.
+    /// @return Flag indicating if any task has been resumed.
+    bool resumeWaiters();
+
+    Duration m_pollInterval;
+    Mutex m_mutex;
+    detail::Wakeup m_wakeup;
+    RootPromise* m_tasks{};
+    RootPromise* m_readyHead{};
+    RootPromise* m_readyTail{};
+    detail::WaiterSet<detail::TaskWaiter> m_waiters;
+    std::atomic<std::size_t> m_tasksCount{};
+    std::atomic<bool> m_stopRequested{};
+};
+
+} // namespace osal
@@ -33,28 +33,73 @@
 #pragma once
 
 #include "osal/Error.hpp"
+#include "osal/Semaphore.h"
+#include "osal/StackPool.hpp"
 #include "osal/Thread.h"
 
-#include <cassert>
+#include <algorithm>
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <functional>
+#include <initializer_list>
 #include <memory>
 #include <string>
 #include <string_view>
 #include <system_error>
+#include <tuple>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace osal {
 
+/// Default size of the inline storage for the thread function and its arguments.
+inline constexpr std::size_t cThreadCallableSize = 128;
+
+namespace detail {
+
+/// Creates name of the worker thread with the given index (e.g. "worker3" for prefix "worker" and index 3).
+/// @param prefix           Prefix of the name. Empty prefix results in the empty name.
+/// @param index            Index of the worker thread.
+/// @return NULL-terminated name of the worker thread.
+/// @note Prefix is truncated, so that the whole index fits into the thread name size supported by the platform.
+inline std::array<char, cOsalThreadNameSize> makeWorkerName(std::string_view prefix, std::size_t index)
+{
+    std::array<char, cOsalThreadNameSize> name{};
+    if (prefix.empty())
+        return name;
+
+    constexpr std::size_t cMaxNameSize = cOsalThreadNameSize - 1;
+    std::array<char, cMaxNameSize> digits{};
+    std::size_t digitsCount = 0;
+    do {
+        constexpr std::size_t cBase = 10;
+        digits[digitsCount++] = static_cast<char>('0' + (index % cBase));
+        index /= cBase;
+    } while (index != 0 && digitsCount < digits.size());
+
+    auto prefixSize = std::min(prefix.size(), cMaxNameSize - digitsCount);
+    std::copy_n(prefix.begin(), prefixSize, name.begin());
+    std::reverse_copy(digits.begin(), digits.begin() + digitsCount, name.begin() + prefixSize);
+    return name;
+}
+
+} // namespace detail
+
 /// Represents OSAL thread handle.
 /// @tparam cPriority           Priority to be used in thread construction.
 /// @tparam cStackSize          Stack size to be used in thread construction.
+/// @tparam cCallableSize       Size of the inline storage for the thread function and its arguments.
 /// @note This type can be used to start thread with any function (with any signature), in contrary to the C version
 ///       of this API.
+/// @note Thread function and its arguments are decay-copied (or moved) into the inline storage, so starting the
+///       thread never allocates memory. Function and arguments that don't fit into the storage are rejected
+///       at compile time.
 template <OsalThreadPriority cPriority = cOsalThreadDefaultPriority,
-          std::size_t cStackSize = cOsalThreadDefaultStackSize>
+          std::size_t cStackSize = cOsalThreadDefaultStackSize,
+          std::size_t cCallableSize = cThreadCallableSize>
 class Thread {
 public:
     /// Default constructor.
@@ -68,7 +113,8 @@ public:
     /// @param args             User arguments to be passed to the used function.
     /// @note This constructor immediately starts the thread.
     template <typename ThreadFunction, typename... Args>
-    explicit Thread(ThreadFunction function, Args&&... args)
+        requires(!std::is_same_v<std::remove_cvref_t<ThreadFunction>, Thread>)
+    explicit Thread(ThreadFunction&& function, Args&&... args)
     {
         start(std::forward<ThreadFunction>(function), std::forward<Args>(args)...);
     }
@@ -81,7 +127,7 @@ public:
     /// @param name             Human readable name of the thread.
     /// @note This constructor immediately starts the thread.
     template <typename ThreadFunction, typename... Args>
-    explicit Thread(std::string_view name, ThreadFunction function, Args&&... args)
+    explicit Thread(std::string_view name, ThreadFunction&& function, Args&&... args)
     {
         start(name, std::forward<ThreadFunction>(function), std::forward<Args>(args)...);
     }
@@ -96,8 +142,9 @@ public:
     {
         std::swap(m_thread, other.m_thread);
         std::swap(m_stack, other.m_stack);
-        std::swap(m_userFunction, other.m_userFunction);
-        std::swap(m_workerFunction, other.m_workerFunction);
+        std::swap(m_stackPool, other.m_stackPool);
+        std::swap(m_affinity, other.m_affinity);
+        std::swap(m_scheduling, other.m_scheduling);
         std::swap(m_started, other.m_started);
     }
 
@@ -108,6 +155,9 @@ public:
     {
         osalThreadJoin(&m_thread);
         osalThreadDestroy(&m_thread);
+
+        if (m_started && m_stackPool != nullptr)
+            m_stackPool->release(m_stack);
     }
 
     /// Copy assignment operator.
@@ -121,6 +171,8 @@ public:
     /// Sets custom stack to be used by the created Thread.
     /// @param stack            Custom stack to be used by the Thread.
     /// @return Error code of the operation.
+    /// @note Stack has to be at least cStackSize bytes big. On Linux stacks smaller than PTHREAD_STACK_MIN are ignored
+    ///       and the Thread runs on the stack allocated by the system.
     std::error_code setStack(void* stack)
     {
         if (stack == nullptr)
@@ -130,14 +182,87 @@ public:
         return OsalError::eOk;
     }
 
+    /// Sets stack pool, from which the created Thread will take its stack upon start. Stack is returned to the pool
+    /// when the Thread is destroyed.
+    /// @param pool             Stack pool to be used by the Thread.
+    /// @return Error code of the operation.
+    /// @note Stack pool has to outlive the Thread.
+    std::error_code setStackPool(StackPool& pool)
+    {
+        if (m_started)
+            return OsalError::eThreadAlreadyStarted;
+
+        m_stackPool = &pool;
+        return OsalError::eOk;
+    }
+
+    /// Sets the set of CPUs, on which the Thread is allowed to run. If thread is already started, then its affinity
+    /// is changed immediately. Otherwise it will be applied upon start.
+    /// @param cpus             Set of allowed CPUs.
+    /// @return Error code of the operation.
+    std::error_code setAffinity(const OsalCpuSet& cpus)
+    {
+        if (m_started)
+            return osalThreadSetAffinity(&m_thread, &cpus);
+
+        m_affinity = cpus;
+        return OsalError::eOk;
+    }
+
+    /// Sets the set of CPUs, on which the Thread is allowed to run.
+    /// @param cpus             Indexes of allowed CPUs.
+    /// @return Error code of the operation.
+    std::error_code setAffinity(std::initializer_list<std::uint32_t> cpus)
+    {
+        OsalCpuSet cpuSet{};
+        for (auto cpu : cpus)
+            osalCpuSetAdd(&cpuSet, cpu);
+
+        return setAffinity(cpuSet);
+    }
+
+    /// Returns the set of CPUs, on which the Thread is allowed to run.
+    /// @param cpus             Output argument where the set of allowed CPUs will be stored.
+    /// @return Error code of the operation.
+    std::error_code affinity(OsalCpuSet& cpus)
+    {
+        if (m_started)
+            return osalThreadGetAffinity(&m_thread, &cpus);
+
+        cpus = m_affinity;
+        return OsalError::eOk;
+    }
+
+    /// Returns runtime statistics of the Thread.
+    /// @param threadStats      Output argument where the statistics will be stored.
+    /// @return Error code of the operation.
+    /// @note Statistics are available only while the thread is running. Querying Thread, whose function has already
+    ///       returned, fails with eOsError even if the Thread hasn't been joined yet.
+    std::error_code stats(OsalThreadStats& threadStats) { return osalThreadGetStats(&m_thread, &threadStats); }
+
+    /// Sets scheduling policy and its parameters to be used by the created Thread.
+    /// @param scheduling       Scheduling configuration to be used by the Thread.
+    /// @return Error code of the operation.
+    /// @note Scheduling can be changed only before the thread is started.
+    std::error_code setScheduling(const OsalThreadScheduling& scheduling)
+    {
+        if (m_started)
+            return OsalError::eThreadAlreadyStarted;
+
+        m_scheduling = scheduling;
+        return OsalError::eOk;
+    }
+
     /// Starts the thread.
     /// @tparam ThreadFunction  Type of user function to be invoked by the new thread.
     /// @tparam Args            Types of user arguments to be passed to the used function.
     /// @param function         User function to be invoked by the new thread.
     /// @param args             User arguments to be passed to the used function.
     /// @return Error code of the operation.
+    /// @note If requested real-time policy cannot be applied, then thread is started with the default policy and
+    ///       OsalError::eSchedulingFallback is returned.
     template <typename ThreadFunction, typename... Args>
-    std::error_code start(ThreadFunction function, Args&&... args)
+    std::error_code start(ThreadFunction&& function, Args&&... args)
     {
         return start({}, std::forward<ThreadFunction>(function), std::forward<Args>(args)...);
     }
@@ -149,36 +274,61 @@ public:
     /// @param args             User arguments to be passed to the used function.
     /// @param name             Human readable name of the thread.
     /// @return Error code of the operation.
+    /// @note If requested real-time policy cannot be applied, then thread is started with the default policy and
+    ///       OsalError::eSchedulingFallback is returned.
     template <typename ThreadFunction, typename... Args>
-    std::error_code start(std::string_view name, ThreadFunction function, Args&&... args)
+    std::error_code start(std::string_view name, ThreadFunction&& function, Args&&... args)
     {
+        using CallableType = Callable<ThreadFunction, Args...>;
+        static_assert(sizeof(CallableType) <= cCallableSize,
+                      "Thread function and its arguments don't fit into the inline storage, increase cCallableSize");
+        static_assert(alignof(CallableType) <= alignof(std::max_align_t),
+                      "Thread function and its arguments require unsupported alignment");
+
         if (m_started)
             return OsalError::eThreadAlreadyStarted;
 
-        m_userFunction = std::make_unique<FunctionWrapper>(
-            // NOLINTNEXTLINE(modernize-avoid-bind)
-            std::bind(std::forward<ThreadFunction>(function), std::forward<Args>(args)...));
-        assert(m_userFunction);
+        LaunchData launch{};
+        if (auto error = osalSemaphoreCreate(&launch.launched, 0); error != OsalError::eOk)
+            return error;
+
+        auto stackSize = cStackSize;
+        if (m_stackPool != nullptr) {
+            if (auto error = m_stackPool->acquire(m_stack)) {
+                osalSemaphoreDestroy(&launch.launched);
+                return error;
+            }
+
+            stackSize = m_stackPool->stackSize();
+        }
 
-        m_workerFunction = [](void* arg) {
-            auto userFunction = *static_cast<FunctionWrapper*>(arg);
-            userFunction();
-        };
+        auto* callable = std::construct_at(reinterpret_cast<CallableType*>(m_callable.data()),
+                                           std::forward<ThreadFunction>(function),
+                                           std::forward<Args>(args)...);
+        launch.callable = callable;
 
+        OsalThreadConfig config{cPriority, stackSize, m_stack, m_affinity, m_scheduling};
         OsalError error{};
-        if (name.empty()) {
-            error
-                = osalThreadCreate(&m_thread, {cPriority, cStackSize, m_stack}, m_workerFunction, m_userFunction.get());
+        if (name.empty())
+            error = osalThreadCreate(&m_thread, config, worker<CallableType>, &launch);
+        else
+            error = osalThreadCreateEx(&m_thread, config, worker<CallableType>, &launch, name.data());
+
+        m_started = (error == OsalError::eOk || error == OsalError::eSchedulingFallback);
+        if (m_started) {
+            // After that the callable has been moved to the new thread, so Thread can be safely moved or restarted.
+            osalSemaphoreWait(&launch.launched);
         }
         else {
-            error = osalThreadCreateEx(&m_thread,
-                                       {cPriority, cStackSize, m_stack},
-                                       m_workerFunction,
-                                       m_userFunction.get(),
-                                       name.data());
+            std::destroy_at(callable);
+
+            if (m_stackPool != nullptr) {
+                m_stackPool->release(m_stack);
+                m_stack = nullptr;
+            }
         }
 
-        m_started = (error == OsalError::eOk);
+        osalSemaphoreDestroy(&launch.launched);
         return error;
     }
 
@@ -188,13 +338,46 @@ public:
     std::error_code join() { return osalThreadJoin(&m_thread); }
 
 private:
-    /// Helper wrapper around user thread function.
-    using FunctionWrapper = std::function<void(void)>;
+    /// Helper type representing decay-copied user function along with its arguments.
+    template <typename ThreadFunction, typename... Args>
+    using Callable = std::tuple<std::decay_t<ThreadFunction>, std::decay_t<Args>...>;
+
+    /// Represents data passed to the new thread. It lives on the stack of start() and is valid only until the new
+    /// thread signals the launched semaphore.
+    /// @note Signaling thread doesn't access the semaphore after the tokens are published, so start() can destroy it
+    ///       as soon as its wait returns.
+    struct LaunchData {
+        void* callable;
+        OsalSemaphore launched;
+    };
+
+    /// Helper function with signature required by the C API, which invokes the user function.
+    /// @tparam CallableType    Type of the callable stored in the inline storage.
+    /// @param arg              Launch data of the thread.
+    /// @note Callable is moved out of the inline storage before the creator is signaled, so Thread object can be
+    ///       moved while the thread is running.
+    template <typename CallableType>
+    static void worker(void* arg)
+    {
+        auto* launch = static_cast<LaunchData*>(arg);
+        auto* stored = static_cast<CallableType*>(launch->callable);
+        CallableType callable(std::move(*stored));
+        std::destroy_at(stored);
+        osalSemaphoreSignal(&launch->launched);
+
+        std::apply(
+            [](auto&& function, auto&&... args) {
+                std::invoke(std::forward<decltype(function)>(function), std::forward<decltype(args)>(args)...);
+            },
+            std::move(callable));
+    }
 
     OsalThread m_thread{};
     void* m_stack{};
-    std::unique_ptr<FunctionWrapper> m_userFunction;
-    OsalThreadFunction m_workerFunction{};
+    StackPool* m_stackPool{};
+    OsalCpuSet m_affinity{};
+    OsalThreadScheduling m_scheduling{};
+    alignas(std::max_align_t) std::array<std::byte, cCallableSize> m_callable{};
     bool m_started{};
 };
 
@@ -241,6 +424,19 @@ inline void yield()
     return osalThreadId();
 }
 
+/// Returns index of the CPU, on which the current thread is running.
+/// @note Unless thread is pinned to a single CPU, returned value may be outdated right after the call.
+[[nodiscard]] inline std::uint32_t currentCpu()
+{
+    return osalThreadCurrentCpu();
+}
+
+/// Returns number of CPUs, on which the current thread is allowed to run.
+[[nodiscard]] inline std::uint32_t cpuCount()
+{
+    return osalThreadCpuCount();
+}
+
 /// Returns name of the current thread.
 /// @note Returned name will be the same as the one provided in upon thread creation.
 /// @note Returned name will always be NULL-terminated.
@@ -254,5 +450,21 @@ inline void yield()
     return threadName;
 }
 
+/// Returns information about all live threads created with the OSAL API.
+/// @return Information about all live threads created with the OSAL API.
+/// @note Threads created outside of OSAL (e.g. the main thread) are not reported.
+[[nodiscard]] inline std::vector<OsalThreadInfo> enumerate()
+{
+    std::vector<OsalThreadInfo> infos;
+    std::size_t count{};
+
+    // Threads can be created between the calls, so retry until the whole registry fits into the buffer.
+    while (osalThreadEnumerate(infos.data(), infos.size(), &count) == OsalError::eOk && count > infos.size())
+        infos.resize(count);
+
+    infos.resize(std::min(count, infos.size()));
+    return infos;
+}
+
 } // namespace thread
 } // namespace osal
@@ -0,0 +1,184 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "osal/Error.hpp"
+#include "osal/ThreadLocal.h"
+
+#include <cassert>
+#include <new>
+#include <system_error>
+#include <utility>
+
+namespace osal {
+
+/// Represents object, which has separate instance in each thread.
+/// @tparam T                   Type of the object.
+/// @note Instance is allocated and default-constructed on the first access from the given thread and destroyed when
+///       that thread exits.
+/// @note ThreadLocal should outlive all threads using it. Instances of threads, which are still running when
+///       ThreadLocal is destroyed, are not destroyed.
+/// @note On FreeRTOS each ThreadLocal permanently consumes one thread-local storage pointer (see OsalThreadLocal).
+template <typename T>
+class ThreadLocal {
+public:
+    /// Default constructor.
+    ThreadLocal() { osalThreadLocalCreate(&m_local, destroyValue); }
+
+    /// Copy constructor.
+    /// @note This constructor is deleted, because ThreadLocal is not meant to be copy-constructed.
+    ThreadLocal(const ThreadLocal&) = delete;
+
+    /// Move constructor.
+    /// @param other            Object to be moved.
+    ThreadLocal(ThreadLocal&& other) noexcept { std::swap(m_local, other.m_local); }
+
+    /// Destructor.
+    ~ThreadLocal()
+    {
+        if (m_local.initialized) {
+            delete get(false);
+            osalThreadLocalDestroy(&m_local);
+        }
+    }
+
+    /// Copy assignment operator.
+    /// @return Reference to self.
+    /// @note This operator is deleted, because ThreadLocal is not meant to be copy-assigned.
+    ThreadLocal& operator=(const ThreadLocal&) = delete;
+
+    /// Move assignment operator.
+    /// @return Reference to self.
+    /// @note This operator is deleted, because ThreadLocal is not meant to be move-assigned.
+    ThreadLocal& operator=(ThreadLocal&&) = delete;
+
+    /// Returns instance of the current thread. If it doesn't exist yet, then it is created.
+    /// @return Instance of the current thread or nullptr if it could not be created.
+    [[nodiscard]] T* get() { return get(true); }
+
+    /// Returns instance of the current thread. If it doesn't exist yet, then it is created.
+    /// @return Instance of the current thread.
+    T& operator*()
+    {
+        auto* value = get();
+        assert(value);
+        return *value;
+    }
+
+    /// Returns instance of the current thread. If it doesn't exist yet, then it is created.
+    /// @return Instance of the current thread.
+    T* operator->()
+    {
+        auto* value = get();
+        assert(value);
+        return value;
+    }
+
+    /// Checks if instance of the current thread already exists.
+    /// @return Flag indicating if instance of the current thread already exists.
+    [[nodiscard]] bool exists() const { return osalThreadLocalGet(&m_local) != nullptr; }
+
+    /// Replaces instance of the current thread with the given value.
+    /// @param value            Value to be stored.
+    /// @return Error code of the operation.
+    std::error_code set(T value)
+    {
+        if (auto* current = get(false)) {
+            *current = std::move(value);
+            return OsalError::eOk;
+        }
+
+        if (!m_local.initialized)
+            return OsalError::eInvalidArgument;
+
+        auto* created = new (std::nothrow) T(std::move(value));
+        if (created == nullptr)
+            return OsalError::eOsError;
+
+        return store(created);
+    }
+
+    /// Destroys instance of the current thread. Next access will create a new one.
+    /// @return Error code of the operation.
+    std::error_code reset()
+    {
+        if (!m_local.initialized)
+            return OsalError::eInvalidArgument;
+
+        auto* current = get(false);
+        auto error = osalThreadLocalSet(&m_local, nullptr);
+        if (error == OsalError::eOk)
+            delete current;
+
+        return error;
+    }
+
+private:
+    /// Destroys the given instance at thread exit.
+    /// @param value            Instance to be destroyed.
+    static void destroyValue(void* value) { delete static_cast<T*>(value); }
+
+    /// Returns instance of the current thread.
+    /// @param create           Flag indicating if instance should be created if it doesn't exist yet.
+    /// @return Instance of the current thread or nullptr if it doesn't exist.
+    T* get(bool create)
+    {
+        if (auto* value = osalThreadLocalGet(&m_local))
+            return static_cast<T*>(value);
+
+        if (!create || !m_local.initialized)
+            return nullptr;
+
+        auto* value = new (std::nothrow) T();
+        if (value == nullptr || store(value))
+            return nullptr;
+
+        return value;
+    }
+
+    /// Stores the given instance as the instance of the current thread.
+    /// @param value            Instance to be stored.
+    /// @return Error code of the operation.
+    std::error_code store(T* value)
+    {
+        auto error = osalThreadLocalSet(&m_local, value);
+        if (error != OsalError::eOk)
+            delete value;
+
+        return error;
+    }
+
+    OsalThreadLocal m_local{};
+};
+
+} // namespace osal
@@ -0,0 +1,409 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "osal/Error.hpp"
+#include "osal/Future.hpp"
+#include "osal/Mutex.hpp"
+#include "osal/ScopedLock.hpp"
+#include "osal/Semaphore.hpp"
+#include "osal/Thread.hpp"
+#include "osal/Timeout.hpp"
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string_view>
+#include <system_error>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace osal {
+
+/// Default size of the inline storage for a single task of the ThreadPool.
+inline constexpr std::size_t cThreadPoolTaskSize = 64;
+
+/// Represents fixed-size pool of worker threads executing tasks from the bounded FIFO queue.
+/// @tparam cWorkers            Number of worker threads.
+/// @tparam cQueueSize          Maximal number of tasks waiting for execution.
+/// @tparam cPriority           Priority of the worker threads.
+/// @tparam cStackSize          Stack size of the worker threads.
+/// @tparam cTaskSize           Size of the inline storage for a single task (function and its arguments).
+/// @note All memory used by the pool is part of the object, so submitting tasks never allocates memory. Tasks that
+///       don't fit into the inline storage are rejected at compile time.
+/// @note Pool can be started only once. After shutdown() all worker threads are joined and pool cannot be reused.
+template <std::size_t cWorkers,
+          std::size_t cQueueSize,
+          OsalThreadPriority cPriority = cOsalThreadDefaultPriority,
+          std::size_t cStackSize = cOsalThreadDefaultStackSize,
+          std::size_t cTaskSize = cThreadPoolTaskSize>
+class ThreadPool {
+    static_assert(cWorkers > 0, "ThreadPool requires at least one worker");
+    static_assert(cQueueSize > 0, "ThreadPool requires non-empty queue");
+
+public:
+    /// Default constructor.
+    /// @note This constructor creates pool without any workers. It can be later started with start() method.
+    ThreadPool() = default;
+
+    /// Constructor.
+    /// @param namePrefix       Prefix of the worker thread names. Each name is suffixed with the worker index.
+    /// @note This constructor immediately starts all worker threads.
+    explicit ThreadPool(std::string_view namePrefix) { start(namePrefix); }
+
+    /// Copy constructor.
+    /// @note This constructor is deleted, because ThreadPool is not meant to be copy-constructed.
+    ThreadPool(const ThreadPool&) = delete;
+
+    /// Move constructor.
+    /// @note This constructor is deleted, because workers keep reference to the pool.
+    ThreadPool(ThreadPool&&) = delete;
+
+    /// Destructor.
+    /// @note This destructor gracefully shuts down the pool, so it blocks until all queued tasks are executed.
+    ~ThreadPool() { shutdown(); }
+
+    /// Copy assignment operator.
+    /// @return Reference to self.
+    /// @note This operator is deleted, because ThreadPool is not meant to be copy-assigned.
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /// Move assignment operator.
+    /// @return Reference to self.
+    /// @note This operator is deleted, because ThreadPool is not meant to be move-assigned.
+    ThreadPool& operator=(ThreadPool&&) = delete;
+
+    /// Starts all worker threads.
+    /// @param namePrefix       Prefix of the worker thread names. Each name is suffixed with the worker index.
+    /// @return Error code of the operation.
+    /// @note Prefix is truncated, so that the whole name fits into 15 characters.
+    std::error_code start(std::string_view namePrefix = {})
+    {
+        {
+            ScopedLock lock(m_mutex);
+            if (m_running || m_startedWorkers != 0)
+                return OsalError::eThreadAlreadyStarted;
+
+            m_running = true;
+        }
+
+        std::error_code result;
+        for (std::size_t i = 0; i < cWorkers; ++i) {
+            auto name = detail::makeWorkerName(namePrefix, i);
+
+            auto error = m_workers[i].start(std::string_view(name.data()), [this] { workerLoop(); });
+            if (error && error != OsalError::eSchedulingFallback) {
+                shutdown();
+                return error;
+            }
+
+            ++m_startedWorkers;
+            if (error)
+                result = error;
+        }
+
+        return result;
+    }
+
+    /// Gracefully shuts down the pool. New tasks are rejected, already queued tasks are executed and all worker
+    /// threads are joined.
+    /// @return Error code of the operation.
+    std::error_code shutdown()
+    {
+        {
+            ScopedLock lock(m_mutex);
+            if (!m_running)
+                return OsalError::eOk;
+
+            m_running = false;
+        }
+
+        // Each worker exits after consuming one token, which is not associated with any task.
+        m_usedSlots.signal(static_cast<unsigned int>(m_startedWorkers));
+        for (std::size_t i = 0; i < m_startedWorkers; ++i)
+            m_workers[i].join();
+
+        return OsalError::eOk;
+    }
+
+    /// Submits the given task for execution. If queue is full, then the caller is blocked until there is free space.
+    /// @tparam Function        Type of user function to be executed.
+    /// @tparam Args            Types of user arguments to be passed to the user function.
+    /// @param function         User function to be executed.
+    /// @param args             User arguments to be passed to the user function.
+    /// @return Error code of the operation.
+    /// @note If pool is not running, then OsalError::eInvalidArgument is returned.
+    template <typename Function, typename... Args>
+        requires std::invocable<std::decay_t<Function>, std::decay_t<Args>...>
+    std::error_code submit(Function&& function, Args&&... args)
+    {
+        return timedSubmit(Timeout::infinity(), std::forward<Function>(function), std::forward<Args>(args)...);
+    }
+
+    /// Submits the given task for execution. If queue is full, then the caller is blocked until there is free space.
+    /// @tparam Result          Type of the task result.
+    /// @tparam Function        Type of user function to be executed.
+    /// @tparam Args            Types of user arguments to be passed to the user function.
+    /// @param future           Future, which will receive the result of the task.
+    /// @param function         User function to be executed.
+    /// @param args             User arguments to be passed to the user function.
+    /// @return Error code of the operation.
+    /// @note Future must not be bound to any other pending operation.
+    template <typename Result, typename Function, typename... Args>
+        requires std::invocable<std::decay_t<Function>, std::decay_t<Args>...>
+    std::error_code submit(Future<Result>& future, Function&& function, Args&&... args)
+    {
+        return timedSubmit(Timeout::infinity(),
+                           future,
+                           std::forward<Function>(function),
+                           std::forward<Args>(args)...);
+    }
+
+    /// Submits the given task for execution. If queue is full, then the caller is blocked until there is free space
+    /// or the specified time elapses.
+    /// @tparam Function        Type of user function to be executed.
+    /// @tparam Args            Types of user arguments to be passed to the user function.
+    /// @param timeout          Maximal time to wait for free space in the queue.
+    /// @param function         User function to be executed.
+    /// @param args             User arguments to be passed to the user function.
+    /// @return Error code of the operation.
+    template <typename Function, typename... Args>
+        requires std::invocable<std::decay_t<Function>, std::decay_t<Args>...>
+    std::error_code timedSubmit(Timeout timeout, Function&& function, Args&&... args)
+    {
+        using TaskType = std::tuple<std::decay_t<Function>, std::decay_t<Args>...>;
+        return enqueue<TaskType>(timeout, std::forward<Function>(function), std::forward<Args>(args)...);
+    }
+
+    /// Submits the given task for execution. If queue is full, then the caller is blocked until there is free space
+    /// or the specified time elapses.
+    /// @tparam Result          Type of the task result.
+    /// @tparam Function        Type of user function to be executed.
+    /// @tparam Args            Types of user arguments to be passed to the user function.
+    /// @param timeout          Maximal time to wait for free space in the queue.
+    /// @param future           Future, which will receive the result of the task.
+    /// @param function         User function to be executed.
+    /// @param args             User arguments to be passed to the user function.
+    /// @return Error code of the operation.
+    /// @note Future must not be bound to any other pending operation.
+    template <typename Result, typename Function, typename... Args>
+        requires std::invocable<std::decay_t<Function>, std::decay_t<Args>...>
+    std::error_code timedSubmit(Timeout timeout, Future<Result>& future, Function&& function, Args&&... args)
+    {
+        static_assert(std::is_void_v<Result>
+                          || std::is_constructible_v<Result,
+                                                     std::invoke_result_t<std::decay_t<Function>,
+                                                                          std::decay_t<Args>...>>,
+                      "Result of the task cannot be stored in the given future");
+
+        if (auto error = detail::FutureAccess::prepare(future))
+            return error;
+
+        using TaskType = FutureTask<Result, std::decay_t<Function>, std::decay_t<Args>...>;
+        auto error = enqueue<TaskType>(timeout,
+                                       &future,
+                                       std::forward_as_tuple(std::forward<Function>(function),
+                                                             std::forward<Args>(args)...));
+        if (error)
+            detail::FutureAccess::cancel(future);
+
+        return error;
+    }
+
+    /// Returns number of worker threads in the pool.
+    /// @return Number of worker threads in the pool.
+    [[nodiscard]] static constexpr std::size_t workersCount() { return cWorkers; }
+
+    /// Returns maximal number of tasks waiting for execution.
+    /// @return Maximal number of tasks waiting for execution.
+    [[nodiscard]] static constexpr std::size_t queueSize() { return cQueueSize; }
+
+private:
+    /// Represents single task stored in the queue.
+    struct Task {
+        alignas(std::max_align_t) std::array<std::byte, cTaskSize> storage;
+        void (*run)(void*);
+        void (*relocate)(void*, void*);
+    };
+
+    /// Represents task, whose result is delivered to the future.
+    /// @tparam Result          Type of the task result.
+    /// @tparam Function        Type of user function to be executed.
+    /// @tparam Args            Types of user arguments to be passed to the user function.
+    template <typename Result, typename Function, typename... Args>
+    struct FutureTask {
+        /// Constructor.
+        /// @tparam Values      Types of the function and arguments to be stored.
+        /// @param future       Future, which will receive the result of the task.
+        /// @param values       Function and arguments to be stored.
+        template <typename... Values>
+        FutureTask(Future<Result>* future, std::tuple<Values...>&& values)
+            : m_future(future)
+            , m_call(std::make_from_tuple<std::tuple<Function, Args...>>(std::move(values)))
+        {}
+
+        /// Invokes the task and delivers its result to the future.
+        void operator()()
+        {
+            if constexpr (std::is_void_v<Result>) {
+                invoke(m_call);
+                detail::FutureAccess::fulfil(*m_future);
+            }
+            else {
+                detail::FutureAccess::fulfil(*m_future, invoke(m_call));
+            }
+        }
+
+        Future<Result>* m_future;
+        std::tuple<Function, Args...> m_call;
+    };
+
+    /// Invokes user function with its arguments stored in the given tuple.
+    /// @tparam Call            Type of the tuple with user function and its arguments.
+    /// @param call             Tuple with user function and its arguments.
+    /// @return Result of the user function.
+    template <typename Call>
+    static decltype(auto) invoke(Call& call)
+    {
+        return std::apply(
+            [](auto&& function, auto&&... args) -> decltype(auto) {
+                return std::invoke(std::forward<decltype(function)>(function), std::forward<decltype(args)>(args)...);
+            },
+            std::move(call));
+    }
+
+    /// Runs the task stored in the given memory and destroys it.
+    /// @tparam TaskType        Type of the stored task.
+    /// @param storage          Memory with the stored task.
+    template <typename TaskType>
+    static void runTask(void* storage)
+    {
+        auto* task = std::launder(reinterpret_cast<TaskType*>(storage));
+        if constexpr (std::is_invocable_v<TaskType&>)
+            (*task)();
+        else
+            invoke(*task);
+
+        std::destroy_at(task);
+    }
+
+    /// Moves the task from one memory to another one.
+    /// @tparam TaskType        Type of the stored task.
+    /// @param destination      Memory where task should be moved to.
+    /// @param source           Memory with the stored task.
+    template <typename TaskType>
+    static void relocateTask(void* destination, void* source)
+    {
+        auto* task = std::launder(reinterpret_cast<TaskType*>(source));
+        std::construct_at(reinterpret_cast<TaskType*>(destination), std::move(*task));
+        std::destroy_at(task);
+    }
+
+    /// Puts new task into the queue.
+    /// @tparam TaskType        Type of the task to be stored.
+    /// @tparam Values          Types of the values used to construct the task.
+    /// @param timeout          Maximal time to wait for free space in the queue.
+    /// @param values           Values used to construct the task.
+    /// @return Error code of the operation.
+    template <typename TaskType, typename... Values>
+    std::error_code enqueue(Timeout timeout, Values&&... values)
+    {
+        static_assert(sizeof(TaskType) <= cTaskSize, "Task doesn't fit into the inline storage, increase cTaskSize");
+        static_assert(alignof(TaskType) <= alignof(std::max_align_t), "Task requires unsupported alignment");
+
+        if (auto error = m_freeSlots.timedWait(timeout))
+            return error;
+
+        {
+            ScopedLock lock(m_mutex);
+            if (m_running) {
+                auto& task = m_tasks[m_tail];
+                std::construct_at(reinterpret_cast<TaskType*>(task.storage.data()), std::forward<Values>(values)...);
+                task.run = runTask<TaskType>;
+                task.relocate = relocateTask<TaskType>;
+                m_tail = (m_tail + 1) % cQueueSize;
+                ++m_count;
+            }
+            else {
+                m_freeSlots.signal();
+                return OsalError::eInvalidArgument;
+            }
+        }
+
+        m_usedSlots.signal();
+        return OsalError::eOk;
+    }
+
+    /// Main loop of each worker thread.
+    void workerLoop()
+    {
+        Task task{};
+        while (true) {
+            m_usedSlots.wait();
+
+            {
+                ScopedLock lock(m_mutex);
+
+                // Token without task means, that pool is shutting down and all tasks have been already executed.
+                if (m_count == 0)
+                    return;
+
+                auto& queued = m_tasks[m_head];
+                queued.relocate(task.storage.data(), queued.storage.data());
+                task.run = queued.run;
+                m_head = (m_head + 1) % cQueueSize;
+                --m_count;
+            }
+
+            m_freeSlots.signal();
+            task.run(task.storage.data());
+        }
+    }
+
+    std::array<Thread<cPriority, cStackSize>, cWorkers> m_workers;
+    std::array<Task, cQueueSize> m_tasks{};
+    Mutex m_mutex;
+    Semaphore m_freeSlots{static_cast<unsigned int>(cQueueSize)};
+    Semaphore m_usedSlots{0};
+    std::size_t m_head{};
+    std::size_t m_tail{};
+    std::size_t m_count{};
+    std::size_t m_startedWorkers{};
+    bool m_running{};
+};
+
+} // namespace osal
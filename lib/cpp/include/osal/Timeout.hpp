@@ -112,6 +112,11 @@ public:
         return std::chrono::duration_cast<Duration>(m_expireTimestamp - now);
     }
 
+    /// Returns the absolute timestamp, at which timeout expires.
+    /// @return Absolute timestamp, at which timeout expires.
+    /// @note For infinite timeout returned value is meaningless and Timestamp::max() is returned.
+    [[nodiscard]] Timestamp deadline() const { return isInfinity() ? Timestamp::max() : m_expireTimestamp; }
+
     /// Resets internal state of the timeout. Deadline is recalculated as if timeout was created during this call.
     void reset()
     {
@@ -130,7 +135,7 @@ public:
 private:
     Duration m_duration;
     bool m_infinity;
-    std::chrono::time_point<Clock, Duration> m_expireTimestamp;
+    Timestamp m_expireTimestamp;
 };
 
 /// Blocks current thread until given timeout is expired.
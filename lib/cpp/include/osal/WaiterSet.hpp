@@ -0,0 +1,263 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "osal/Error.hpp"
+#include "osal/Mutex.hpp"
+#include "osal/Semaphore.hpp"
+#include "osal/Timeout.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <utility>
+
+namespace osal {
+namespace detail {
+
+/// Tries to lock the given mutex.
+/// @param object           Mutex to be locked.
+/// @return Flag indicating if mutex has been locked.
+inline bool pollMutex(void* object)
+{
+    return !static_cast<Mutex*>(object)->tryLock();
+}
+
+/// Tries to decrement the given semaphore.
+/// @param object           Semaphore to be decremented.
+/// @return Flag indicating if semaphore has been decremented.
+inline bool pollSemaphore(void* object)
+{
+    return !static_cast<Semaphore*>(object)->tryWait();
+}
+
+/// Represents set of the suspended waiters shared by the TaskScheduler and the FiberScheduler. Waiters for objects
+/// (mutexes and semaphores) are kept in the FIFO list and checked with their poll function. Pure timers are kept
+/// in the intrusive pairing heap ordered by the deadline, so only the expired ones are visited.
+/// @tparam Waiter          Type of the waiter. It has to provide poll, object, timeout, result, next, child and
+///                         sibling members.
+/// @note Waiters are not owned by the set and have to remain valid until they are completed.
+template <typename Waiter>
+class WaiterSet {
+public:
+    /// Checks if the given waiter can be completed and sets its result.
+    /// @param waiter           Waiter to be checked.
+    /// @return Flag indicating if the given waiter has been completed.
+    static bool complete(Waiter& waiter)
+    {
+        if (waiter.poll != nullptr && waiter.poll(waiter.object)) {
+            waiter.result = OsalError::eOk;
+            return true;
+        }
+
+        if (waiter.timeout.isExpired()) {
+            // Pure timers complete successfully, when their timeout expires.
+            waiter.result = (waiter.poll != nullptr) ? OsalError::eTimeout : OsalError::eOk;
+            return true;
+        }
+
+        return false;
+    }
+
+    /// Adds the given waiter to the set.
+    /// @param waiter           Waiter to be added.
+    void add(Waiter& waiter)
+    {
+        waiter.next = nullptr;
+        if (waiter.poll == nullptr) {
+            waiter.child = nullptr;
+            waiter.sibling = nullptr;
+            m_timers = meld(m_timers, &waiter);
+            return;
+        }
+
+        if (m_pollTail != nullptr)
+            m_pollTail->next = &waiter;
+        else
+            m_pollHead = &waiter;
+
+        m_pollTail = &waiter;
+    }
+
+    /// Removes all waiters, which can be completed, from the set and passes them to the given function.
+    /// @tparam Function        Type of the function invoked for each completed waiter.
+    /// @param function         Function invoked for each completed waiter.
+    /// @return Flag indicating if any waiter has been completed.
+    /// @note Completed waiters are collected first, so the function can safely add new waiters to the set and
+    ///       release the completed ones.
+    template <typename Function>
+    bool completeReady(Function function)
+    {
+        Waiter* completedHead{};
+        Waiter** completedTail = &completedHead;
+        auto push = [&completedTail](Waiter* waiter) {
+            waiter->next = nullptr;
+            *completedTail = waiter;
+            completedTail = &waiter->next;
+        };
+
+        while (m_timers != nullptr && complete(*m_timers)) {
+            auto* timer = m_timers;
+            m_timers = mergePairs(timer->child);
+            push(timer);
+        }
+
+        auto* waiter = std::exchange(m_pollHead, nullptr);
+        m_pollTail = nullptr;
+        while (waiter != nullptr) {
+            auto* next = waiter->next;
+            if (complete(*waiter))
+                push(waiter);
+            else
+                add(*waiter);
+
+            waiter = next;
+        }
+
+        bool completed = (completedHead != nullptr);
+        while (completedHead != nullptr) {
+            // Waiter can be released by the function, so the next one has to be read first.
+            auto* next = completedHead->next;
+            function(*completedHead);
+            completedHead = next;
+        }
+
+        return completed;
+    }
+
+    /// Returns time, after which the set should be checked again, if nothing else happens.
+    /// @param pollInterval     Interval between checks of the waiters for objects.
+    /// @return Time, after which the set should be checked again.
+    [[nodiscard]] Duration nextCheck(Duration pollInterval) const
+    {
+        auto sleepTime = (m_timers != nullptr) ? m_timers->timeout.timeLeft() : Duration::max();
+        for (auto* waiter = m_pollHead; waiter != nullptr; waiter = waiter->next)
+            sleepTime = std::min({sleepTime, waiter->timeout.timeLeft(), pollInterval});
+
+        return sleepTime;
+    }
+
+private:
+    /// Merges two heaps into one.
+    /// @param first            Root of the first heap.
+    /// @param second           Root of the second heap.
+    /// @return Root of the merged heap.
+    static Waiter* meld(Waiter* first, Waiter* second)
+    {
+        if (first == nullptr)
+            return second;
+
+        if (second == nullptr)
+            return first;
+
+        if (second->timeout.deadline() < first->timeout.deadline())
+            std::swap(first, second);
+
+        second->sibling = first->child;
+        first->child = second;
+        return first;
+    }
+
+    /// Merges all siblings starting from the given one into a single heap (standard two-pass pairing).
+    /// @param first            First sibling to be merged.
+    /// @return Root of the merged heap.
+    static Waiter* mergePairs(Waiter* first)
+    {
+        // First pass melds siblings in pairs from left to right and links the results in reverse order.
+        Waiter* pairs{};
+        while (first != nullptr) {
+            auto* second = first->sibling;
+            if (second == nullptr) {
+                first->sibling = pairs;
+                pairs = first;
+                break;
+            }
+
+            auto* next = second->sibling;
+            first->sibling = nullptr;
+            second->sibling = nullptr;
+            auto* pair = meld(first, second);
+            pair->sibling = pairs;
+            pairs = pair;
+            first = next;
+        }
+
+        // Second pass melds the pairs from right to left.
+        Waiter* root{};
+        while (pairs != nullptr) {
+            auto* next = pairs->sibling;
+            pairs->sibling = nullptr;
+            root = meld(root, pairs);
+            pairs = next;
+        }
+
+        return root;
+    }
+
+    Waiter* m_pollHead{};
+    Waiter* m_pollTail{};
+    Waiter* m_timers{};
+};
+
+/// Represents wakeup of the scheduler thread, which is blocked waiting for work. It is shared by the TaskScheduler
+/// and the FiberScheduler.
+/// @note Wakeup is signaled at most once until the scheduler thread wakes up, so that it doesn't accumulate. Thus
+///       notify() has to be called whenever new work appears (e.g. spawned task or released object).
+class Wakeup {
+public:
+    /// Wakes up the scheduler thread, if it is blocked waiting for work.
+    void notify()
+    {
+        if (!m_notified.exchange(true))
+            m_semaphore.signal();
+    }
+
+    /// Blocks the calling thread until it is notified or the given waiters have to be checked again.
+    /// @tparam Waiter          Type of the waiter.
+    /// @param waiters          Set of the waiters suspended by the scheduler.
+    /// @param pollInterval     Interval between checks of the waiters for objects.
+    template <typename Waiter>
+    void idle(const WaiterSet<Waiter>& waiters, Duration pollInterval)
+    {
+        m_semaphore.timedWait(Timeout(waiters.nextCheck(pollInterval)));
+
+        // Anything notified before this point is going to be noticed by the next iteration of the scheduler loop.
+        m_notified.store(false);
+    }
+
+private:
+    Semaphore m_semaphore{0};
+    std::atomic<bool> m_notified{};
+};
+
+} // namespace detail
+} // namespace osal
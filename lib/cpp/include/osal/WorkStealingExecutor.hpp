@@ -0,0 +1,687 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "osal/Error.hpp"
+#include "osal/Mutex.hpp"
+#include "osal/ScopedLock.hpp"
+#include "osal/Semaphore.hpp"
+#include "osal/Thread.hpp"
+#include "osal/ThreadPool.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string_view>
+#include <system_error>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace osal {
+
+template <std::size_t cWorkers,
+          std::size_t cQueueSize,
+          OsalThreadPriority cPriority,
+          std::size_t cStackSize,
+          std::size_t cTaskSize>
+class WorkStealingExecutor;
+
+namespace detail {
+
+/// Represents bounded Chase-Lev work-stealing deque of pointers.
+/// @tparam T                   Type of the objects pointed to by the deque elements.
+/// @tparam cCapacity           Maximal number of elements in the deque. It has to be a power of 2.
+/// @note Only the owner can push() and take() elements (LIFO). All other threads can only steal() them (FIFO).
+/// @note This is the C11 formulation by Le, Pop, Cohen and Zappa Nardelli, but without growing of the buffer.
+template <typename T, std::size_t cCapacity>
+class ChaseLevDeque {
+    static_assert(cCapacity > 0 && (cCapacity & (cCapacity - 1)) == 0, "Capacity has to be a power of 2");
+
+public:
+    /// Puts new element at the bottom of the deque.
+    /// @param item             Element to be pushed.
+    /// @return Flag indicating if element has been pushed (false means, that deque is full).
+    /// @note This function can be called only by the owner of the deque.
+    bool push(T* item)
+    {
+        auto bottom = m_bottom.load(std::memory_order_relaxed);
+        auto top = m_top.load(std::memory_order_acquire);
+        if (bottom - top >= static_cast<std::int64_t>(cCapacity))
+            return false;
+
+        m_buffer[static_cast<std::size_t>(bottom) & cMask].store(item, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    /// Takes the most recently pushed element from the bottom of the deque.
+    /// @return Taken element or nullptr if deque is empty.
+    /// @note This function can be called only by the owner of the deque.
+    T* take()
+    {
+        auto bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+        m_bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        auto top = m_top.load(std::memory_order_relaxed);
+
+        T* item = nullptr;
+        if (top <= bottom) {
+            item = m_buffer[static_cast<std::size_t>(bottom) & cMask].load(std::memory_order_relaxed);
+            if (top == bottom) {
+                // Last element can be concurrently stolen, so the race is resolved on the top index.
+                if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                    item = nullptr;
+
+                m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            }
+        }
+        else {
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+
+        return item;
+    }
+
+    /// Steals the oldest element from the top of the deque.
+    /// @return Stolen element or nullptr if deque is empty or race with other thread has been lost.
+    /// @note This function can be called by any thread.
+    T* steal()
+    {
+        auto top = m_top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        auto bottom = m_bottom.load(std::memory_order_acquire);
+        if (top >= bottom)
+            return nullptr;
+
+        auto* item = m_buffer[static_cast<std::size_t>(top) & cMask].load(std::memory_order_relaxed);
+        if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            return nullptr;
+
+        return item;
+    }
+
+    /// Checks if deque is empty.
+    /// @return Flag indicating if deque is empty.
+    /// @note Result is only a snapshot and may be outdated right after the call.
+    [[nodiscard]] bool empty() const
+    {
+        return m_top.load(std::memory_order_acquire) >= m_bottom.load(std::memory_order_acquire);
+    }
+
+private:
+    static constexpr std::size_t cMask = cCapacity - 1;
+
+    alignas(64) std::atomic<std::int64_t> m_top{};
+    alignas(64) std::atomic<std::int64_t> m_bottom{};
+    alignas(64) std::array<std::atomic<T*>, cCapacity> m_buffer{};
+};
+
+} // namespace detail
+
+/// Represents group of tasks submitted to the WorkStealingExecutor, which can be waited for as a whole.
+/// @note This is the join part of the fork/join model. Group can be reused once all its tasks are finished.
+class TaskGroup {
+public:
+    /// Default constructor.
+    TaskGroup() = default;
+
+    /// Copy constructor.
+    /// @note This constructor is deleted, because TaskGroup is not meant to be copy-constructed.
+    TaskGroup(const TaskGroup&) = delete;
+
+    /// Move constructor.
+    /// @note This constructor is deleted, because executor keeps reference to the group.
+    TaskGroup(TaskGroup&&) = delete;
+
+    /// Destructor.
+    ~TaskGroup() = default;
+
+    /// Copy assignment operator.
+    /// @return Reference to self.
+    /// @note This operator is deleted, because TaskGroup is not meant to be copy-assigned.
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    /// Move assignment operator.
+    /// @return Reference to self.
+    /// @note This operator is deleted, because TaskGroup is not meant to be move-assigned.
+    TaskGroup& operator=(TaskGroup&&) = delete;
+
+    /// Returns number of tasks from this group, which are not finished yet.
+    /// @return Number of tasks from this group, which are not finished yet.
+    [[nodiscard]] std::size_t pending() const { return m_state.load() & ~cWaitingFlag; }
+
+private:
+    template <std::size_t, std::size_t, OsalThreadPriority, std::size_t, std::size_t>
+    friend class WorkStealingExecutor;
+
+    /// Flag set in the state, when there is a thread blocked until all tasks are finished.
+    static constexpr std::size_t cWaitingFlag = std::size_t{1} << (sizeof(std::size_t) * 8 - 1);
+
+    /// Registers new task in the group.
+    void add() { m_state.fetch_add(1); }
+
+    /// Marks one task from the group as finished.
+    /// @note Group must not be accessed after the last task is finished, unless there is a blocked waiter, because
+    ///       the owner is free to destroy it.
+    void finish()
+    {
+        if (m_state.fetch_sub(1) == (cWaitingFlag | 1))
+            m_done.signal();
+    }
+
+    /// Blocks the caller until all tasks from the group are finished.
+    void block()
+    {
+        if ((m_state.fetch_or(cWaitingFlag) & ~cWaitingFlag) != 0)
+            m_done.wait();
+
+        m_state.store(0);
+    }
+
+    std::atomic<std::size_t> m_state{};
+    Semaphore m_done{0};
+};
+
+/// Represents pool of worker threads, which execute tasks using the work-stealing scheduling.
+/// @tparam cWorkers            Number of worker threads.
+/// @tparam cQueueSize          Capacity of the deque owned by each worker and of the queue for external submissions.
+///                             It has to be a power of 2.
+/// @tparam cPriority           Priority of the worker threads.
+/// @tparam cStackSize          Stack size of the worker threads.
+/// @tparam cTaskSize           Size of the inline storage for a single task (function and its arguments).
+/// @note Tasks submitted from the worker thread are pushed to its own deque and executed in LIFO order. Idle workers
+///       steal the oldest tasks from random victims. Tasks submitted from other threads go through the shared queue.
+///       Workers with no work left are parked on the semaphore.
+/// @note If worker has no free space in its deque, then submitted task is executed immediately by the submitter.
+///       This way submission from the worker never blocks and memory usage stays bounded.
+/// @note All memory used by the executor is part of the object, so submitting tasks never allocates memory.
+template <std::size_t cWorkers,
+          std::size_t cQueueSize = 128,
+          OsalThreadPriority cPriority = cOsalThreadDefaultPriority,
+          std::size_t cStackSize = cOsalThreadDefaultStackSize,
+          std::size_t cTaskSize = cThreadPoolTaskSize>
+class WorkStealingExecutor {
+    static_assert(cWorkers > 0, "WorkStealingExecutor requires at least one worker");
+
+public:
+    /// Default constructor.
+    /// @note This constructor creates executor without any workers. It can be later started with start() method.
+    WorkStealingExecutor() = default;
+
+    /// Constructor.
+    /// @param namePrefix       Prefix of the worker thread names. Each name is suffixed with the worker index.
+    /// @note This constructor immediately starts all worker threads.
+    explicit WorkStealingExecutor(std::string_view namePrefix) { start(namePrefix); }
+
+    /// Copy constructor.
+    /// @note This constructor is deleted, because WorkStealingExecutor is not meant to be copy-constructed.
+    WorkStealingExecutor(const WorkStealingExecutor&) = delete;
+
+    /// Move constructor.
+    /// @note This constructor is deleted, because workers keep reference to the executor.
+    WorkStealingExecutor(WorkStealingExecutor&&) = delete;
+
+    /// Destructor.
+    /// @note This destructor gracefully shuts down the executor, so it blocks until all tasks are executed.
+    ~WorkStealingExecutor() { shutdown(); }
+
+    /// Copy assignment operator.
+    /// @return Reference to self.
+    /// @note This operator is deleted, because WorkStealingExecutor is not meant to be copy-assigned.
+    WorkStealingExecutor& operator=(const WorkStealingExecutor&) = delete;
+
+    /// Move assignment operator.
+    /// @return Reference to self.
+    /// @note This operator is deleted, because WorkStealingExecutor is not meant to be move-assigned.
+    WorkStealingExecutor& operator=(WorkStealingExecutor&&) = delete;
+
+    /// Starts all worker threads.
+    /// @param namePrefix       Prefix of the worker thread names. Each name is suffixed with the worker index.
+    /// @return Error code of the operation.
+    std::error_code start(std::string_view namePrefix = {})
+    {
+        if (m_startedWorkers != 0 || m_running.exchange(true))
+            return OsalError::eThreadAlreadyStarted;
+
+        std::error_code result;
+        for (std::size_t i = 0; i < cWorkers; ++i) {
+            // Each worker uses different seed, so that they don't choose the same victims.
+            m_workers[i].random = static_cast<std::uint32_t>(i + 1) * cRandomSeedStep;
+
+            auto name = detail::makeWorkerName(namePrefix, i);
+
+            auto error = m_threads[i].start(std::string_view(name.data()), [this, i] { workerLoop(i); });
+            if (error && error != OsalError::eSchedulingFallback) {
+                shutdown();
+                return error;
+            }
+
+            ++m_startedWorkers;
+            if (error)
+                result = error;
+        }
+
+        return result;
+    }
+
+    /// Gracefully shuts down the executor. New tasks are rejected, already submitted tasks are executed and all
+    /// worker threads are joined.
+    /// @return Error code of the operation.
+    std::error_code shutdown()
+    {
+        {
+            // Submitters publish to the shared queue only while running, so no task is added after the drain below.
+            ScopedLock lock(m_injectionMutex);
+            if (!m_running.exchange(false))
+                return OsalError::eOk;
+        }
+
+        m_wakeup.signal(static_cast<unsigned int>(m_startedWorkers));
+        for (std::size_t i = 0; i < m_startedWorkers; ++i)
+            m_threads[i].join();
+
+        // Tasks submitted concurrently with the shutdown could be left in the shared queue.
+        while (m_injectionCount.load() != 0) {
+            auto* task = m_injectionQueue[m_injectionHead];
+            m_injectionHead = (m_injectionHead + 1) % cQueueSize;
+            m_injectionCount.fetch_sub(1);
+            execute(task);
+        }
+
+        return OsalError::eOk;
+    }
+
+    /// Submits the given task for execution.
+    /// @tparam Function        Type of user function to be executed.
+    /// @tparam Args            Types of user arguments to be passed to the user function.
+    /// @param function         User function to be executed.
+    /// @param args             User arguments to be passed to the user function.
+    /// @return Error code of the operation.
+    /// @note If called from other thread than worker and shared queue is full, then the caller is blocked until
+    ///       there is free space.
+    template <typename Function, typename... Args>
+        requires std::invocable<std::decay_t<Function>, std::decay_t<Args>...>
+    std::error_code submit(Function&& function, Args&&... args)
+    {
+        return enqueue(nullptr, std::forward<Function>(function), std::forward<Args>(args)...);
+    }
+
+    /// Submits the given task for execution as part of the given group.
+    /// @tparam Function        Type of user function to be executed.
+    /// @tparam Args            Types of user arguments to be passed to the user function.
+    /// @param group            Group, to which the task belongs.
+    /// @param function         User function to be executed.
+    /// @param args             User arguments to be passed to the user function.
+    /// @return Error code of the operation.
+    /// @note If called from other thread than worker and shared queue is full, then the caller is blocked until
+    ///       there is free space.
+    template <typename Function, typename... Args>
+        requires std::invocable<std::decay_t<Function>, std::decay_t<Args>...>
+    std::error_code submit(TaskGroup& group, Function&& function, Args&&... args)
+    {
+        return enqueue(&group, std::forward<Function>(function), std::forward<Args>(args)...);
+    }
+
+    /// Waits until all tasks from the given group are finished.
+    /// @param group            Group to be waited for.
+    /// @return Error code of the operation.
+    /// @note When called from the worker thread, it executes other tasks while waiting, so that nested fork/join
+    ///       never deadlocks. Other threads are blocked on the semaphore.
+    std::error_code wait(TaskGroup& group)
+    {
+        auto* self = currentWorker();
+        if (self == nullptr) {
+            group.block();
+            return OsalError::eOk;
+        }
+
+        while (group.pending() != 0) {
+            if (auto* task = findWork(self))
+                execute(task);
+            else
+                thread::yield();
+        }
+
+        return OsalError::eOk;
+    }
+
+    /// Returns number of worker threads in the executor.
+    /// @return Number of worker threads in the executor.
+    [[nodiscard]] static constexpr std::size_t workersCount() { return cWorkers; }
+
+private:
+    /// Odd constant used to spread seeds of the random generators of the workers.
+    static constexpr std::uint32_t cRandomSeedStep = 0x9e3779b9;
+
+    /// Represents single task stored in the executor.
+    struct Task {
+        alignas(std::max_align_t) std::array<std::byte, cTaskSize> storage;
+        void (*run)(void*);
+        TaskGroup* group;
+        bool injected;
+        std::atomic<bool> busy;
+    };
+
+    /// Represents state of the single worker.
+    struct Worker {
+        detail::ChaseLevDeque<Task, cQueueSize> deque;
+        std::array<Task, cQueueSize> tasks{};
+        std::size_t nextTask{};
+        std::uint32_t random{};
+        std::atomic<std::uint32_t> id{};
+        std::atomic<bool> ready{};
+    };
+
+    /// Runs the task stored in the given memory and destroys it.
+    /// @tparam TaskType        Type of the stored task.
+    /// @param storage          Memory with the stored task.
+    template <typename TaskType>
+    static void runTask(void* storage)
+    {
+        auto* task = std::launder(reinterpret_cast<TaskType*>(storage));
+        std::apply(
+            [](auto&& function, auto&&... args) {
+                std::invoke(std::forward<decltype(function)>(function), std::forward<decltype(args)>(args)...);
+            },
+            std::move(*task));
+        std::destroy_at(task);
+    }
+
+    /// Returns state of the worker, which is the calling thread.
+    /// @return State of the worker, which is the calling thread or nullptr if caller is not a worker.
+    Worker* currentWorker()
+    {
+        auto id = thread::id();
+        for (auto& worker : m_workers) {
+            if (worker.ready.load(std::memory_order_acquire) && worker.id.load(std::memory_order_relaxed) == id)
+                return &worker;
+        }
+
+        return nullptr;
+    }
+
+    /// Creates new task from the given function and arguments and schedules it for execution.
+    /// @tparam Function        Type of user function to be executed.
+    /// @tparam Args            Types of user arguments to be passed to the user function.
+    /// @param group            Group, to which the task belongs (can be nullptr).
+    /// @param function         User function to be executed.
+    /// @param args             User arguments to be passed to the user function.
+    /// @return Error code of the operation.
+    template <typename Function, typename... Args>
+    std::error_code enqueue(TaskGroup* group, Function&& function, Args&&... args)
+    {
+        using TaskType = std::tuple<std::decay_t<Function>, std::decay_t<Args>...>;
+        static_assert(sizeof(TaskType) <= cTaskSize, "Task doesn't fit into the inline storage, increase cTaskSize");
+        static_assert(alignof(TaskType) <= alignof(std::max_align_t), "Task requires unsupported alignment");
+
+        if (!m_running.load())
+            return OsalError::eInvalidArgument;
+
+        auto* self = currentWorker();
+        if (self == nullptr)
+            return inject(group, std::forward<Function>(function), std::forward<Args>(args)...);
+
+        auto* task = allocateLocal(*self);
+        if (task == nullptr) {
+            // Worker has no free task slots, so the task is executed immediately by the submitter.
+            std::invoke(std::forward<Function>(function), std::forward<Args>(args)...);
+            return OsalError::eOk;
+        }
+
+        prepare(task, group, std::forward<Function>(function), std::forward<Args>(args)...);
+        if (!self->deque.push(task)) {
+            execute(task);
+            return OsalError::eOk;
+        }
+
+        notify();
+        return OsalError::eOk;
+    }
+
+    /// Creates new task from the given function and arguments and publishes it in the shared queue. If there is no
+    /// free slot, then the caller is blocked until some task is finished.
+    /// @tparam Function        Type of user function to be executed.
+    /// @tparam Args            Types of user arguments to be passed to the user function.
+    /// @param group            Group, to which the task belongs (can be nullptr).
+    /// @param function         User function to be executed.
+    /// @param args             User arguments to be passed to the user function.
+    /// @return Error code of the operation.
+    /// @note If executor is shut down while the caller waits for the free slot, then OsalError::eInvalidArgument is
+    ///       returned and task is not executed.
+    template <typename Function, typename... Args>
+    std::error_code inject(TaskGroup* group, Function&& function, Args&&... args)
+    {
+        m_injectionFree.wait();
+
+        {
+            ScopedLock lock(m_injectionMutex);
+            if (!m_running.load()) {
+                m_injectionFree.signal();
+                return OsalError::eInvalidArgument;
+            }
+
+            auto* task = allocateInjected();
+            prepare(task, group, std::forward<Function>(function), std::forward<Args>(args)...);
+            m_injectionQueue[m_injectionTail] = task;
+            m_injectionTail = (m_injectionTail + 1) % cQueueSize;
+            m_injectionCount.fetch_add(1);
+        }
+
+        notify();
+        return OsalError::eOk;
+    }
+
+    /// Stores the given function and arguments in the given task slot.
+    /// @tparam Function        Type of user function to be executed.
+    /// @tparam Args            Types of user arguments to be passed to the user function.
+    /// @param task             Task slot to be filled.
+    /// @param group            Group, to which the task belongs (can be nullptr).
+    /// @param function         User function to be executed.
+    /// @param args             User arguments to be passed to the user function.
+    template <typename Function, typename... Args>
+    void prepare(Task* task, TaskGroup* group, Function&& function, Args&&... args)
+    {
+        using TaskType = std::tuple<std::decay_t<Function>, std::decay_t<Args>...>;
+        std::construct_at(reinterpret_cast<TaskType*>(task->storage.data()),
+                          std::forward<Function>(function),
+                          std::forward<Args>(args)...);
+        task->run = runTask<TaskType>;
+        task->group = group;
+        if (group != nullptr)
+            group->add();
+    }
+
+    /// Allocates task slot owned by the given worker.
+    /// @param worker           Worker, which allocates the slot.
+    /// @return Allocated task slot or nullptr if there is no free slot.
+    /// @note Slots are allocated only by their owner, but can be released by any thread, that executed the task.
+    Task* allocateLocal(Worker& worker)
+    {
+        for (std::size_t i = 0; i < cQueueSize; ++i) {
+            auto& task = worker.tasks[(worker.nextTask + i) % cQueueSize];
+            if (!task.busy.load(std::memory_order_acquire)) {
+                worker.nextTask = (worker.nextTask + i + 1) % cQueueSize;
+                task.injected = false;
+                task.busy.store(true, std::memory_order_relaxed);
+                return &task;
+            }
+        }
+
+        return nullptr;
+    }
+
+    /// Allocates task slot for the submission from outside of the executor.
+    /// @return Allocated task slot.
+    /// @note Caller has to take a token from m_injectionFree and lock m_injectionMutex before calling this function.
+    Task* allocateInjected()
+    {
+        for (auto& task : m_injectionTasks) {
+            if (!task.busy.load(std::memory_order_acquire)) {
+                task.injected = true;
+                task.busy.store(true, std::memory_order_relaxed);
+                return &task;
+            }
+        }
+
+        // Semaphore guarantees, that there is at least one free slot.
+        return nullptr;
+    }
+
+    /// Finds task to be executed by the given worker. Own deque is checked first, then the shared queue and finally
+    /// random victims are chosen to steal from.
+    /// @param self             Worker looking for the work.
+    /// @return Task to be executed or nullptr if there is no work.
+    Task* findWork(Worker* self)
+    {
+        if (auto* task = self->deque.take())
+            return task;
+
+        if (m_injectionCount.load() != 0) {
+            ScopedLock lock(m_injectionMutex);
+            if (m_injectionCount.load() != 0) {
+                auto* task = m_injectionQueue[m_injectionHead];
+                m_injectionHead = (m_injectionHead + 1) % cQueueSize;
+                m_injectionCount.fetch_sub(1);
+                return task;
+            }
+        }
+
+        // Xorshift generator is enough to spread victims, which is all that random stealing needs.
+        self->random ^= self->random << 13U;
+        self->random ^= self->random >> 17U;
+        self->random ^= self->random << 5U;
+        for (std::size_t i = 0; i < cWorkers; ++i) {
+            auto& victim = m_workers[(self->random + i) % cWorkers];
+            if (&victim == self)
+                continue;
+
+            if (auto* task = victim.deque.steal())
+                return task;
+        }
+
+        return nullptr;
+    }
+
+    /// Checks if there is any work waiting for execution.
+    /// @return Flag indicating if there is any work waiting for execution.
+    bool hasWork()
+    {
+        if (m_injectionCount.load() != 0)
+            return true;
+
+        return std::any_of(m_workers.begin(), m_workers.end(), [](const Worker& worker) {
+            return !worker.deque.empty();
+        });
+    }
+
+    /// Executes the given task and releases its slot.
+    /// @param task             Task to be executed.
+    void execute(Task* task)
+    {
+        auto* group = task->group;
+        auto injected = task->injected;
+        task->run(task->storage.data());
+        task->busy.store(false, std::memory_order_release);
+
+        if (injected)
+            m_injectionFree.signal();
+
+        if (group != nullptr)
+            group->finish();
+    }
+
+    /// Wakes up one parked worker, if there is any.
+    void notify()
+    {
+        // Pairs with the increment of the sleepers in the worker loop, so that either submitter sees the sleeper or
+        // the sleeper sees the new task.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_sleeping.load() != 0)
+            m_wakeup.signal();
+    }
+
+    /// Main loop of each worker thread.
+    /// @param index            Index of the worker.
+    void workerLoop(std::size_t index)
+    {
+        auto& self = m_workers[index];
+        self.id.store(thread::id(), std::memory_order_relaxed);
+        self.ready.store(true, std::memory_order_release);
+
+        while (true) {
+            if (auto* task = findWork(&self)) {
+                execute(task);
+                continue;
+            }
+
+            m_sleeping.fetch_add(1);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (hasWork()) {
+                m_sleeping.fetch_sub(1);
+                continue;
+            }
+
+            if (!m_running.load()) {
+                m_sleeping.fetch_sub(1);
+                return;
+            }
+
+            // Wakeups are not matched with sleepers, so spurious one only results in another search for work.
+            m_wakeup.wait();
+            m_sleeping.fetch_sub(1);
+        }
+    }
+
+    std::array<Worker, cWorkers> m_workers;
+    std::array<Thread<cPriority, cStackSize>, cWorkers> m_threads;
+    std::array<Task, cQueueSize> m_injectionTasks{};
+    std::array<Task*, cQueueSize> m_injectionQueue{};
+    Mutex m_injectionMutex;
+    Semaphore m_injectionFree{static_cast<unsigned int>(cQueueSize)};
+    std::size_t m_injectionHead{};
+    std::size_t m_injectionTail{};
+    std::atomic<std::size_t> m_injectionCount{};
+    Semaphore m_wakeup{0};
+    std::atomic<std::size_t> m_sleeping{};
+    std::atomic<bool> m_running{};
+    std::size_t m_startedWorkers{};
+};
+
+} // namespace osal
@@ -32,6 +32,8 @@
 
 #pragma once
 
+#include "osal/init.h"
+
 namespace osal {
 
 /// Initializes OSAL internal modules.
@@ -40,4 +42,15 @@ namespace osal {
 /// @retval false           Some errors occurred during the initialization. OSAL may not be functional.
 bool init();
 
+/// Initializes OSAL internal modules and applies the given real-time configuration of the process.
+/// @param config           Real-time configuration to be applied.
+/// @param report           Optional output argument where the outcome of the configuration will be stored.
+/// @return Flag indicating if the initialization was successful.
+/// @retval true            Initialization was successful and all requested options have been applied.
+/// @retval false           Some errors occurred during the initialization or some of the requested options couldn't
+///                         be applied.
+/// @note This function is meant to be called once, at the beginning of the main thread, before other threads are
+///       started.
+bool init(const OsalInitConfig& config, OsalInitReport* report = nullptr);
+
 } // namespace osal
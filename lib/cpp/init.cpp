@@ -41,4 +41,9 @@ bool init()
     return osalInit();
 }
 
+bool init(const OsalInitConfig& config, OsalInitReport* report)
+{
+    return osalInitEx(&config, report);
+}
+
 } // namespace osal
@@ -32,26 +32,57 @@
 
 #include "osal/Mutex.h"
 
+#include "osal/common/mutexStats.hpp"
+#include "osal/timestamp.h"
+#include "threadPriv.hpp"
+#include "timestampPriv.hpp"
+
 #include <FreeRTOSConfig.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/semphr.h>
+#include <freertos/task.h>
 
+#include <cstdint>
 #include <cstring>
 
 OsalError osalMutexCreate(OsalMutex* mutex, OsalMutexType type)
+{
+    return osalMutexCreateEx(mutex, {type, cOsalMutexDefaultProtocol, cOsalThreadDefaultPriority});
+}
+
+OsalError osalMutexCreateEx(OsalMutex* mutex, OsalMutexConfig config)
 {
     if (mutex == nullptr)
         return OsalError::eInvalidArgument;
 
     mutex->initialized = false;
 
+    int ceiling{};
+    switch (config.protocol) {
+        // FreeRTOS mutexes always use priority inheritance, so there is no way to disable it.
+        case OsalMutexProtocol::eNoPriorityProtocol: [[fallthrough]];
+        case OsalMutexProtocol::ePriorityInheritance: break;
+        case OsalMutexProtocol::ePriorityCeiling:
+            ceiling = toNativePriority(config.ceiling);
+            if (ceiling == -1)
+                return OsalError::eInvalidArgument;
+            break;
+        default: return OsalError::eInvalidArgument;
+    }
+
+    if (config.type == OsalMutexType::eAdaptive && config.protocol != OsalMutexProtocol::eNoPriorityProtocol)
+        return OsalError::eInvalidArgument;
+
+    auto type = config.type;
+
     SemaphoreHandle_t handle{};
 #if configSUPPORT_STATIC_ALLOCATION
     switch (type) {
     #if configUSE_RECURSIVE_MUTEXES
         case OsalMutexType::eRecursive: handle = xSemaphoreCreateRecursiveMutexStatic(&mutex->impl.buffer); break;
     #endif
-        case OsalMutexType::eNonRecursive: handle = xSemaphoreCreateMutexStatic(&mutex->impl.buffer); break;
+        case OsalMutexType::eNonRecursive: [[fallthrough]];
+        case OsalMutexType::eAdaptive: handle = xSemaphoreCreateMutexStatic(&mutex->impl.buffer); break;
         default: return OsalError::eInvalidArgument;
     }
 #elif configSUPPORT_DYNAMIC_ALLOCATION
@@ -59,7 +90,8 @@ OsalError osalMutexCreate(OsalMutex* mutex, OsalMutexType type)
     #if configUSE_RECURSIVE_MUTEXES
         case OsalMutexType::eRecursive: handle = xSemaphoreCreateRecursiveMutex(&mutex->impl.buffer); break;
     #endif
-        case OsalMutexType::eNonRecursive: handle = xSemaphoreCreateMutex(); break;
+        case OsalMutexType::eNonRecursive: [[fallthrough]];
+        case OsalMutexType::eAdaptive: handle = xSemaphoreCreateMutex(); break;
         default: return OsalError::eInvalidArgument;
     }
 #endif
@@ -68,16 +100,30 @@ OsalError osalMutexCreate(OsalMutex* mutex, OsalMutexType type)
         return OsalError::eOsError;
 
     mutex->impl.handle = handle;
+    mutex->impl.ceiling = ceiling;
+    mutex->impl.savedPriority = 0;
+    mutex->impl.lockCount = 0;
     mutex->initialized = true;
     mutex->type = type;
+    mutex->protocol = config.protocol;
+    mutex->stats = nullptr;
+    mutex->processShared = false;
     return OsalError::eOk;
 }
 
+OsalError osalMutexCreateShared(OsalMutex* mutex, OsalMutexConfig config)
+{
+    return osalMutexCreateEx(mutex, config);
+}
+
 OsalError osalMutexDestroy(OsalMutex* mutex)
 {
     if (mutex == nullptr || !mutex->initialized)
         return OsalError::eInvalidArgument;
 
+    if (mutex->stats != nullptr)
+        osalMutexDisableStats(mutex);
+
     vSemaphoreDelete(mutex->impl.handle);
     std::memset(mutex, 0, sizeof(OsalMutex));
     return OsalError::eOk;
@@ -86,7 +132,7 @@ OsalError osalMutexDestroy(OsalMutex* mutex)
 OsalError osalMutexLock(OsalMutex* mutex)
 {
     auto error = osalMutexTimedLock(mutex, portMAX_DELAY);
-    configASSERT(error == OsalError::eOk);
+    configASSERT(error != OsalError::eTimeout);
     return error;
 }
 
@@ -101,7 +147,7 @@ OsalError osalMutexTryLockIsr(OsalMutex* mutex)
     if (mutex == nullptr || !mutex->initialized)
         return OsalError::eInvalidArgument;
 
-    if (mutex->type == OsalMutexType::eRecursive)
+    if (mutex->type == OsalMutexType::eRecursive || mutex->protocol == OsalMutexProtocol::ePriorityCeiling)
         return OsalError::eInvalidArgument;
 
     if (xSemaphoreTakeFromISR(mutex->impl.handle, nullptr) == pdFALSE)
@@ -115,28 +161,69 @@ OsalError osalMutexTimedLock(OsalMutex* mutex, uint32_t timeoutMs)
     if (mutex == nullptr || !mutex->initialized)
         return OsalError::eInvalidArgument;
 
-    BaseType_t result{};
-    TickType_t tickTimeout = (timeoutMs == portMAX_DELAY) ? portMAX_DELAY : (timeoutMs / portTICK_PERIOD_MS);
+    bool ceilingProtocol = (mutex->protocol == OsalMutexProtocol::ePriorityCeiling);
+    if (ceilingProtocol && uxTaskPriorityGet(nullptr) > mutex->impl.ceiling)
+        return OsalError::eInvalidArgument;
 
-    if (mutex->type == OsalMutexType::eRecursive) {
+    auto take = [mutex](TickType_t ticks) {
+        BaseType_t result{};
+        if (mutex->type == OsalMutexType::eRecursive) {
 #if configUSE_RECURSIVE_MUTEXES
-        result = xSemaphoreTakeRecursive(mutex->impl.handle, tickTimeout);
+            result = xSemaphoreTakeRecursive(mutex->impl.handle, ticks);
 #endif
+        }
+        else
+            result = xSemaphoreTake(mutex->impl.handle, ticks);
+
+        return result;
+    };
+
+    TickType_t tickTimeout = (timeoutMs == portMAX_DELAY) ? portMAX_DELAY : (timeoutMs / portTICK_PERIOD_MS);
+
+    if (mutex->stats == nullptr) {
+        if (take(tickTimeout) == pdFALSE)
+            return OsalError::eTimeout;
     }
-    else
-        result = xSemaphoreTake(mutex->impl.handle, tickTimeout);
+    else {
+        // Contention is detected by the non-blocking attempt made before the actual wait.
+        std::uint64_t waitStartNs{};
+        bool contended = (take(0) == pdFALSE);
+        if (contended) {
+            waitStartNs = osalTimestampNs();
+            if (tickTimeout == 0 || take(tickTimeout) == pdFALSE)
+                return OsalError::eTimeout;
+        }
 
-    if (result == pdFALSE)
-        return OsalError::eTimeout;
+        mutexStatsOnLock(mutex->stats, contended, waitStartNs);
+    }
+
+    // Priority ceiling is emulated by raising priority of the owner for the whole time when mutex is locked.
+    if (ceilingProtocol && mutex->impl.lockCount++ == 0) {
+        mutex->impl.savedPriority = uxTaskPriorityGet(nullptr);
+        vTaskPrioritySet(nullptr, mutex->impl.ceiling);
+    }
 
     return OsalError::eOk;
 }
 
+OsalError osalMutexTimedLockUntil(OsalMutex* mutex, uint64_t deadlineNs)
+{
+    return osalMutexTimedLock(mutex, deadlineToTimeoutMs(deadlineNs));
+}
+
 OsalError osalMutexUnlock(OsalMutex* mutex)
 {
     if (mutex == nullptr || !mutex->initialized)
         return OsalError::eInvalidArgument;
 
+    bool restorePriority = (mutex->protocol == OsalMutexProtocol::ePriorityCeiling) && (--mutex->impl.lockCount == 0);
+    auto savedPriority = mutex->impl.savedPriority;
+
+    auto* stats = mutex->stats;
+    MutexStatsRelease release{};
+    if (stats != nullptr)
+        release = mutexStatsPrepareUnlock(stats);
+
     BaseType_t result{};
 
     if (mutex->type == OsalMutexType::eRecursive) {
@@ -150,6 +237,12 @@ OsalError osalMutexUnlock(OsalMutex* mutex)
     if (result == pdFALSE)
         return OsalError::eOsError;
 
+    if (stats != nullptr)
+        mutexStatsOnUnlock(stats, release);
+
+    if (restorePriority)
+        vTaskPrioritySet(nullptr, savedPriority);
+
     return OsalError::eOk;
 }
 
@@ -158,7 +251,7 @@ OsalError osalMutexUnlockIsr(OsalMutex* mutex)
     if (mutex == nullptr || !mutex->initialized)
         return OsalError::eInvalidArgument;
 
-    if (mutex->type == OsalMutexType::eRecursive)
+    if (mutex->type == OsalMutexType::eRecursive || mutex->protocol == OsalMutexProtocol::ePriorityCeiling)
         return OsalError::eInvalidArgument;
 
     if (xSemaphoreGiveFromISR(mutex->impl.handle, nullptr) == pdFALSE)
@@ -166,3 +259,12 @@ OsalError osalMutexUnlockIsr(OsalMutex* mutex)
 
     return OsalError::eOk;
 }
+
+OsalError osalMutexSetSpinBudget(OsalMutex* mutex, uint32_t /*unused*/)
+{
+    if (mutex == nullptr || !mutex->initialized || mutex->type != OsalMutexType::eAdaptive)
+        return OsalError::eInvalidArgument;
+
+    // Spinning on single-core system only delays the mutex owner, so adaptive mutex always blocks immediately.
+    return OsalError::eOk;
+}
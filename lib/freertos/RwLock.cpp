@@ -0,0 +1,292 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#include "osal/RwLock.h"
+
+#include "osal/timestamp.h"
+#include "timestampPriv.hpp"
+
+#include <FreeRTOSConfig.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <limits>
+
+/// Helper constant representing infinite deadline.
+static constexpr std::uint64_t cNoDeadline = std::numeric_limits<std::uint64_t>::max();
+
+/// Takes the given semaphore before the specified deadline.
+/// @param handle           Semaphore to be taken.
+/// @param deadlineNs       Absolute deadline of the operation or cNoDeadline for infinite wait.
+/// @return Flag indicating if semaphore has been taken.
+static bool take(SemaphoreHandle_t handle, std::uint64_t deadlineNs)
+{
+    TickType_t ticks = portMAX_DELAY;
+    if (deadlineNs != cNoDeadline)
+        ticks = deadlineToTimeoutMs(deadlineNs) / portTICK_PERIOD_MS;
+
+    return xSemaphoreTake(handle, ticks) == pdTRUE;
+}
+
+/// Locks the given reader-writer lock for reading.
+/// @param rwLock           Reader-writer lock to be locked.
+/// @param deadlineNs       Absolute deadline of the operation or cNoDeadline for infinite wait.
+/// @return Error code of the operation.
+static OsalError lockRead(OsalRwLock* rwLock, std::uint64_t deadlineNs)
+{
+    if (rwLock == nullptr || !rwLock->initialized)
+        return OsalError::eInvalidArgument;
+
+    auto& impl = rwLock->impl;
+    bool useGate = (rwLock->policy != OsalRwLockPolicy::ePreferReader);
+    if (useGate && !take(impl.readTry, deadlineNs))
+        return OsalError::eTimeout;
+
+    auto error = OsalError::eOk;
+    if (take(impl.readersMutex, deadlineNs)) {
+        // First reader locks the resource on behalf of the whole group of readers.
+        if (impl.readers++ == 0 && !take(impl.resource, deadlineNs)) {
+            --impl.readers;
+            error = OsalError::eTimeout;
+        }
+
+        xSemaphoreGive(impl.readersMutex);
+    }
+    else {
+        error = OsalError::eTimeout;
+    }
+
+    if (useGate)
+        xSemaphoreGive(impl.readTry);
+
+    return error;
+}
+
+/// Locks the given reader-writer lock for writing.
+/// @param rwLock           Reader-writer lock to be locked.
+/// @param deadlineNs       Absolute deadline of the operation or cNoDeadline for infinite wait.
+/// @return Error code of the operation.
+static OsalError lockWrite(OsalRwLock* rwLock, std::uint64_t deadlineNs)
+{
+    if (rwLock == nullptr || !rwLock->initialized)
+        return OsalError::eInvalidArgument;
+
+    auto& impl = rwLock->impl;
+    switch (rwLock->policy) {
+        case OsalRwLockPolicy::ePreferReader:
+            return take(impl.resource, deadlineNs) ? OsalError::eOk : OsalError::eTimeout;
+
+        case OsalRwLockPolicy::eFair: {
+            // Writer holds the gate while waiting for the active readers, so that new readers queue up behind it.
+            if (!take(impl.readTry, deadlineNs))
+                return OsalError::eTimeout;
+
+            bool locked = take(impl.resource, deadlineNs);
+            xSemaphoreGive(impl.readTry);
+            return locked ? OsalError::eOk : OsalError::eTimeout;
+        }
+
+        case OsalRwLockPolicy::ePreferWriter: {
+            // First waiting writer closes the gate for new readers and the last one opens it again.
+            if (!take(impl.writersMutex, deadlineNs))
+                return OsalError::eTimeout;
+
+            if (impl.writers++ == 0 && !take(impl.readTry, deadlineNs)) {
+                --impl.writers;
+                xSemaphoreGive(impl.writersMutex);
+                return OsalError::eTimeout;
+            }
+
+            xSemaphoreGive(impl.writersMutex);
+            if (take(impl.resource, deadlineNs))
+                return OsalError::eOk;
+
+            take(impl.writersMutex, cNoDeadline);
+            if (--impl.writers == 0)
+                xSemaphoreGive(impl.readTry);
+
+            xSemaphoreGive(impl.writersMutex);
+            return OsalError::eTimeout;
+        }
+
+        default: return OsalError::eInvalidArgument;
+    }
+}
+
+OsalError osalRwLockCreate(OsalRwLock* rwLock, OsalRwLockPolicy policy)
+{
+    if (rwLock == nullptr)
+        return OsalError::eInvalidArgument;
+
+    rwLock->initialized = false;
+
+    switch (policy) {
+        case OsalRwLockPolicy::ePreferReader: [[fallthrough]];
+        case OsalRwLockPolicy::ePreferWriter: [[fallthrough]];
+        case OsalRwLockPolicy::eFair: break;
+        default: return OsalError::eInvalidArgument;
+    }
+
+    auto& impl = rwLock->impl;
+#if configSUPPORT_STATIC_ALLOCATION
+    impl.resource = xSemaphoreCreateBinaryStatic(&impl.resourceBuffer);
+    impl.readTry = xSemaphoreCreateBinaryStatic(&impl.readTryBuffer);
+    impl.readersMutex = xSemaphoreCreateMutexStatic(&impl.readersMutexBuffer);
+    impl.writersMutex = xSemaphoreCreateMutexStatic(&impl.writersMutexBuffer);
+#elif configSUPPORT_DYNAMIC_ALLOCATION
+    impl.resource = xSemaphoreCreateBinary();
+    impl.readTry = xSemaphoreCreateBinary();
+    impl.readersMutex = xSemaphoreCreateMutex();
+    impl.writersMutex = xSemaphoreCreateMutex();
+#endif
+
+    if (impl.resource == nullptr || impl.readTry == nullptr || impl.readersMutex == nullptr
+        || impl.writersMutex == nullptr) {
+        for (auto* handle : {impl.resource, impl.readTry, impl.readersMutex, impl.writersMutex}) {
+            if (handle != nullptr)
+                vSemaphoreDelete(handle);
+        }
+
+        return OsalError::eOsError;
+    }
+
+    // Binary semaphores are created empty, so they have to be released to represent unlocked state.
+    xSemaphoreGive(impl.resource);
+    xSemaphoreGive(impl.readTry);
+
+    impl.readers = 0;
+    impl.writers = 0;
+    rwLock->policy = policy;
+    rwLock->initialized = true;
+    return OsalError::eOk;
+}
+
+OsalError osalRwLockDestroy(OsalRwLock* rwLock)
+{
+    if (rwLock == nullptr || !rwLock->initialized)
+        return OsalError::eInvalidArgument;
+
+    auto& impl = rwLock->impl;
+    vSemaphoreDelete(impl.resource);
+    vSemaphoreDelete(impl.readTry);
+    vSemaphoreDelete(impl.readersMutex);
+    vSemaphoreDelete(impl.writersMutex);
+    std::memset(rwLock, 0, sizeof(OsalRwLock));
+    return OsalError::eOk;
+}
+
+OsalError osalRwLockReadLock(OsalRwLock* rwLock)
+{
+    auto error = lockRead(rwLock, cNoDeadline);
+    configASSERT(error != OsalError::eTimeout);
+    return error;
+}
+
+OsalError osalRwLockReadTryLock(OsalRwLock* rwLock)
+{
+    auto error = lockRead(rwLock, 0);
+    return (error == OsalError::eTimeout) ? OsalError::eLocked : error;
+}
+
+OsalError osalRwLockReadTimedLock(OsalRwLock* rwLock, uint32_t timeoutMs)
+{
+    return lockRead(rwLock, osalTimestampNs() + osalMsToNs(timeoutMs));
+}
+
+OsalError osalRwLockReadTimedLockUntil(OsalRwLock* rwLock, uint64_t deadlineNs)
+{
+    return lockRead(rwLock, (deadlineNs == cNoDeadline) ? (deadlineNs - 1) : deadlineNs);
+}
+
+OsalError osalRwLockReadUnlock(OsalRwLock* rwLock)
+{
+    if (rwLock == nullptr || !rwLock->initialized)
+        return OsalError::eInvalidArgument;
+
+    auto& impl = rwLock->impl;
+    take(impl.readersMutex, cNoDeadline);
+
+    auto error = OsalError::eOk;
+    if (impl.readers == 0)
+        error = OsalError::eNotLocked;
+    else if (--impl.readers == 0)
+        xSemaphoreGive(impl.resource);
+
+    xSemaphoreGive(impl.readersMutex);
+    return error;
+}
+
+OsalError osalRwLockWriteLock(OsalRwLock* rwLock)
+{
+    auto error = lockWrite(rwLock, cNoDeadline);
+    configASSERT(error != OsalError::eTimeout);
+    return error;
+}
+
+OsalError osalRwLockWriteTryLock(OsalRwLock* rwLock)
+{
+    auto error = lockWrite(rwLock, 0);
+    return (error == OsalError::eTimeout) ? OsalError::eLocked : error;
+}
+
+OsalError osalRwLockWriteTimedLock(OsalRwLock* rwLock, uint32_t timeoutMs)
+{
+    return lockWrite(rwLock, osalTimestampNs() + osalMsToNs(timeoutMs));
+}
+
+OsalError osalRwLockWriteTimedLockUntil(OsalRwLock* rwLock, uint64_t deadlineNs)
+{
+    return lockWrite(rwLock, (deadlineNs == cNoDeadline) ? (deadlineNs - 1) : deadlineNs);
+}
+
+OsalError osalRwLockWriteUnlock(OsalRwLock* rwLock)
+{
+    if (rwLock == nullptr || !rwLock->initialized)
+        return OsalError::eInvalidArgument;
+
+    auto& impl = rwLock->impl;
+    if (xSemaphoreGive(impl.resource) == pdFALSE)
+        return OsalError::eNotLocked;
+
+    if (rwLock->policy == OsalRwLockPolicy::ePreferWriter) {
+        take(impl.writersMutex, cNoDeadline);
+        if (--impl.writers == 0)
+            xSemaphoreGive(impl.readTry);
+
+        xSemaphoreGive(impl.writersMutex);
+    }
+
+    return OsalError::eOk;
+}
@@ -32,13 +32,64 @@
 
 #include "osal/Semaphore.h"
 
+#include "timestampPriv.hpp"
+
 #include <FreeRTOSConfig.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/semphr.h>
+#include <freertos/task.h>
 
+#include <cstdint>
 #include <cstring>
 #include <limits>
 
+/// Helper constant representing infinite deadline.
+static constexpr std::uint64_t cNoDeadline = std::numeric_limits<std::uint64_t>::max();
+
+/// Takes the given semaphore before the specified deadline.
+/// @param handle           Semaphore to be taken.
+/// @param deadlineNs       Absolute deadline of the operation or cNoDeadline for infinite wait.
+/// @return Flag indicating if semaphore has been taken.
+static bool take(SemaphoreHandle_t handle, std::uint64_t deadlineNs)
+{
+    TickType_t ticks = portMAX_DELAY;
+    if (deadlineNs != cNoDeadline)
+        ticks = deadlineToTimeoutMs(deadlineNs) / portTICK_PERIOD_MS;
+
+    return xSemaphoreTake(handle, ticks) == pdTRUE;
+}
+
+/// Takes the given number of tokens from the semaphore before the specified deadline.
+/// @param semaphore        Semaphore to be decremented.
+/// @param count            Number of tokens to be taken.
+/// @param deadlineNs       Absolute deadline of the operation or cNoDeadline for infinite wait.
+/// @return Error code of the operation.
+/// @note If deadline is reached, then all already taken tokens are given back.
+static OsalError takeMany(OsalSemaphore* semaphore, unsigned int count, std::uint64_t deadlineNs)
+{
+    if (semaphore == nullptr || !semaphore->initialized || count == 0)
+        return OsalError::eInvalidArgument;
+
+    auto& impl = semaphore->impl;
+    if (count == 1)
+        return take(impl.handle, deadlineNs) ? OsalError::eOk : OsalError::eTimeout;
+
+    if (!take(impl.batchGate, deadlineNs))
+        return OsalError::eTimeout;
+
+    unsigned int taken = 0;
+    while (taken < count && take(impl.handle, deadlineNs))
+        ++taken;
+
+    if (taken != count) {
+        for (unsigned int i = 0; i < taken; ++i)
+            xSemaphoreGive(impl.handle);
+    }
+
+    xSemaphoreGive(impl.batchGate);
+    return (taken == count) ? OsalError::eOk : OsalError::eTimeout;
+}
+
 OsalError osalSemaphoreCreate(OsalSemaphore* semaphore, unsigned int initValue)
 {
     if (semaphore == nullptr)
@@ -47,26 +98,65 @@ OsalError osalSemaphoreCreate(OsalSemaphore* semaphore, unsigned int initValue)
     semaphore->initialized = false;
 
     SemaphoreHandle_t handle{};
+    SemaphoreHandle_t batchGate{};
 #if configSUPPORT_STATIC_ALLOCATION
     handle = xSemaphoreCreateCountingStatic(std::numeric_limits<BaseType_t>::max(), initValue, &semaphore->impl.buffer);
+    batchGate = xSemaphoreCreateBinaryStatic(&semaphore->impl.batchGateBuffer);
 #elif configSUPPORT_DYNAMIC_ALLOCATION
     handle = xSemaphoreCreateCounting(std::numeric_limits<BaseType_t>::max(), initValue);
+    batchGate = xSemaphoreCreateBinary();
 #endif
 
-    if (handle == nullptr)
+    if (handle == nullptr || batchGate == nullptr) {
+        if (handle != nullptr)
+            vSemaphoreDelete(handle);
+
+        if (batchGate != nullptr)
+            vSemaphoreDelete(batchGate);
+
         return OsalError::eOsError;
+    }
+
+    // Binary semaphores are created empty.
+    xSemaphoreGive(batchGate);
 
     semaphore->impl.handle = handle;
+    semaphore->impl.batchGate = batchGate;
+    semaphore->type = OsalSemaphoreType::eStandard;
     semaphore->initialized = true;
     return OsalError::eOk;
 }
 
+OsalError osalSemaphoreCreateEx(OsalSemaphore* semaphore, unsigned int initialValue, OsalSemaphoreType type)
+{
+    switch (type) {
+        case OsalSemaphoreType::eStandard: return osalSemaphoreCreate(semaphore, initialValue);
+        // FreeRTOS has no descriptors, which could be waited on together with other objects.
+        case OsalSemaphoreType::ePollable: return OsalError::eOsError;
+        default: return OsalError::eInvalidArgument;
+    }
+}
+
+OsalError osalSemaphoreCreateShared(OsalSemaphore* semaphore, unsigned int initialValue)
+{
+    return osalSemaphoreCreate(semaphore, initialValue);
+}
+
+OsalError osalSemaphoreNativeHandle(OsalSemaphore* semaphore, int* handle)
+{
+    if (semaphore == nullptr || !semaphore->initialized || handle == nullptr)
+        return OsalError::eInvalidArgument;
+
+    return OsalError::eOsError;
+}
+
 OsalError osalSemaphoreDestroy(OsalSemaphore* semaphore)
 {
     if (semaphore == nullptr || !semaphore->initialized)
         return OsalError::eInvalidArgument;
 
     vSemaphoreDelete(semaphore->impl.handle);
+    vSemaphoreDelete(semaphore->impl.batchGate);
     std::memset(semaphore, 0, sizeof(OsalSemaphore));
     return OsalError::eOk;
 }
@@ -78,12 +168,38 @@ OsalError osalSemaphoreWait(OsalSemaphore* semaphore)
     return error;
 }
 
+OsalError osalSemaphoreWaitMany(OsalSemaphore* semaphore, unsigned int count)
+{
+    auto error = takeMany(semaphore, count, cNoDeadline);
+    configASSERT(error != OsalError::eTimeout);
+    return error;
+}
+
 OsalError osalSemaphoreTryWait(OsalSemaphore* semaphore)
 {
     auto error = osalSemaphoreTimedWait(semaphore, 0);
     return (error == OsalError::eTimeout) ? OsalError::eLocked : error;
 }
 
+OsalError osalSemaphoreTryWaitMany(OsalSemaphore* semaphore, unsigned int count)
+{
+    if (semaphore == nullptr || !semaphore->initialized || count == 0)
+        return OsalError::eInvalidArgument;
+
+    // Checking the value and taking the tokens has to be atomic with respect to other tasks.
+    auto error = OsalError::eLocked;
+    taskENTER_CRITICAL();
+    if (uxSemaphoreGetCount(semaphore->impl.handle) >= count) {
+        for (unsigned int i = 0; i < count; ++i)
+            xSemaphoreTake(semaphore->impl.handle, 0);
+
+        error = OsalError::eOk;
+    }
+    taskEXIT_CRITICAL();
+
+    return error;
+}
+
 OsalError osalSemaphoreTryWaitIsr(OsalSemaphore* semaphore)
 {
     if (semaphore == nullptr || !semaphore->initialized)
@@ -107,6 +223,21 @@ OsalError osalSemaphoreTimedWait(OsalSemaphore* semaphore, uint32_t timeoutMs)
     return OsalError::eOk;
 }
 
+OsalError osalSemaphoreTimedWaitMany(OsalSemaphore* semaphore, unsigned int count, uint32_t timeoutMs)
+{
+    return osalSemaphoreTimedWaitManyUntil(semaphore, count, osalTimestampNs() + osalMsToNs(timeoutMs));
+}
+
+OsalError osalSemaphoreTimedWaitUntil(OsalSemaphore* semaphore, uint64_t deadlineNs)
+{
+    return osalSemaphoreTimedWait(semaphore, deadlineToTimeoutMs(deadlineNs));
+}
+
+OsalError osalSemaphoreTimedWaitManyUntil(OsalSemaphore* semaphore, unsigned int count, uint64_t deadlineNs)
+{
+    return takeMany(semaphore, count, deadlineNs);
+}
+
 OsalError osalSemaphoreSignal(OsalSemaphore* semaphore)
 {
     if (semaphore == nullptr || !semaphore->initialized)
@@ -118,6 +249,19 @@ OsalError osalSemaphoreSignal(OsalSemaphore* semaphore)
     return OsalError::eOk;
 }
 
+OsalError osalSemaphoreSignalMany(OsalSemaphore* semaphore, unsigned int count)
+{
+    if (semaphore == nullptr || !semaphore->initialized || count == 0)
+        return OsalError::eInvalidArgument;
+
+    for (unsigned int i = 0; i < count; ++i) {
+        if (xSemaphoreGive(semaphore->impl.handle) == pdFALSE)
+            return OsalError::eOsError;
+    }
+
+    return OsalError::eOk;
+}
+
 OsalError osalSemaphoreSignalIsr(OsalSemaphore* semaphore)
 {
     if (semaphore == nullptr || !semaphore->initialized)
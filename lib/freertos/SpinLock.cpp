@@ -0,0 +1,198 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#include "osal/SpinLock.h"
+
+#include <FreeRTOSConfig.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
+#if defined(configNUMBER_OF_CORES) && (configNUMBER_OF_CORES > 1)
+    #define OSAL_SPINLOCK_SMP 1
+#else
+    #define OSAL_SPINLOCK_SMP 0
+#endif
+
+/// Takes the ticket of the given spinlock and busy-waits until it is served.
+/// @param impl             Spinlock implementation to be locked.
+/// @note This function has to be called inside critical section.
+static void lockTicket([[maybe_unused]] SpinLockImpl* impl)
+{
+#if OSAL_SPINLOCK_SMP
+    auto ticket = std::atomic_ref(impl->next).fetch_add(1, std::memory_order_relaxed);
+    while (std::atomic_ref(impl->owner).load(std::memory_order_acquire) != ticket) {}
+#else
+    ++impl->next;
+#endif
+}
+
+/// Takes the ticket of the given spinlock if it can be served immediately.
+/// @param impl             Spinlock implementation to be locked.
+/// @return Flag indicating if spinlock has been locked.
+/// @note This function has to be called inside critical section.
+static bool tryLockTicket(SpinLockImpl* impl)
+{
+#if OSAL_SPINLOCK_SMP
+    auto owner = std::atomic_ref(impl->owner).load(std::memory_order_acquire);
+    auto expected = owner;
+    return std::atomic_ref(impl->next).compare_exchange_strong(expected, owner + 1, std::memory_order_acquire);
+#else
+    // On single core the spinlock can be locked only by ISR, which interrupted the current owner.
+    if (impl->next != impl->owner)
+        return false;
+
+    ++impl->next;
+    return true;
+#endif
+}
+
+/// Serves the next ticket of the given spinlock.
+/// @param impl             Spinlock implementation to be unlocked.
+/// @return Error code of the operation.
+/// @note This function has to be called inside critical section.
+static OsalError unlockTicket(SpinLockImpl* impl)
+{
+    std::atomic_ref owner(impl->owner);
+    auto current = owner.load(std::memory_order_relaxed);
+    if (current == std::atomic_ref(impl->next).load(std::memory_order_relaxed))
+        return OsalError::eNotLocked;
+
+    owner.store(current + 1, std::memory_order_release);
+    return OsalError::eOk;
+}
+
+OsalError osalSpinLockCreate(OsalSpinLock* spinLock, OsalSpinLockType type)
+{
+    if (spinLock == nullptr)
+        return OsalError::eInvalidArgument;
+
+    spinLock->initialized = false;
+
+    switch (type) {
+        case OsalSpinLockType::eTicket: [[fallthrough]];
+        case OsalSpinLockType::eMcs: break;
+        default: return OsalError::eInvalidArgument;
+    }
+
+    spinLock->impl = SpinLockImpl{};
+    spinLock->type = type;
+    spinLock->initialized = true;
+    return OsalError::eOk;
+}
+
+OsalError osalSpinLockDestroy(OsalSpinLock* spinLock)
+{
+    if (spinLock == nullptr || !spinLock->initialized)
+        return OsalError::eInvalidArgument;
+
+    std::memset(spinLock, 0, sizeof(OsalSpinLock));
+    return OsalError::eOk;
+}
+
+OsalError osalSpinLockLock(OsalSpinLock* spinLock)
+{
+    if (spinLock == nullptr || !spinLock->initialized)
+        return OsalError::eInvalidArgument;
+
+    taskENTER_CRITICAL();
+    lockTicket(&spinLock->impl);
+    return OsalError::eOk;
+}
+
+OsalError osalSpinLockTryLock(OsalSpinLock* spinLock)
+{
+    if (spinLock == nullptr || !spinLock->initialized)
+        return OsalError::eInvalidArgument;
+
+    taskENTER_CRITICAL();
+    if (!tryLockTicket(&spinLock->impl)) {
+        taskEXIT_CRITICAL();
+        return OsalError::eLocked;
+    }
+
+    return OsalError::eOk;
+}
+
+OsalError osalSpinLockUnlock(OsalSpinLock* spinLock)
+{
+    if (spinLock == nullptr || !spinLock->initialized)
+        return OsalError::eInvalidArgument;
+
+    auto error = unlockTicket(&spinLock->impl);
+    if (error == OsalError::eOk)
+        taskEXIT_CRITICAL();
+
+    return error;
+}
+
+OsalError osalSpinLockLockIsr(OsalSpinLock* spinLock)
+{
+    if (spinLock == nullptr || !spinLock->initialized)
+        return OsalError::eInvalidArgument;
+
+    auto status = taskENTER_CRITICAL_FROM_ISR();
+    lockTicket(&spinLock->impl);
+    spinLock->impl.savedInterruptStatus = status;
+    return OsalError::eOk;
+}
+
+OsalError osalSpinLockTryLockIsr(OsalSpinLock* spinLock)
+{
+    if (spinLock == nullptr || !spinLock->initialized)
+        return OsalError::eInvalidArgument;
+
+    auto status = taskENTER_CRITICAL_FROM_ISR();
+    if (!tryLockTicket(&spinLock->impl)) {
+        taskEXIT_CRITICAL_FROM_ISR(status);
+        return OsalError::eLocked;
+    }
+
+    spinLock->impl.savedInterruptStatus = status;
+    return OsalError::eOk;
+}
+
+OsalError osalSpinLockUnlockIsr(OsalSpinLock* spinLock)
+{
+    if (spinLock == nullptr || !spinLock->initialized)
+        return OsalError::eInvalidArgument;
+
+    auto status = spinLock->impl.savedInterruptStatus;
+    auto error = unlockTicket(&spinLock->impl);
+    if (error == OsalError::eOk)
+        taskEXIT_CRITICAL_FROM_ISR(status);
+
+    return error;
+}
@@ -0,0 +1,149 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#include "osal/StackPool.h"
+
+#include <FreeRTOSConfig.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+/// Number of stacks described by a single word of the free mask.
+static constexpr std::size_t cMaskBits = 64;
+
+OsalError osalStackPoolCreate(OsalStackPool* pool, OsalStackPoolConfig config)
+{
+    if (pool == nullptr || config.stackSize == 0 || config.count == 0 || config.count > cOsalStackPoolMaxStacks)
+        return OsalError::eInvalidArgument;
+
+    pool->initialized = false;
+
+#if configSUPPORT_DYNAMIC_ALLOCATION
+    // Stack size is expressed in StackType_t words, the same as in OsalThreadConfig. Guard pages require MMU, so
+    // they are not used.
+    auto slotSize = config.stackSize * sizeof(StackType_t);
+    auto* memory = pvPortMalloc(slotSize * config.count);
+    if (memory == nullptr)
+        return OsalError::eOsError;
+
+    std::memset(pool->freeMask, 0, sizeof(pool->freeMask));
+    for (std::size_t i = 0; i < config.count; ++i)
+        pool->freeMask[i / cMaskBits] |= std::uint64_t{1} << (i % cMaskBits);
+
+    pool->impl.memory = memory;
+    pool->impl.slotSize = slotSize;
+    pool->stackSize = config.stackSize;
+    pool->count = config.count;
+    pool->initialized = true;
+    return OsalError::eOk;
+#else
+    return OsalError::eOsError;
+#endif
+}
+
+OsalError osalStackPoolDestroy(OsalStackPool* pool)
+{
+    if (pool == nullptr || !pool->initialized)
+        return OsalError::eInvalidArgument;
+
+    for (std::size_t i = 0; i < pool->count; ++i) {
+        if ((pool->freeMask[i / cMaskBits] & (std::uint64_t{1} << (i % cMaskBits))) == 0)
+            return OsalError::eLocked;
+    }
+
+#if configSUPPORT_DYNAMIC_ALLOCATION
+    vPortFree(pool->impl.memory);
+#endif
+
+    std::memset(pool, 0, sizeof(OsalStackPool));
+    return OsalError::eOk;
+}
+
+OsalError osalStackPoolAcquire(OsalStackPool* pool, void** stack)
+{
+    if (pool == nullptr || !pool->initialized || stack == nullptr)
+        return OsalError::eInvalidArgument;
+
+    auto error = OsalError::eLocked;
+    taskENTER_CRITICAL();
+    for (std::size_t i = 0; i < (pool->count + cMaskBits - 1) / cMaskBits; ++i) {
+        if (pool->freeMask[i] == 0)
+            continue;
+
+        auto bit = static_cast<std::size_t>(std::countr_zero(pool->freeMask[i]));
+        pool->freeMask[i] &= ~(std::uint64_t{1} << bit);
+        *stack = static_cast<std::uint8_t*>(pool->impl.memory) + (((i * cMaskBits) + bit) * pool->impl.slotSize);
+        error = OsalError::eOk;
+        break;
+    }
+    taskEXIT_CRITICAL();
+
+    return error;
+}
+
+OsalError osalStackPoolRelease(OsalStackPool* pool, void* stack)
+{
+    if (pool == nullptr || !pool->initialized || stack == nullptr)
+        return OsalError::eInvalidArgument;
+
+    auto address = reinterpret_cast<std::uintptr_t>(stack);
+    auto base = reinterpret_cast<std::uintptr_t>(pool->impl.memory);
+    if (address < base || (address - base) % pool->impl.slotSize != 0)
+        return OsalError::eInvalidArgument;
+
+    auto index = (address - base) / pool->impl.slotSize;
+    if (index >= pool->count)
+        return OsalError::eInvalidArgument;
+
+    auto bit = std::uint64_t{1} << (index % cMaskBits);
+    auto error = OsalError::eInvalidArgument;
+    taskENTER_CRITICAL();
+    if ((pool->freeMask[index / cMaskBits] & bit) == 0) {
+        pool->freeMask[index / cMaskBits] |= bit;
+        error = OsalError::eOk;
+    }
+    taskEXIT_CRITICAL();
+
+    return error;
+}
+
+size_t osalStackPoolStackSize(const OsalStackPool* pool)
+{
+    if (pool == nullptr || !pool->initialized)
+        return 0;
+
+    return pool->stackSize;
+}
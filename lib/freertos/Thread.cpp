@@ -33,21 +33,78 @@
 #include "osal/Thread.h"
 
 #include "osal/Semaphore.h"
+#include "osal/common/threadRegistry.hpp"
+#include "osal/timestamp.h"
+#include "threadPriv.hpp"
 
 #include <FreeRTOSConfig.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 
 #include <algorithm>
+#include <cstdint>
 #include <cstring>
 
+#if defined(configNUMBER_OF_CORES) && (configNUMBER_OF_CORES > 1) && configUSE_CORE_AFFINITY
+    #define OSAL_CORE_AFFINITY 1
+#else
+    #define OSAL_CORE_AFFINITY 0
+#endif
+
+// Frequency of the run-time stats counter is application specific, so it has to be provided in FreeRTOSConfig.h.
+#if configUSE_TRACE_FACILITY && configGENERATE_RUN_TIME_STATS && defined(OSAL_RUN_TIME_COUNTER_HZ)
+    #define OSAL_RUN_TIME_STATS 1
+#else
+    #define OSAL_RUN_TIME_STATS 0
+#endif
+
+/// Converts OSAL CPU set to the FreeRTOS core affinity mask.
+/// @param cpus             OSAL CPU set to be converted.
+/// @param mask             Output argument where the core affinity mask will be stored.
+/// @return Flag indicating if the given CPU set contains only existing cores.
+static bool toCoreAffinityMask(const OsalCpuSet& cpus, UBaseType_t& mask)
+{
+#if OSAL_CORE_AFFINITY
+    constexpr std::uint32_t cCoresCount = configNUMBER_OF_CORES;
+#else
+    constexpr std::uint32_t cCoresCount = 1;
+#endif
+
+    mask = 0;
+    for (std::uint32_t cpu = 0; cpu < cOsalMaxCpus; ++cpu) {
+        if (!osalCpuSetContains(&cpus, cpu))
+            continue;
+
+        if (cpu >= cCoresCount)
+            return false;
+
+        mask |= (UBaseType_t(1) << cpu);
+    }
+
+    return true;
+}
+
 /// Helper thread function which is used as a wrapper for OSAL thread function.
 /// @param arg          Helper thread arguments.
-/// @note This function is used to implement thread joining.
+/// @note This function is used to implement thread joining and to register thread in the registry of live threads.
 static void threadWrapper(void* arg)
 {
     auto* params = static_cast<ThreadWrapperData*>(arg);
+
+    ThreadRegistryEntry entry{};
+    entry.info.id = osalThreadId();
+    entry.info.priority = static_cast<OsalThreadPriority>(params->priority);
+    entry.info.startTimestampNs = osalTimestampNs();
+    std::strncpy(entry.info.name, pcTaskGetName(nullptr), cOsalThreadInfoNameSize - 1);
+    threadRegistryAdd(&entry);
+
     params->func(params->arg);
+
+    taskENTER_CRITICAL();
+    params->finished = 1;
+    taskEXIT_CRITICAL();
+
+    threadRegistryRemove(&entry);
     osalSemaphoreSignal(&params->semaphore);
 }
 
@@ -62,27 +119,27 @@ osalThreadCreateEx(OsalThread* thread, OsalThreadConfig config, OsalThreadFuncti
     if (thread == nullptr || func == nullptr)
         return OsalError::eInvalidArgument;
 
-    if (name != nullptr && std::strlen(name) > (configMAX_TASK_NAME_LEN - 1))
+    if (name != nullptr && std::strlen(name) > (cOsalThreadNameSize - 1))
         return OsalError::eInvalidArgument;
 
     thread->initialized = false;
 
-    const auto cPriorityMin = 0;
-    const auto cPriorityMax = configMAX_PRIORITIES - 1;
-    const auto cPriorityStep = (cPriorityMax - cPriorityMin) / 4;
-
-    int priority{};
-    switch (config.priority) {
-        case OsalThreadPriority::eLowest: priority = cPriorityMin; break;
-        case OsalThreadPriority::eLow: priority = cPriorityMin + (cPriorityStep * 1); break;
-        case OsalThreadPriority::eNormal: priority = cPriorityMin + (cPriorityStep * 2); break;
-        case OsalThreadPriority::eHigh: priority = cPriorityMin + (cPriorityStep * 3); break;
-        case OsalThreadPriority::eHighest: priority = cPriorityMax; break;
-        default: return OsalError::eInvalidArgument;
-    }
+    auto priority = toNativePriority(config.priority);
+    if (priority == -1)
+        return OsalError::eInvalidArgument;
+
+    if (config.scheduling.policy > OsalThreadPolicy::ePolicyDeadline)
+        return OsalError::eInvalidArgument;
+
+    UBaseType_t coreMask{};
+    if (!toCoreAffinityMask(config.affinity, coreMask))
+        return OsalError::eInvalidArgument;
 
     thread->impl.params.func = func;
     thread->impl.params.arg = arg;
+    thread->impl.params.priority = config.priority;
+    thread->impl.params.finished = 0;
+    thread->impl.startTimestampNs = osalTimestampNs();
     osalSemaphoreCreate(&thread->impl.params.semaphore, 0);
 
 #if configSUPPORT_STATIC_ALLOCATION
@@ -104,7 +161,17 @@ osalThreadCreateEx(OsalThread* thread, OsalThreadConfig config, OsalThreadFuncti
         return OsalError::eOsError;
 #endif
 
+#if OSAL_CORE_AFFINITY
+    if (coreMask != 0)
+        vTaskCoreAffinitySet(thread->impl.handle, coreMask);
+#endif
+
     thread->initialized = true;
+
+    // FreeRTOS has no deadline scheduler, so such threads run with their fixed priority instead.
+    if (config.scheduling.policy == OsalThreadPolicy::ePolicyDeadline)
+        return OsalError::eSchedulingFallback;
+
     return OsalError::eOk;
 }
 
@@ -129,6 +196,70 @@ OsalError osalThreadJoin(OsalThread* thread)
     return osalSemaphoreWait(&thread->impl.params.semaphore);
 }
 
+OsalError osalThreadSetAffinity(OsalThread* thread, const OsalCpuSet* cpus)
+{
+    if (thread == nullptr || !thread->initialized || cpus == nullptr || osalCpuSetIsEmpty(cpus))
+        return OsalError::eInvalidArgument;
+
+    UBaseType_t coreMask{};
+    if (!toCoreAffinityMask(*cpus, coreMask))
+        return OsalError::eInvalidArgument;
+
+#if OSAL_CORE_AFFINITY
+    vTaskCoreAffinitySet(thread->impl.handle, coreMask);
+#endif
+    return OsalError::eOk;
+}
+
+OsalError osalThreadGetAffinity(OsalThread* thread, OsalCpuSet* cpus)
+{
+    if (thread == nullptr || !thread->initialized || cpus == nullptr)
+        return OsalError::eInvalidArgument;
+
+    osalCpuSetClear(cpus);
+#if OSAL_CORE_AFFINITY
+    auto coreMask = vTaskCoreAffinityGet(thread->impl.handle);
+    for (std::uint32_t cpu = 0; cpu < configNUMBER_OF_CORES; ++cpu) {
+        if ((coreMask & (UBaseType_t(1) << cpu)) != 0)
+            osalCpuSetAdd(cpus, cpu);
+    }
+#else
+    osalCpuSetAdd(cpus, 0);
+#endif
+    return OsalError::eOk;
+}
+
+OsalError osalThreadGetStats(OsalThread* thread, OsalThreadStats* stats)
+{
+    if (thread == nullptr || !thread->initialized || stats == nullptr)
+        return OsalError::eInvalidArgument;
+
+    // Task is deleted after its function returns, so its handle can't be used once the finished flag is set.
+    OsalThreadStats result{};
+    vTaskSuspendAll();
+    bool finished = (thread->impl.params.finished != 0);
+#if OSAL_RUN_TIME_STATS
+    TaskStatus_t status{};
+    if (!finished)
+        vTaskGetInfo(thread->impl.handle, &status, pdFALSE, eInvalid);
+#endif
+
+    xTaskResumeAll();
+    if (finished)
+        return OsalError::eOsError;
+
+#if OSAL_RUN_TIME_STATS
+    // Conversion is split to avoid overflow for 64-bit run-time counters.
+    auto counter = static_cast<std::uint64_t>(status.ulRunTimeCounter);
+    constexpr std::uint64_t cCounterHz = OSAL_RUN_TIME_COUNTER_HZ;
+    result.cpuTimeNs = osalSecToNs(counter / cCounterHz) + osalSecToNs(counter % cCounterHz) / cCounterHz;
+#endif
+
+    result.runtimeNs = osalTimestampNs() - thread->impl.startTimestampNs;
+    *stats = result;
+    return OsalError::eOk;
+}
+
 void osalThreadYield()
 {
     taskYIELD(); // NOLINT
@@ -139,6 +270,24 @@ uint32_t osalThreadId()
     return uint32_t(xTaskGetCurrentTaskHandle());
 }
 
+uint32_t osalThreadCurrentCpu()
+{
+#if defined(configNUMBER_OF_CORES) && (configNUMBER_OF_CORES > 1)
+    return portGET_CORE_ID();
+#else
+    return 0;
+#endif
+}
+
+uint32_t osalThreadCpuCount()
+{
+#if defined(configNUMBER_OF_CORES)
+    return configNUMBER_OF_CORES;
+#else
+    return 1;
+#endif
+}
+
 OsalError osalThreadName(char* name, size_t size)
 {
     auto* namePtr = pcTaskGetName(nullptr);
@@ -0,0 +1,123 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#include "osal/ThreadLocal.h"
+
+#include <FreeRTOSConfig.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include <array>
+#include <cstddef>
+
+#if configNUM_THREAD_LOCAL_STORAGE_POINTERS > 0
+/// Index of the next thread-local storage pointer to be assigned to the created OSAL slot.
+/// @note Indexes are never reused. FreeRTOS can't clear the pointer of the destroyed slot in all tasks, so the new
+///       slot with the same index would see stale values of a different type stored through the old one.
+static std::size_t nextIndex{};
+
+/// Destructors registered for each thread-local storage pointer.
+static std::array<void (*)(void*), configNUM_THREAD_LOCAL_STORAGE_POINTERS> destructors{};
+
+    #if defined(configTHREAD_LOCAL_STORAGE_DELETE_CALLBACKS) && configTHREAD_LOCAL_STORAGE_DELETE_CALLBACKS
+/// Called by FreeRTOS for each thread-local storage pointer of the deleted task.
+/// @param index            Index of the thread-local storage pointer.
+/// @param value            Value stored by the deleted task.
+static void deleteCallback(int index, void* value)
+{
+    auto* destructor = destructors[static_cast<std::size_t>(index)];
+    if (destructor != nullptr && value != nullptr)
+        destructor(value);
+}
+    #endif
+#endif
+
+OsalError osalThreadLocalCreate(OsalThreadLocal* local, [[maybe_unused]] void (*destructor)(void*))
+{
+    if (local == nullptr)
+        return OsalError::eInvalidArgument;
+
+    local->initialized = false;
+
+#if configNUM_THREAD_LOCAL_STORAGE_POINTERS > 0
+    auto error = OsalError::eOsError;
+    taskENTER_CRITICAL();
+    if (nextIndex < destructors.size()) {
+        destructors[nextIndex] = destructor;
+        local->impl.index = static_cast<int>(nextIndex++);
+        error = OsalError::eOk;
+    }
+    taskEXIT_CRITICAL();
+
+    local->initialized = (error == OsalError::eOk);
+    return error;
+#else
+    return OsalError::eOsError;
+#endif
+}
+
+OsalError osalThreadLocalDestroy(OsalThreadLocal* local)
+{
+    if (local == nullptr || !local->initialized)
+        return OsalError::eInvalidArgument;
+
+#if configNUM_THREAD_LOCAL_STORAGE_POINTERS > 0
+    // Index stays retired, only values left in the deleted tasks are no longer passed to the destructor.
+    taskENTER_CRITICAL();
+    destructors[static_cast<std::size_t>(local->impl.index)] = nullptr;
+    taskEXIT_CRITICAL();
+#endif
+
+    local->initialized = false;
+    return OsalError::eOk;
+}
+
+void* osalThreadLocalGet(const OsalThreadLocal* local)
+{
+    if (local == nullptr || !local->initialized)
+        return nullptr;
+
+    return pvTaskGetThreadLocalStoragePointer(nullptr, local->impl.index);
+}
+
+OsalError osalThreadLocalSet(OsalThreadLocal* local, void* value)
+{
+    if (local == nullptr || !local->initialized)
+        return OsalError::eInvalidArgument;
+
+#if defined(configTHREAD_LOCAL_STORAGE_DELETE_CALLBACKS) && configTHREAD_LOCAL_STORAGE_DELETE_CALLBACKS
+    vTaskSetThreadLocalStoragePointerAndDelCallback(nullptr, local->impl.index, value, deleteCallback);
+#else
+    vTaskSetThreadLocalStoragePointer(nullptr, local->impl.index, value);
+#endif
+    return OsalError::eOk;
+}
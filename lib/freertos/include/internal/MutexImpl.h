@@ -37,10 +37,33 @@
 #include <freertos/semphr.h>
 
 /// Helper class with concrete platform implementation of the mutex handle.
+/// @note FreeRTOS doesn't support priority ceiling natively, so it is emulated with "ceiling", "savedPriority"
+///       and "lockCount" fields, which are used only by mutexes with priority ceiling protocol.
 struct MutexImpl {
     SemaphoreHandle_t handle;
+    UBaseType_t ceiling;
+    UBaseType_t savedPriority;
+    UBaseType_t lockCount;
 
 #if configSUPPORT_STATIC_ALLOCATION
     StaticSemaphore_t buffer;
 #endif
 };
+
+/// Locks the given mutex if it is not locked by anyone. This is the uncontended fast path of the lock operation.
+/// @param impl             Mutex implementation to be locked.
+/// @return Flag indicating if mutex has been locked.
+/// @note FreeRTOS has no lock-free mutex fast path, so this function always fails and forces the regular path.
+static inline bool osalMutexImplFastLock(struct MutexImpl* /*unused*/)
+{
+    return false;
+}
+
+/// Unlocks the given mutex if no other thread waits for it. This is the uncontended fast path of the unlock operation.
+/// @param impl             Mutex implementation to be unlocked.
+/// @return Flag indicating if mutex has been unlocked.
+/// @note FreeRTOS has no lock-free mutex fast path, so this function always fails and forces the regular path.
+static inline bool osalMutexImplFastUnlock(struct MutexImpl* /*unused*/)
+{
+    return false;
+}
@@ -0,0 +1,58 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <FreeRTOSConfig.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+/// Helper class with concrete platform implementation of the reader-writer lock handle.
+/// @note FreeRTOS doesn't have native reader-writer lock, so it is built from semaphores. "resource" is held either
+///       by the writer or by the whole group of readers. "readTry" is the gate, which new readers have to pass. It is
+///       held by writers waiting for the lock (eFair and ePreferWriter policies). "readersMutex" and "writersMutex"
+///       protect counters of the active readers and waiting writers respectively.
+struct RwLockImpl {
+    SemaphoreHandle_t resource;
+    SemaphoreHandle_t readTry;
+    SemaphoreHandle_t readersMutex;
+    SemaphoreHandle_t writersMutex;
+    UBaseType_t readers;
+    UBaseType_t writers;
+
+#if configSUPPORT_STATIC_ALLOCATION
+    StaticSemaphore_t resourceBuffer;
+    StaticSemaphore_t readTryBuffer;
+    StaticSemaphore_t readersMutexBuffer;
+    StaticSemaphore_t writersMutexBuffer;
+#endif
+};
@@ -37,10 +37,14 @@
 #include <freertos/semphr.h>
 
 /// Helper class with concrete platform implementation of the semaphore handle.
+/// @note Batch gate serializes waiters requesting many tokens, so that they never hold partial acquisitions of each
+///       other, which could lead to a deadlock.
 struct SemaphoreImpl {
     SemaphoreHandle_t handle;
+    SemaphoreHandle_t batchGate;
 
 #if configSUPPORT_STATIC_ALLOCATION
     StaticSemaphore_t buffer;
+    StaticSemaphore_t batchGateBuffer;
 #endif
 };
@@ -38,14 +38,24 @@
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 
+#include <stddef.h> // NOLINT(modernize-deprecated-headers,hicpp-deprecated-headers)
+#include <stdint.h> // NOLINT(modernize-deprecated-headers,hicpp-deprecated-headers)
+
+/// Maximal size of the thread name (including the NULL-terminator) supported by the platform.
+static const size_t cOsalThreadNameSize = configMAX_TASK_NAME_LEN;
+
 /// Represents helper wrapper around user thread function and its arguments.
 /// @note This type is necessary, because FreeRTOS doesn't support joining threads. For this purpose the additional
 ///       semaphore is used to implement this mechanism. Special threadWrapper() function is used directly in
 ///       call to xTaskCreate() and user thread function is passed along with its arguments as the
 ///       argument.
+/// @note Priority holds OsalThreadPriority value, which is reported by the registry of live threads.
+/// @note Finished flag is set as soon as user thread function returns, so that task handle is no longer queried.
 struct ThreadWrapperData {
     TaskFunction_t func;
     void* arg;
+    int priority;
+    uint32_t finished;
     OsalSemaphore semaphore;
 };
 
@@ -53,6 +63,7 @@ struct ThreadWrapperData {
 struct ThreadImpl {
     TaskHandle_t handle;
     ThreadWrapperData params;
+    uint64_t startTimestampNs;
 
 #if configSUPPORT_STATIC_ALLOCATION
     StackType_t* stack;
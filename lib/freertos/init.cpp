@@ -41,8 +41,26 @@ static void initTimestamp()
 }
 
 bool osalInit()
+{
+    return osalInitEx(nullptr, nullptr);
+}
+
+bool osalInitEx(const OsalInitConfig* config, OsalInitReport* report)
 {
     initTimestamp();
 
+    if (report == nullptr)
+        return true;
+
+    // All memory is always resident and FreeRTOS scheduler is real-time, so there is nothing to be configured.
+    *report = OsalInitReport{};
+    report->realtimeScheduling = true;
+    if (config != nullptr) {
+        report->memoryLocked = config->lockMemory;
+        report->heapPrefaulted = (config->heapReserveSize != 0);
+        report->stackPrefaulted = (config->stackPrefaultSize != 0);
+        report->transparentHugePagesDisabled = config->disableTransparentHugePages;
+    }
+
     return true;
 }
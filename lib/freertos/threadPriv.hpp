@@ -0,0 +1,56 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "osal/Thread.h"
+
+#include <FreeRTOSConfig.h>
+
+/// Converts OSAL thread priority to the native FreeRTOS task priority.
+/// @param priority         OSAL thread priority to be converted.
+/// @return Native priority corresponding to the given OSAL priority or -1 if the given priority is invalid.
+inline int toNativePriority(OsalThreadPriority priority)
+{
+    const auto cPriorityMin = 0;
+    const auto cPriorityMax = configMAX_PRIORITIES - 1;
+    const auto cPriorityStep = (cPriorityMax - cPriorityMin) / 4;
+
+    switch (priority) {
+        case OsalThreadPriority::eLowest: return cPriorityMin;
+        case OsalThreadPriority::eLow: return cPriorityMin + (cPriorityStep * 1);
+        case OsalThreadPriority::eNormal: return cPriorityMin + (cPriorityStep * 2);
+        case OsalThreadPriority::eHigh: return cPriorityMin + (cPriorityStep * 3);
+        case OsalThreadPriority::eHighest: return cPriorityMax;
+        default: return -1;
+    }
+}
@@ -32,10 +32,28 @@
 
 #pragma once
 
+#include "osal/timestamp.h"
+
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 
+#include <cstdint>
+
 /// Internal value of the CPU ticks latched during OSAL initialization.
 /// @note This value must be properly set by OSAL initialization in order to have correct values
 /// returned from timestamp module.
 extern TickType_t initTime;
+
+/// Converts the given absolute OSAL deadline in ns into the relative timeout in ms.
+/// @param deadlineNs       Absolute deadline expressed in the time base of osalTimestampNs().
+/// @return Relative timeout in ms left to the given deadline or 0 if deadline has already passed.
+/// @note Returned value is always smaller than portMAX_DELAY, so it is never interpreted as infinite timeout.
+inline std::uint32_t deadlineToTimeoutMs(std::uint64_t deadlineNs)
+{
+    auto now = osalTimestampNs();
+    if (deadlineNs <= now)
+        return 0;
+
+    auto timeoutMs = osalNsToMs(deadlineNs - now);
+    return (timeoutMs >= portMAX_DELAY) ? (portMAX_DELAY - 1) : static_cast<std::uint32_t>(timeoutMs);
+}
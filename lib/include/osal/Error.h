@@ -46,7 +46,9 @@ enum OsalError {
     eNotOwner,
     eNotLocked,
     eLocked,
-    eTimeout
+    eTimeout,
+    eOwnerDead,
+    eSchedulingFallback
 };
 
 #ifdef __cplusplus
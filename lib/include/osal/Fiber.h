@@ -0,0 +1,80 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "internal/FiberContextImpl.h"
+#include "osal/Error.h"
+
+#include <stdbool.h> // NOLINT(modernize-deprecated-headers,hicpp-deprecated-headers)
+#include <stddef.h>  // NOLINT(modernize-deprecated-headers,hicpp-deprecated-headers)
+
+/// Represents OSAL fiber context handle. Fiber context is a saved state of the execution (CPU registers and stack),
+/// which can be resumed in the user space without involving the OS scheduler.
+/// @note Size of this structure depends on the concrete implementation. In particular, FiberContextImpl
+///       contains objects from the target platform. Thus depending on its size is not recommended.
+/// @note Fiber contexts are not supported on FreeRTOS.
+struct OsalFiberContext {
+    FiberContextImpl impl;
+    bool initialized;
+};
+
+/// Initializes the given context, so that switching to it executes the given function on the given stack.
+/// @param context          Fiber context handle to be initialized.
+/// @param stack            Lowest address of the memory to be used as the fiber stack.
+/// @param stackSize        Size of the fiber stack.
+/// @param func             Function to be executed by the fiber.
+/// @param param            Argument to be passed to the function.
+/// @return Error code of the operation.
+/// @note Function must never return. Instead, it should switch to some other context as its last operation.
+OsalError osalFiberContextCreate(OsalFiberContext* context,
+                                 void* stack,
+                                 size_t stackSize,
+                                 void (*func)(void*),
+                                 void* param);
+
+/// Saves the current execution state in the first context and resumes the second one.
+/// @param from             Fiber context handle, where current execution state should be saved.
+/// @param to               Fiber context handle to be resumed.
+/// @return Error code of the operation.
+/// @note Context "from" doesn't have to be created with osalFiberContextCreate(). This way any thread can switch
+///       to the fiber and later get back to the place, where it has switched.
+/// @note This function returns only when some other thread or fiber switches back to the "from" context.
+OsalError osalFiberContextSwitch(OsalFiberContext* from, OsalFiberContext* to);
+
+#ifdef __cplusplus
+}
+#endif
@@ -38,14 +38,65 @@ extern "C" {
 
 #include "internal/MutexImpl.h"
 #include "osal/Error.h"
+#include "osal/Thread.h"
 
+#include <stddef.h> // NOLINT(modernize-deprecated-headers,hicpp-deprecated-headers)
 #include <stdint.h> // NOLINT(modernize-deprecated-headers,hicpp-deprecated-headers)
 
 /// Represents possible types of the OSAL mutex. These types define how mutex will react to multiple recursive
-/// locks made by the same thread.
+/// locks made by the same thread and how it behaves under contention.
+/// @note eAdaptive is a non-recursive mutex, which under contention spins with exponential backoff for a limited
+///       number of iterations (spin budget) before parking the calling thread in the kernel.
 enum OsalMutexType {
     eRecursive,
-    eNonRecursive
+    eNonRecursive,
+    eAdaptive
+};
+
+/// Represents possible priority protocols of the OSAL mutex. These protocols define how mutex will affect priority
+/// of the thread, which owns it.
+/// @note ePriorityInheritance temporarily raises priority of the mutex owner to the highest priority of the threads
+///       blocked on this mutex. ePriorityCeiling raises priority of the mutex owner to the mutex ceiling priority for
+///       the whole time when mutex is locked.
+/// @note On FreeRTOS all mutexes use priority inheritance, because the kernel doesn't allow to disable it.
+enum OsalMutexProtocol {
+    eNoPriorityProtocol,
+    ePriorityInheritance,
+    ePriorityCeiling
+};
+
+/// Represents structure used to configure created mutex.
+/// @note Ceiling is used only with OsalMutexProtocol::ePriorityCeiling protocol.
+struct OsalMutexConfig {
+    OsalMutexType type;
+    OsalMutexProtocol protocol;
+    OsalThreadPriority ceiling;
+};
+
+/// Number of buckets in the wait time and hold time histograms of the mutex statistics.
+/// @note Bucket 0 counts zero durations and bucket i (i > 0) counts durations in range [2^(i-1), 2^i) ns. The last
+///       bucket counts also all longer durations.
+static const size_t cOsalMutexStatsBuckets = 32;
+
+/// Represents lock contention statistics of the single mutex.
+/// @note Acquisition counters are updated only by the current mutex owner and hold time is recorded right after
+///       the successful unlock, so recording costs two timestamp reads per acquisition (three in the contended case)
+///       and a few relaxed atomic operations.
+/// @note Fields below "Internal" comment are used by OSAL and should not be modified by the user.
+struct OsalMutexStats {
+    const char* name;
+    uint64_t acquisitions;
+    uint64_t contentions;
+    uint64_t maxHoldNs;
+    uint64_t waitHistogram[cOsalMutexStatsBuckets];
+    uint64_t holdHistogram[cOsalMutexStatsBuckets];
+
+    // Internal.
+    uint64_t lockTimestampNs;
+    uint32_t depth;
+    uint32_t owner;
+    struct OsalMutexStats* prev;
+    struct OsalMutexStats* next;
 };
 
 /// Represents OSAL mutex handle.
@@ -54,12 +105,21 @@ enum OsalMutexType {
 struct OsalMutex {
     MutexImpl impl;
     OsalMutexType type;
+    OsalMutexProtocol protocol;
+    OsalMutexStats* stats;
+    bool processShared;
     bool initialized;
 };
 
 /// Helper constant with default mutex type.
 static const OsalMutexType cOsalMutexDefaultType = OsalMutexType::eNonRecursive;
 
+/// Helper constant with default mutex priority protocol.
+static const OsalMutexProtocol cOsalMutexDefaultProtocol = OsalMutexProtocol::eNoPriorityProtocol;
+
+/// Helper constant with default spin budget of the adaptive mutex.
+static const uint32_t cOsalMutexDefaultSpinBudget = 100;
+
 /// Creates new mutex with the given type.
 /// @param mutex            Mutex handle to be initialized.
 /// @param type             Type of the mutex to be created.
@@ -67,6 +127,30 @@ static const OsalMutexType cOsalMutexDefaultType = OsalMutexType::eNonRecursive;
 /// @note Created mutex is in unlocked state.
 OsalError osalMutexCreate(OsalMutex* mutex, OsalMutexType type);
 
+/// Creates new mutex with the given configuration.
+/// @param mutex            Mutex handle to be initialized.
+/// @param config           OSAL mutex configuration to be used to setup new mutex.
+/// @return Error code of the operation.
+/// @note Created mutex is in unlocked state.
+/// @note Adaptive mutexes cannot be combined with priority protocols, because spinning defeats priority boosting.
+/// @note Locking mutex with ePriorityCeiling protocol by thread with priority higher than mutex ceiling fails.
+///       On Linux it fails also if the calling thread doesn't use real-time scheduling policy.
+OsalError osalMutexCreateEx(OsalMutex* mutex, OsalMutexConfig config);
+
+/// Creates new mutex with the given configuration, which can be used by multiple processes. Mutex is constructed in
+/// place, so the given handle has to be located in the memory shared by all these processes (e.g. mapped with
+/// MAP_SHARED). Only one process should create and destroy the mutex, other processes use the same handle directly.
+/// @param mutex            Mutex handle to be initialized.
+/// @param config           OSAL mutex configuration to be used to setup new mutex.
+/// @return Error code of the operation.
+/// @note Created mutex is in unlocked state.
+/// @note Process-shared mutex is robust: if its owner terminates without unlocking it, then the next locking thread
+///       acquires the mutex and gets OsalError::eOwnerDead. Data protected by the mutex may be inconsistent in such
+///       case and should be repaired by that thread before unlocking.
+/// @note Process-shared mutexes don't support statistics.
+/// @note On FreeRTOS all tasks share the same address space, so this function is equivalent to osalMutexCreateEx().
+OsalError osalMutexCreateShared(OsalMutex* mutex, OsalMutexConfig config);
+
 /// Destroys mutex represented by the given handle.
 /// @param mutex            Mutex handle to be destroyed.
 /// @return Error code of the operation.
@@ -99,6 +183,15 @@ OsalError osalMutexTryLockIsr(OsalMutex* mutex);
 /// @return Error code of the operation.
 OsalError osalMutexTimedLock(OsalMutex* mutex, uint32_t timeoutMs);
 
+/// Locks the given mutex. If it is currently locked any thread, then the calling thread will block until mutex
+/// is released or the specified deadline is reached. If mutex is recursive, then it can be locked multiple times by
+/// the same thread.
+/// @param mutex            Mutex to be locked.
+/// @param deadlineNs       Absolute deadline of the operation expressed in the time base of osalTimestampNs().
+/// @return Error code of the operation.
+/// @note On Linux deadline is measured with CLOCK_MONOTONIC, so it is not affected by the changes of system time.
+OsalError osalMutexTimedLockUntil(OsalMutex* mutex, uint64_t deadlineNs);
+
 /// Unlocks the given mutex.
 /// @param mutex            Mutex to be unlocked.
 /// @return Error code of the operation.
@@ -112,6 +205,54 @@ OsalError osalMutexUnlock(OsalMutex* mutex);
 /// @note Unlocking mutex that was already locked by another thread invokes undefined behavior.
 OsalError osalMutexUnlockIsr(OsalMutex* mutex);
 
+/// Sets the maximal number of spin iterations, which adaptive mutex performs under contention before parking
+/// the calling thread in the kernel.
+/// @param mutex            Mutex to be configured.
+/// @param spinBudget       Maximal number of spin iterations. Value 0 disables spinning.
+/// @return Error code of the operation.
+/// @note This function can be called only for eAdaptive mutexes.
+/// @note On platforms, where spinning doesn't make sense (e.g. single-core FreeRTOS), spin budget is ignored.
+OsalError osalMutexSetSpinBudget(OsalMutex* mutex, uint32_t spinBudget);
+
+/// Enables statistics mode of the given mutex and registers it in the process-wide registry of profiled mutexes.
+/// @param mutex            Mutex to be profiled.
+/// @param stats            Storage for the statistics. It has to remain valid until statistics are disabled.
+/// @param name             Name of the mutex used in the statistics reports. It has to remain valid until
+///                         statistics are disabled.
+/// @return Error code of the operation.
+/// @note This function should be called only when mutex is unlocked.
+/// @note Mutexes with enabled statistics don't use the inline fast path of osal::Mutex.
+/// @note On FreeRTOS operations made from ISR are not recorded.
+OsalError osalMutexEnableStats(OsalMutex* mutex, OsalMutexStats* stats, const char* name);
+
+/// Disables statistics mode of the given mutex and removes it from the registry of profiled mutexes.
+/// @param mutex            Mutex to be no longer profiled.
+/// @return Error code of the operation.
+/// @note This function should be called only when mutex is unlocked.
+/// @note Statistics are disabled automatically when mutex is destroyed.
+OsalError osalMutexDisableStats(OsalMutex* mutex);
+
+/// Returns the snapshot of the statistics of the given mutex.
+/// @param mutex            Mutex, which statistics should be returned.
+/// @param snapshot         Output argument where the statistics will be stored.
+/// @return Error code of the operation.
+/// @note Snapshot taken while mutex is being used can be slightly inconsistent (e.g. histograms may not sum up to
+///       the number of acquisitions).
+OsalError osalMutexGetStats(OsalMutex* mutex, OsalMutexStats* snapshot);
+
+/// Resets all statistics of the given mutex to zero.
+/// @param mutex            Mutex, which statistics should be reset.
+/// @return Error code of the operation.
+/// @note Counters are not reset atomically with respect to the mutex owner. This function should be called only when
+///       no other thread uses the mutex, otherwise acquisitions recorded concurrently may survive the reset.
+OsalError osalMutexResetStats(OsalMutex* mutex);
+
+/// Returns the snapshots of the statistics of the most contended mutexes from the registry of profiled mutexes.
+/// @param snapshots        Output array where the statistics will be stored in the order of descending contention.
+/// @param count            Size of the output array.
+/// @return Number of the snapshots stored in the output array.
+size_t osalMutexStatsTopContended(OsalMutexStats* snapshots, size_t count);
+
 #ifdef __cplusplus
 }
 #endif
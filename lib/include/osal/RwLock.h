@@ -0,0 +1,145 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "internal/RwLockImpl.h"
+#include "osal/Error.h"
+
+#include <stdint.h> // NOLINT(modernize-deprecated-headers,hicpp-deprecated-headers)
+
+/// Represents possible scheduling policies of the OSAL reader-writer lock. These policies define which side gets
+/// the lock first, when both readers and writers are waiting for it.
+/// @note ePreferReader lets new readers in as long as lock is held by any reader, so writers can starve under
+///       constant read traffic. ePreferWriter blocks new readers as soon as any writer is waiting, so readers can
+///       starve under constant write traffic. eFair serves readers and writers in the order of their arrival,
+///       so none of them can starve.
+enum OsalRwLockPolicy {
+    ePreferReader,
+    ePreferWriter,
+    eFair
+};
+
+/// Represents OSAL reader-writer lock handle.
+/// @note Size of this structure depends on the concrete implementation. In particular, RwLockImpl
+///       contains objects from the target platform. Thus depending on its size is not recommended.
+struct OsalRwLock {
+    RwLockImpl impl;
+    OsalRwLockPolicy policy;
+    bool initialized;
+};
+
+/// Helper constant with default reader-writer lock policy.
+static const OsalRwLockPolicy cOsalRwLockDefaultPolicy = OsalRwLockPolicy::ePreferWriter;
+
+/// Creates new reader-writer lock with the given policy.
+/// @param rwLock           Reader-writer lock handle to be initialized.
+/// @param policy           Policy of the reader-writer lock to be created.
+/// @return Error code of the operation.
+OsalError osalRwLockCreate(OsalRwLock* rwLock, OsalRwLockPolicy policy);
+
+/// Destroys reader-writer lock represented by the given handle.
+/// @param rwLock           Reader-writer lock handle to be destroyed.
+/// @return Error code of the operation.
+OsalError osalRwLockDestroy(OsalRwLock* rwLock);
+
+/// Locks the given reader-writer lock for reading. If it is currently locked for writing (or writer is favored
+/// by the policy), then the calling thread will block until the lock can be shared.
+/// @param rwLock           Reader-writer lock to be locked.
+/// @return Error code of the operation.
+/// @note Locking reader-writer lock for reading recursively can result in a deadlock, if writer is waiting.
+OsalError osalRwLockReadLock(OsalRwLock* rwLock);
+
+/// Locks the given reader-writer lock for reading. If it cannot be shared right now, then it returns immediately
+/// with a proper error.
+/// @param rwLock           Reader-writer lock to be locked.
+/// @return Error code of the operation.
+OsalError osalRwLockReadTryLock(OsalRwLock* rwLock);
+
+/// Locks the given reader-writer lock for reading. If it cannot be shared right now, then the calling thread
+/// will block until the lock can be shared or the specified time elapses.
+/// @param rwLock           Reader-writer lock to be locked.
+/// @param timeoutMs        Maximal time in ms to wait for the operation.
+/// @return Error code of the operation.
+OsalError osalRwLockReadTimedLock(OsalRwLock* rwLock, uint32_t timeoutMs);
+
+/// Locks the given reader-writer lock for reading. If it cannot be shared right now, then the calling thread
+/// will block until the lock can be shared or the specified deadline is reached.
+/// @param rwLock           Reader-writer lock to be locked.
+/// @param deadlineNs       Absolute deadline of the operation expressed in the time base of osalTimestampNs().
+/// @return Error code of the operation.
+OsalError osalRwLockReadTimedLockUntil(OsalRwLock* rwLock, uint64_t deadlineNs);
+
+/// Unlocks the given reader-writer lock previously locked for reading.
+/// @param rwLock           Reader-writer lock to be unlocked.
+/// @return Error code of the operation.
+OsalError osalRwLockReadUnlock(OsalRwLock* rwLock);
+
+/// Locks the given reader-writer lock for writing. If it is currently locked by anyone, then the calling thread
+/// will block until the lock is released.
+/// @param rwLock           Reader-writer lock to be locked.
+/// @return Error code of the operation.
+/// @note Locking reader-writer lock for writing twice by the same thread will result in a deadlock.
+OsalError osalRwLockWriteLock(OsalRwLock* rwLock);
+
+/// Locks the given reader-writer lock for writing. If it is currently locked by anyone, then it returns immediately
+/// with a proper error.
+/// @param rwLock           Reader-writer lock to be locked.
+/// @return Error code of the operation.
+OsalError osalRwLockWriteTryLock(OsalRwLock* rwLock);
+
+/// Locks the given reader-writer lock for writing. If it is currently locked by anyone, then the calling thread
+/// will block until the lock is released or the specified time elapses.
+/// @param rwLock           Reader-writer lock to be locked.
+/// @param timeoutMs        Maximal time in ms to wait for the operation.
+/// @return Error code of the operation.
+OsalError osalRwLockWriteTimedLock(OsalRwLock* rwLock, uint32_t timeoutMs);
+
+/// Locks the given reader-writer lock for writing. If it is currently locked by anyone, then the calling thread
+/// will block until the lock is released or the specified deadline is reached.
+/// @param rwLock           Reader-writer lock to be locked.
+/// @param deadlineNs       Absolute deadline of the operation expressed in the time base of osalTimestampNs().
+/// @return Error code of the operation.
+OsalError osalRwLockWriteTimedLockUntil(OsalRwLock* rwLock, uint64_t deadlineNs);
+
+/// Unlocks the given reader-writer lock previously locked for writing.
+/// @param rwLock           Reader-writer lock to be unlocked.
+/// @return Error code of the operation.
+OsalError osalRwLockWriteUnlock(OsalRwLock* rwLock);
+
+#ifdef __cplusplus
+}
+#endif
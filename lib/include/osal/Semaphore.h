@@ -41,20 +41,63 @@ extern "C" {
 
 #include <stdint.h> // NOLINT(modernize-deprecated-headers,hicpp-deprecated-headers)
 
+/// Represents possible types of the OSAL semaphore.
+/// @note ePollable semaphore exposes native handle, which can be waited on together with other platform objects
+///       (e.g. sockets in epoll() on Linux). It is slower than eStandard semaphore, because every operation enters
+///       the kernel. On Linux it is implemented with eventfd(EFD_SEMAPHORE).
+enum OsalSemaphoreType {
+    eStandard,
+    ePollable
+};
+
 /// Represents OSAL semaphore handle.
 /// @note Size of this structure depends on the concrete implementation. In particular, SemaphoreImpl
 ///       contains objects from the target platform. Thus depending on its size is not recommended.
 struct OsalSemaphore {
     SemaphoreImpl impl;
+    OsalSemaphoreType type;
     bool initialized;
 };
 
+/// Helper constant with default semaphore type.
+static const OsalSemaphoreType cOsalSemaphoreDefaultType = OsalSemaphoreType::eStandard;
+
 /// Creates new semaphore with the given initial value.
 /// @param semaphore        Semaphore handle to be initialized.
 /// @param initialValue     Initial value of the semaphore to be created.
 /// @return Error code of the operation.
+/// @note On Linux value of the eStandard semaphore is limited to 2^30 - 1, because the lowest bits of its futex word
+///       are reserved for the waiters flags.
 OsalError osalSemaphoreCreate(OsalSemaphore* semaphore, unsigned int initialValue);
 
+/// Creates new semaphore with the given initial value and type.
+/// @param semaphore        Semaphore handle to be initialized.
+/// @param initialValue     Initial value of the semaphore to be created.
+/// @param type             Type of the semaphore to be created.
+/// @return Error code of the operation.
+/// @note On FreeRTOS ePollable semaphores are not supported and OsalError::eOsError is returned.
+OsalError osalSemaphoreCreateEx(OsalSemaphore* semaphore, unsigned int initialValue, OsalSemaphoreType type);
+
+/// Creates new semaphore with the given initial value, which can be used by multiple processes. Semaphore is
+/// constructed in place, so the given handle has to be located in the memory shared by all these processes (e.g.
+/// mapped with MAP_SHARED). Only one process should create and destroy the semaphore, other processes use the same
+/// handle directly.
+/// @param semaphore        Semaphore handle to be initialized.
+/// @param initialValue     Initial value of the semaphore to be created.
+/// @return Error code of the operation.
+/// @note On FreeRTOS all tasks share the same address space, so this function is equivalent to osalSemaphoreCreate().
+OsalError osalSemaphoreCreateShared(OsalSemaphore* semaphore, unsigned int initialValue);
+
+/// Returns native handle of the given ePollable semaphore (file descriptor on Linux). Handle becomes readable, when
+/// semaphore value is positive, so it can be registered in epoll() together with other descriptors.
+/// @param semaphore        Semaphore, which native handle should be returned.
+/// @param handle           Output argument where the native handle will be stored.
+/// @return Error code of the operation.
+/// @note Handle should be used only to wait for readiness. Tokens have to be taken with osalSemaphoreTryWait(),
+///       because readiness may be consumed by another thread in the meantime.
+/// @note Handle is owned by the semaphore and is closed, when semaphore is destroyed.
+OsalError osalSemaphoreNativeHandle(OsalSemaphore* semaphore, int* handle);
+
 /// Destroys semaphore represented by the given handle.
 /// @param semaphore        Semaphore handle to be destroyed.
 /// @return Error code of the operation.
@@ -66,12 +109,30 @@ OsalError osalSemaphoreDestroy(OsalSemaphore* semaphore);
 /// @return Error code of the operation.
 OsalError osalSemaphoreWait(OsalSemaphore* semaphore);
 
+/// Decrements value of the given semaphore by the given number of tokens. If its value is currently lower than that,
+/// then the calling thread will block until enough tokens are available. Tokens are taken all at once.
+/// @param semaphore        Semaphore to be decremented.
+/// @param count            Number of tokens to be taken. It has to be greater than 0.
+/// @return Error code of the operation.
+/// @note Waiter requesting many tokens can be overtaken by waiters requesting fewer tokens.
+/// @note Eventfd can't take many tokens at once, so for ePollable semaphores count has to be 1. Otherwise
+///       OsalError::eInvalidArgument is returned.
+OsalError osalSemaphoreWaitMany(OsalSemaphore* semaphore, unsigned int count);
+
 /// Decrements value of the given semaphore. If its value is currently 0, then it returns immediately
 /// with a proper error.
 /// @param semaphore        Semaphore to be decremented.
 /// @return Error code of the operation.
 OsalError osalSemaphoreTryWait(OsalSemaphore* semaphore);
 
+/// Decrements value of the given semaphore by the given number of tokens. If its value is currently lower than that,
+/// then it returns immediately with a proper error and semaphore is not modified.
+/// @param semaphore        Semaphore to be decremented.
+/// @param count            Number of tokens to be taken. It has to be greater than 0.
+/// @return Error code of the operation.
+/// @note For ePollable semaphores count has to be 1.
+OsalError osalSemaphoreTryWaitMany(OsalSemaphore* semaphore, unsigned int count);
+
 /// Decrements value of the given semaphore. If its value is currently 0, then it returns immediately
 /// with a proper error.
 /// @param semaphore        Semaphore to be decremented.
@@ -86,17 +147,57 @@ OsalError osalSemaphoreTryWaitIsr(OsalSemaphore* semaphore);
 /// @return Error code of the operation.
 OsalError osalSemaphoreTimedWait(OsalSemaphore* semaphore, uint32_t timeoutMs);
 
+/// Decrements value of the given semaphore by the given number of tokens. If its value is currently lower than that,
+/// then the calling thread will block until enough tokens are available or the specified time elapses. Tokens are
+/// taken all at once.
+/// @param semaphore        Semaphore to be decremented.
+/// @param count            Number of tokens to be taken. It has to be greater than 0.
+/// @param timeoutMs        Maximal time in ms to wait for the operation.
+/// @return Error code of the operation.
+/// @note For ePollable semaphores count has to be 1.
+OsalError osalSemaphoreTimedWaitMany(OsalSemaphore* semaphore, unsigned int count, uint32_t timeoutMs);
+
+/// Decrements value of the given semaphore. If its value is currently 0, then the calling thread will block until
+/// semaphore is positive again or the specified deadline is reached.
+/// @param semaphore        Semaphore to be decremented.
+/// @param deadlineNs       Absolute deadline of the operation expressed in the time base of osalTimestampNs().
+/// @return Error code of the operation.
+/// @note On Linux deadline is measured with CLOCK_MONOTONIC, so it is not affected by the changes of system time.
+OsalError osalSemaphoreTimedWaitUntil(OsalSemaphore* semaphore, uint64_t deadlineNs);
+
+/// Decrements value of the given semaphore by the given number of tokens. If its value is currently lower than that,
+/// then the calling thread will block until enough tokens are available or the specified deadline is reached. Tokens
+/// are taken all at once.
+/// @param semaphore        Semaphore to be decremented.
+/// @param count            Number of tokens to be taken. It has to be greater than 0.
+/// @param deadlineNs       Absolute deadline of the operation expressed in the time base of osalTimestampNs().
+/// @return Error code of the operation.
+/// @note For ePollable semaphores count has to be 1.
+OsalError osalSemaphoreTimedWaitManyUntil(OsalSemaphore* semaphore, unsigned int count, uint64_t deadlineNs);
+
 /// Increments value of the given semaphore.
 /// @param semaphore        Semaphore to be incremented.
 /// @return Error code of the operation.
-/// @note There is no upper bound of the semaphore value.
+/// @note On Linux value of the eStandard semaphore is limited to 2^30 - 1. If it would be exceeded, then the value
+///       is not changed and OsalError::eOsError is returned.
 OsalError osalSemaphoreSignal(OsalSemaphore* semaphore);
 
+/// Increments value of the given semaphore by the given number of tokens.
+/// @param semaphore        Semaphore to be incremented.
+/// @param count            Number of tokens to be released. It has to be greater than 0.
+/// @return Error code of the operation.
+/// @note On Linux value of the eStandard semaphore is limited to 2^30 - 1. If it would be exceeded, then the value
+///       is not changed and OsalError::eOsError is returned.
+/// @note On Linux single-token waiters are woken up first, at most one per released token. Waiters for many tokens are
+///       woken up only if some of the released tokens are left for them and then all of them compete for the tokens.
+OsalError osalSemaphoreSignalMany(OsalSemaphore* semaphore, unsigned int count);
+
 /// Increments value of the given semaphore.
 /// @param semaphore        Semaphore to be incremented.
 /// @return Error code of the operation.
 /// @note This function will never block and is supposed to be called from ISR.
-/// @note There is no upper bound of the semaphore value.
+/// @note On Linux value of the eStandard semaphore is limited to 2^30 - 1. If it would be exceeded, then the value
+///       is not changed and OsalError::eOsError is returned.
 OsalError osalSemaphoreSignalIsr(OsalSemaphore* semaphore);
 
 #ifdef __cplusplus
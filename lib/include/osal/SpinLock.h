@@ -0,0 +1,126 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "internal/SpinLockImpl.h"
+#include "osal/Error.h"
+
+#include <stdint.h> // NOLINT(modernize-deprecated-headers,hicpp-deprecated-headers)
+
+/// Represents possible types of the OSAL spinlock. Both types are fair, i.e. threads acquire the lock in the order
+/// of their arrival.
+/// @note eTicket spins on the single shared "now serving" counter. It is the cheapest one for a few contending
+///       threads. eMcs spins on the queue node private to each waiting thread, so the cache line holding the lock
+///       is not bounced between all waiting cores, when lock is released. It scales better with many contending
+///       threads.
+/// @note On FreeRTOS both types are implemented as ticket spinlocks.
+enum OsalSpinLockType {
+    eTicket,
+    eMcs
+};
+
+/// Represents OSAL spinlock handle.
+/// @note Size of this structure depends on the concrete implementation. In particular, SpinLockImpl
+///       contains objects from the target platform. Thus depending on its size is not recommended.
+struct OsalSpinLock {
+    SpinLockImpl impl;
+    OsalSpinLockType type;
+    bool initialized;
+};
+
+/// Helper constant with default spinlock type.
+static const OsalSpinLockType cOsalSpinLockDefaultType = OsalSpinLockType::eTicket;
+
+/// Helper constant with maximal number of the eMcs spinlocks, which can be held at the same time by one thread.
+static const uint32_t cOsalSpinLockMaxNesting = 4;
+
+/// Creates new spinlock with the given type.
+/// @param spinLock         Spinlock handle to be initialized.
+/// @param type             Type of the spinlock to be created.
+/// @return Error code of the operation.
+OsalError osalSpinLockCreate(OsalSpinLock* spinLock, OsalSpinLockType type);
+
+/// Destroys spinlock represented by the given handle.
+/// @param spinLock         Spinlock handle to be destroyed.
+/// @return Error code of the operation.
+OsalError osalSpinLockDestroy(OsalSpinLock* spinLock);
+
+/// Locks the given spinlock. If it is currently locked by any thread, then the calling thread will busy-wait until
+/// the lock is released.
+/// @param spinLock         Spinlock to be locked.
+/// @return Error code of the operation.
+/// @note Spinlock is meant for the critical sections lasting a few instructions. On Linux waiting thread yields
+///       the CPU after a bounded number of spins, so that preempted lock owner can make progress. On FreeRTOS lock
+///       is held inside critical section, so the calling task cannot be preempted until spinlock is unlocked.
+/// @note Locking spinlock twice by the same thread will result in a deadlock.
+OsalError osalSpinLockLock(OsalSpinLock* spinLock);
+
+/// Locks the given spinlock. If it is currently locked by any thread, then it returns immediately with a proper error.
+/// @param spinLock         Spinlock to be locked.
+/// @return Error code of the operation.
+OsalError osalSpinLockTryLock(OsalSpinLock* spinLock);
+
+/// Unlocks the given spinlock.
+/// @param spinLock         Spinlock to be unlocked.
+/// @return Error code of the operation.
+/// @note Unlocking spinlock that was locked by another thread invokes undefined behavior.
+OsalError osalSpinLockUnlock(OsalSpinLock* spinLock);
+
+/// Locks the given spinlock. If it is currently locked by any thread, then the calling thread will busy-wait until
+/// the lock is released.
+/// @param spinLock         Spinlock to be locked.
+/// @return Error code of the operation.
+/// @note This function is supposed to be called from ISR. Spinlock locked with it has to be unlocked with
+///       osalSpinLockUnlockIsr().
+OsalError osalSpinLockLockIsr(OsalSpinLock* spinLock);
+
+/// Locks the given spinlock. If it is currently locked by any thread, then it returns immediately with a proper error.
+/// @param spinLock         Spinlock to be locked.
+/// @return Error code of the operation.
+/// @note This function will never block and is supposed to be called from ISR. Spinlock locked with it has to be
+///       unlocked with osalSpinLockUnlockIsr().
+OsalError osalSpinLockTryLockIsr(OsalSpinLock* spinLock);
+
+/// Unlocks the given spinlock.
+/// @param spinLock         Spinlock to be unlocked.
+/// @return Error code of the operation.
+/// @note This function is supposed to be called from ISR.
+OsalError osalSpinLockUnlockIsr(OsalSpinLock* spinLock);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,108 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "internal/StackPoolImpl.h"
+#include "osal/Error.h"
+
+#include <stdbool.h> // NOLINT(modernize-deprecated-headers,hicpp-deprecated-headers)
+#include <stddef.h>  // NOLINT(modernize-deprecated-headers,hicpp-deprecated-headers)
+#include <stdint.h>  // NOLINT(modernize-deprecated-headers,hicpp-deprecated-headers)
+
+/// Maximal number of stacks, which can be managed by a single OsalStackPool.
+static const size_t cOsalStackPoolMaxStacks = 256;
+
+/// Represents OSAL stack pool handle.
+/// @note Stack pool allocates all stacks upfront and pre-faults their memory, so that creating threads on pooled
+///       stacks neither allocates memory nor triggers page faults on the first touch of the stack.
+/// @note Size of this structure depends on the concrete implementation. In particular, StackPoolImpl
+///       contains objects from the target platform. Thus depending on its size is not recommended.
+struct OsalStackPool {
+    StackPoolImpl impl;
+    uint64_t freeMask[cOsalStackPoolMaxStacks / 64];
+    size_t stackSize;
+    size_t count;
+    bool initialized;
+};
+
+/// Represents configuration of the created stack pool.
+/// @note Guard pages are inaccessible pages placed below each stack, so that stack overflow results in a fault
+///       instead of a silent memory corruption. They are supported only on platforms with MMU (e.g. Linux).
+struct OsalStackPoolConfig {
+    size_t stackSize;
+    size_t count;
+    bool guardPages;
+};
+
+/// Creates new stack pool with the given configuration.
+/// @param pool             Stack pool handle to be initialized.
+/// @param config           Configuration of the stack pool to be created.
+/// @return Error code of the operation.
+/// @note Stack size is rounded up to the platform specific granularity (e.g. page size on Linux). On Linux it is also
+///       raised to at least PTHREAD_STACK_MIN, so that every pooled stack can be used by OSAL thread.
+OsalError osalStackPoolCreate(OsalStackPool* pool, OsalStackPoolConfig config);
+
+/// Destroys stack pool represented by the given handle.
+/// @param pool             Stack pool handle to be destroyed.
+/// @return Error code of the operation.
+/// @note If any stack is still acquired from the pool, then OsalError::eLocked is returned and pool is not destroyed.
+OsalError osalStackPoolDestroy(OsalStackPool* pool);
+
+/// Takes one free stack from the pool. This function never blocks.
+/// @param pool             Stack pool to be used.
+/// @param stack            Output argument where the lowest address of the acquired stack will be stored.
+/// @return Error code of the operation.
+/// @note Returned stack has size equal to the one reported by osalStackPoolStackSize() and can be directly used as
+///       OsalThreadConfig::stack.
+/// @note If there is no free stack in the pool, then OsalError::eLocked is returned.
+OsalError osalStackPoolAcquire(OsalStackPool* pool, void** stack);
+
+/// Returns the given stack back to the pool.
+/// @param pool             Stack pool to be used.
+/// @param stack            Stack to be returned, previously acquired from the same pool.
+/// @return Error code of the operation.
+/// @note Stack can be released only after the thread that used it has been joined.
+OsalError osalStackPoolRelease(OsalStackPool* pool, void* stack);
+
+/// Returns size of each stack managed by the given pool.
+/// @param pool             Stack pool to be queried.
+/// @return Size of each stack in the pool or 0 if pool is invalid.
+size_t osalStackPoolStackSize(const OsalStackPool* pool);
+
+#ifdef __cplusplus
+}
+#endif
@@ -39,8 +39,9 @@ extern "C" {
 #include "internal/ThreadImpl.h"
 #include "osal/Error.h"
 
-#include <stddef.h> // NOLINT(modernize-deprecated-headers,hicpp-deprecated-headers)
-#include <stdint.h> // NOLINT(modernize-deprecated-headers,hicpp-deprecated-headers)
+#include <stdbool.h> // NOLINT(modernize-deprecated-headers,hicpp-deprecated-headers)
+#include <stddef.h>  // NOLINT(modernize-deprecated-headers,hicpp-deprecated-headers)
+#include <stdint.h>  // NOLINT(modernize-deprecated-headers,hicpp-deprecated-headers)
 
 /// Represents OSAL thread handle.
 /// @note Size of this structure depends on the concrete implementation. In particular, ThreadImpl
@@ -69,12 +70,91 @@ static const OsalThreadPriority cOsalThreadDefaultPriority = OsalThreadPriority:
 /// Helper constant with default stack size of new thread.
 static const size_t cOsalThreadDefaultStackSize = 8 * 1024;
 
+/// Maximal number of CPUs, which can be represented by OsalCpuSet.
+static const size_t cOsalMaxCpus = 256;
+
+/// Represents set of CPUs, on which thread is allowed to run.
+/// @note Empty set means, that thread affinity is not changed (new threads inherit affinity of their creator).
+struct OsalCpuSet {
+    uint64_t mask[cOsalMaxCpus / 64];
+};
+
+/// Removes all CPUs from the given CPU set.
+/// @param cpus             CPU set to be cleared.
+static inline void osalCpuSetClear(OsalCpuSet* cpus)
+{
+    for (size_t i = 0; i < cOsalMaxCpus / 64; ++i)
+        cpus->mask[i] = 0;
+}
+
+/// Adds the given CPU to the CPU set.
+/// @param cpus             CPU set to be modified.
+/// @param cpu              Index of the CPU to be added.
+/// @note CPUs with index bigger than cOsalMaxCpus - 1 are ignored.
+static inline void osalCpuSetAdd(OsalCpuSet* cpus, uint32_t cpu)
+{
+    if (cpu < cOsalMaxCpus)
+        cpus->mask[cpu / 64] |= (uint64_t)1 << (cpu % 64); // NOLINT(google-readability-casting)
+}
+
+/// Checks if the given CPU belongs to the CPU set.
+/// @param cpus             CPU set to be checked.
+/// @param cpu              Index of the CPU to be checked.
+/// @return Flag indicating if the given CPU belongs to the CPU set.
+static inline bool osalCpuSetContains(const OsalCpuSet* cpus, uint32_t cpu)
+{
+    return (cpu < cOsalMaxCpus) && ((cpus->mask[cpu / 64] >> (cpu % 64)) & 1U) != 0;
+}
+
+/// Checks if the given CPU set is empty.
+/// @param cpus             CPU set to be checked.
+/// @return Flag indicating if the given CPU set is empty.
+static inline bool osalCpuSetIsEmpty(const OsalCpuSet* cpus)
+{
+    for (size_t i = 0; i < cOsalMaxCpus / 64; ++i) {
+        if (cpus->mask[i] != 0)
+            return false;
+    }
+
+    return true;
+}
+
+/// Represents possible scheduling policies that can be requested for the created thread.
+/// @note On Linux ePolicyOther maps to SCHED_OTHER and thread priority is expressed as the nice value.
+///       Remaining policies map to SCHED_FIFO, SCHED_RR and SCHED_DEADLINE respectively.
+/// @note On FreeRTOS all policies except ePolicyDeadline are equivalent to the native preemptive scheduler.
+enum OsalThreadPolicy {
+    ePolicyOther,
+    ePolicyFifo,
+    ePolicyRoundRobin,
+    ePolicyDeadline
+};
+
+/// Helper constant with default scheduling policy of new thread.
+static const OsalThreadPolicy cOsalThreadDefaultPolicy = OsalThreadPolicy::ePolicyOther;
+
+/// Represents scheduling parameters of the created thread.
+/// @note Runtime, deadline and period are used only by ePolicyDeadline and are ignored by other policies.
+///       They have to satisfy: runtime <= deadline <= period. Period equal to 0 means the same value as deadline.
+struct OsalThreadScheduling {
+    OsalThreadPolicy policy;
+    uint64_t runtimeNs;
+    uint64_t deadlineNs;
+    uint64_t periodNs;
+};
+
 /// Represents structure used to configuration for created thread.
-/// @note Stack is not used in all configurations (e.g. Linux doesn't support it).
+/// @note If stack is provided, then it is used as is and stackSize has to describe its size. On Linux glibc doesn't
+///       protect such stack with a guard page. Stacks smaller than PTHREAD_STACK_MIN are ignored on Linux and thread
+///       gets system allocated stack of PTHREAD_STACK_MIN bytes instead. Stacks from OsalStackPool are always used.
+/// @note Empty affinity means, that new thread inherits CPU affinity of its creator.
+/// @note Zero-initialized scheduling means ePolicyOther with priority applied as the nice value.
 struct OsalThreadConfig {
     OsalThreadPriority priority;
     size_t stackSize;
     void* stack;
+    OsalCpuSet affinity;
+    OsalThreadScheduling scheduling;
 };
 
 /// Represents signature of the user function that can be invoked by OSAL thread.
@@ -88,6 +168,11 @@ typedef void (*OsalThreadFunction)(void*); // NOLINT(modernize-use-using)
 /// @return Error code of the operation.
 /// @note Argument is passed as pointer, which means that it comes from the stack, then its lifetime must be
 ///       at least the same as created thread.
+/// @note If requested real-time policy cannot be applied (e.g. due to missing privileges), then thread is still
+///       created with ePolicyOther and its priority applied as the nice value. In that case eSchedulingFallback
+///       is returned and thread has to be joined and destroyed as usual.
+/// @note On Linux nice value is clamped to the limit allowed for the calling process (e.g. by RLIMIT_NICE) without
+///       reporting any error. Applied value can be read with getpriority() from within the thread.
 OsalError osalThreadCreate(OsalThread* thread, OsalThreadConfig config, OsalThreadFunction func, void* arg);
 
 /// Creates and immediately starts new thread with the following configuration, main function and arguments.
@@ -95,10 +180,16 @@ OsalError osalThreadCreate(OsalThread* thread, OsalThreadConfig config, OsalThre
 /// @param config           OSAL thread configuration to be used to setup new thread.
 /// @param func             User function to be invoked by the new thread.
 /// @param arg              User argument to be passed to the used function.
-/// @param name             Human readable name of the thread.
+/// @param name             Human readable name of the thread. Including the NULL-terminator it cannot be longer
+///                         than cOsalThreadNameSize defined by the platform.
 /// @return Error code of the operation.
 /// @note Argument is passed as pointer, which means that it comes from the stack, then its lifetime must be
 ///       at least the same as created thread.
+/// @note If requested real-time policy cannot be applied (e.g. due to missing privileges), then thread is still
+///       created with ePolicyOther and its priority applied as the nice value. In that case eSchedulingFallback
+///       is returned and thread has to be joined and destroyed as usual.
+/// @note On Linux nice value is clamped to the limit allowed for the calling process (e.g. by RLIMIT_NICE) without
+///       reporting any error. Applied value can be read with getpriority() from within the thread.
 OsalError
 osalThreadCreateEx(OsalThread* thread, OsalThreadConfig config, OsalThreadFunction func, void* arg, const char* name);
 
@@ -114,6 +205,40 @@ OsalError osalThreadDestroy(OsalThread* thread);
 /// @return Error code of the operation.
 OsalError osalThreadJoin(OsalThread* thread);
 
+/// Sets the set of CPUs, on which the given thread is allowed to run.
+/// @param thread           Thread to be modified.
+/// @param cpus             Set of allowed CPUs. It cannot be empty.
+/// @return Error code of the operation.
+/// @note On FreeRTOS affinity is supported only in SMP builds with configUSE_CORE_AFFINITY enabled. Otherwise only
+///       CPU 0 can be used.
+OsalError osalThreadSetAffinity(OsalThread* thread, const OsalCpuSet* cpus);
+
+/// Returns the set of CPUs, on which the given thread is allowed to run.
+/// @param thread           Thread to be queried.
+/// @param cpus             Output argument where the set of allowed CPUs will be stored.
+/// @return Error code of the operation.
+OsalError osalThreadGetAffinity(OsalThread* thread, OsalCpuSet* cpus);
+
+/// Represents runtime statistics of the thread.
+/// @note Runtime is the wall-clock time elapsed since the thread was started.
+/// @note On FreeRTOS CPU time is available only when run-time stats are enabled (configGENERATE_RUN_TIME_STATS and
+///       configUSE_TRACE_FACILITY) and OSAL_RUN_TIME_COUNTER_HZ describes frequency of the run-time counter.
+///       Otherwise it is reported as 0. FreeRTOS doesn't count context switches, so they are always reported as 0.
+struct OsalThreadStats {
+    uint64_t cpuTimeNs;
+    uint64_t runtimeNs;
+    uint64_t voluntarySwitches;
+    uint64_t involuntarySwitches;
+};
+
+/// Returns runtime statistics of the given thread.
+/// @param thread           Thread to be queried.
+/// @param stats            Output argument where the statistics will be stored.
+/// @return Error code of the operation.
+/// @note Statistics are available only while the thread is running. Querying thread, whose function has already
+///       returned, fails with eOsError even if the thread hasn't been joined yet.
+OsalError osalThreadGetStats(OsalThread* thread, OsalThreadStats* stats);
+
 /// Invokes context switch in the scheduler on demand.
 /// @note It is up to the scheduler which thread will be selected to be executed next. It is possible, that
 ///       it will be the same thread which called this function.
@@ -122,17 +247,53 @@ void osalThreadYield();
 /// Returns numerical id of the current thread.
 /// @return Numerical id of the current thread.
 /// @note It is up to the concrete implementation what this number means. The only thing that caller can depend on
-///       is that on the given platform this value will be unique among all created threads.
+///       is that on the given platform this value will be unique among all living threads.
+/// @note On Linux this is the kernel thread id (gettid) and on FreeRTOS the task handle. Value is cached per thread,
+///       so only the first call in each thread queries the system.
 uint32_t osalThreadId();
 
+/// Returns index of the CPU, on which the current thread is running.
+/// @return Index of the CPU, on which the current thread is running.
+/// @note Unless thread is pinned to a single CPU, returned value may be outdated right after the call.
+uint32_t osalThreadCurrentCpu();
+
+/// Returns number of CPUs, on which the current thread is allowed to run.
+/// @return Number of CPUs, on which the current thread is allowed to run (at least 1).
+uint32_t osalThreadCpuCount();
+
 /// Returns name of the current thread.
 /// @param name             Memory block where the name should be stored.
 /// @param size             Size of the given memory block.
 /// @return Error code of the operation.
 /// @note Returned name will be the same as the one provided in upon thread creation.
 /// @note Returned name will always be NULL-terminated.
+/// @note On Linux name is cached per thread, so only the first call in each thread queries the system.
 OsalError osalThreadName(char* name, size_t size);
 
+/// Maximal size of the thread name (including the NULL-terminator) reported by osalThreadEnumerate().
+static const size_t cOsalThreadInfoNameSize = 16;
+
+/// Represents information about the live thread created with the OSAL API.
+/// @note Start timestamp is expressed in the same time base as osalTimestampNs().
+/// @note Name is truncated to cOsalThreadInfoNameSize - 1 characters and is always NULL-terminated.
+struct OsalThreadInfo {
+    uint32_t id;
+    OsalThreadPriority priority;
+    uint64_t startTimestampNs;
+    char name[cOsalThreadInfoNameSize];
+};
+
+/// Returns information about all live threads created with the OSAL API.
+/// @param infos            Array where information about the live threads will be stored. Can be NULL if size is 0.
+/// @param size             Number of elements in the given array.
+/// @param count            Output argument where the total number of the live threads will be stored.
+/// @return Error code of the operation.
+/// @note If count is bigger than size, then only first size threads are stored in the given array.
+/// @note Thread is reported from the moment it starts running (on Linux before osalThreadCreate() returns) until its
+///       user function returns. Threads created outside of OSAL (e.g. the main thread) are not reported.
+/// @note Registry doesn't allocate any memory and enumeration only copies the registered entries under a lock.
+OsalError osalThreadEnumerate(OsalThreadInfo* infos, size_t size, size_t* count);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,84 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "internal/ThreadLocalImpl.h"
+#include "osal/Error.h"
+
+#include <stdbool.h> // NOLINT(modernize-deprecated-headers,hicpp-deprecated-headers)
+
+/// Represents OSAL thread-local storage slot handle. Each thread sees its own value stored in the slot.
+/// @note Size of this structure depends on the concrete implementation. In particular, ThreadLocalImpl
+///       contains objects from the target platform. Thus depending on its size is not recommended.
+/// @note Number of slots is limited by the platform (PTHREAD_KEYS_MAX on Linux and
+///       configNUM_THREAD_LOCAL_STORAGE_POINTERS on FreeRTOS).
+/// @note On FreeRTOS slots are permanent: index of the destroyed slot is never reused, so at most
+///       configNUM_THREAD_LOCAL_STORAGE_POINTERS slots can be created during the lifetime of the program.
+struct OsalThreadLocal {
+    ThreadLocalImpl impl;
+    bool initialized;
+};
+
+/// Creates new thread-local storage slot. Initially each thread sees NULL value in the slot.
+/// @param local            Thread-local storage handle to be initialized.
+/// @param destructor       Function called at thread exit with non-NULL value of that thread (can be NULL).
+/// @return Error code of the operation.
+/// @note On FreeRTOS destructor is called only if configTHREAD_LOCAL_STORAGE_DELETE_CALLBACKS is enabled.
+OsalError osalThreadLocalCreate(OsalThreadLocal* local, void (*destructor)(void*));
+
+/// Destroys thread-local storage slot represented by the given handle.
+/// @param local            Thread-local storage handle to be destroyed.
+/// @return Error code of the operation.
+/// @note Destructor is not called for values, which are still stored in the slot by running threads.
+/// @note On FreeRTOS the slot index is not released, see OsalThreadLocal.
+OsalError osalThreadLocalDestroy(OsalThreadLocal* local);
+
+/// Returns value stored in the given slot by the current thread.
+/// @param local            Thread-local storage handle to be used.
+/// @return Value stored in the given slot by the current thread or NULL if slot is invalid or value was not set.
+void* osalThreadLocalGet(const OsalThreadLocal* local);
+
+/// Stores the given value in the given slot for the current thread.
+/// @param local            Thread-local storage handle to be used.
+/// @param value            Value to be stored.
+/// @return Error code of the operation.
+/// @note Previous value is overwritten without calling the destructor.
+OsalError osalThreadLocalSet(OsalThreadLocal* local, void* value);
+
+#ifdef __cplusplus
+}
+#endif
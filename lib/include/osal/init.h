@@ -36,12 +36,60 @@
 extern "C" {
 #endif
 
+#include <stdbool.h> // NOLINT(modernize-deprecated-headers,hicpp-deprecated-headers)
+#include <stddef.h>  // NOLINT(modernize-deprecated-headers,hicpp-deprecated-headers)
+
+/// Represents optional real-time configuration of the process applied during OSAL initialization.
+/// @note Zero-initialized configuration doesn't change anything in the process.
+/// @note Memory locking uses mlockall(MCL_CURRENT | MCL_FUTURE), so all current and future mappings (including
+///       stacks of threads created later) stay resident. It usually requires CAP_IPC_LOCK or big enough
+///       RLIMIT_MEMLOCK.
+/// @note Heap reserve is allocated, touched and released back to the allocator, which is then configured to neither
+///       trim the heap nor serve big allocations with separate mappings. This way later allocations of up to that
+///       size don't cause page faults. Glibc uses separate arenas for threads, so this covers mainly the allocations
+///       of the initializing thread.
+/// @note Stack prefault size is applied to the calling thread and to every thread created later with the OSAL API.
+///       It is clamped to the size of the stack.
+/// @note On Linux transparent huge pages are disabled for the whole process, so it is never stalled by the
+///       compaction needed to allocate them.
+/// @note On FreeRTOS all memory is always resident, so these options don't have to do anything and always succeed.
+struct OsalInitConfig {
+    bool lockMemory;
+    size_t heapReserveSize;
+    size_t stackPrefaultSize;
+    bool disableTransparentHugePages;
+};
+
+/// Represents outcome of the real-time configuration applied during OSAL initialization.
+/// @note Flags related to the options, which were not requested, are set to false. Real-time scheduling flag
+///       indicates if threads can be created with ePolicyFifo and ePolicyRoundRobin policies without falling back to
+///       ePolicyOther. It is checked by creating a short-lived probe thread.
+struct OsalInitReport {
+    bool memoryLocked;
+    bool heapPrefaulted;
+    bool stackPrefaulted;
+    bool transparentHugePagesDisabled;
+    bool realtimeScheduling;
+};
+
 /// Initializes OSAL internal modules.
 /// @return Flag indicating if the initialization was successful.
 /// @retval true            Initialization was successful.
 /// @retval false           Some errors occurred during the initialization. OSAL may not be functional.
 bool osalInit();
 
+/// Initializes OSAL internal modules and applies the given real-time configuration of the process.
+/// @param config           Real-time configuration to be applied. Can be NULL, which is equivalent to osalInit().
+/// @param report           Output argument where the outcome of the configuration will be stored. Can be NULL.
+/// @return Flag indicating if the initialization was successful.
+/// @retval true            Initialization was successful and all requested options have been applied.
+/// @retval false           Some errors occurred during the initialization or some of the requested options couldn't
+///                         be applied. Details can be checked in the report. OSAL remains functional if only the
+///                         requested options failed.
+/// @note This function is meant to be called once, at the beginning of the main thread, before other threads are
+///       started.
+bool osalInitEx(const OsalInitConfig* config, OsalInitReport* report);
+
 #ifdef __cplusplus
 }
 #endif
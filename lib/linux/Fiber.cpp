@@ -0,0 +1,201 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#include "osal/Fiber.h"
+
+#include <cstddef>
+#include <cstdint>
+
+/// Minimal size of the fiber stack accepted by osalFiberContextCreate().
+static constexpr std::size_t cMinStackSize = 256;
+
+#if defined(__x86_64__)
+extern "C" {
+
+/// Saves callee-saved registers on the current stack, stores stack pointer in "from" and restores registers
+/// from the "to" stack.
+/// @param from             Location where stack pointer of the current context should be stored.
+/// @param to               Stack pointer of the context to be resumed.
+void osalFiberSwitchStack(void** from, void* to);
+
+/// First code executed by the new fiber. It calls function from r12 with argument from r13.
+void osalFiberEntry();
+}
+
+// Only callee-saved registers (System V ABI) together with SSE and x87 control words have to be preserved, because
+// the switch itself is an ordinary function call. This is what makes it much cheaper than swapcontext(), which also
+// saves signal mask with a syscall.
+asm(R"(
+    .text
+    .globl osalFiberSwitchStack
+    .hidden osalFiberSwitchStack
+    .type osalFiberSwitchStack, @function
+osalFiberSwitchStack:
+    pushq %rbp
+    pushq %rbx
+    pushq %r15
+    pushq %r14
+    pushq %r13
+    pushq %r12
+    subq $8, %rsp
+    stmxcsr (%rsp)
+    fnstcw 4(%rsp)
+    movq %rsp, (%rdi)
+    movq %rsi, %rsp
+    ldmxcsr (%rsp)
+    fldcw 4(%rsp)
+    addq $8, %rsp
+    popq %r12
+    popq %r13
+    popq %r14
+    popq %r15
+    popq %rbx
+    popq %rbp
+    ret
+    .size osalFiberSwitchStack, .-osalFiberSwitchStack
+
+    .globl osalFiberEntry
+    .hidden osalFiberEntry
+    .type osalFiberEntry, @function
+osalFiberEntry:
+    movq %r13, %rdi
+    callq *%r12
+    ud2
+    .size osalFiberEntry, .-osalFiberEntry
+)");
+
+/// Initial frame of the new fiber, laid out the same way as osalFiberSwitchStack() leaves the suspended stack.
+struct InitialFrame {
+    std::uint32_t mxcsr;
+    std::uint32_t fpuControlWord;
+    void (*func)(void*);
+    void* param;
+    std::uint64_t r14;
+    std::uint64_t r15;
+    std::uint64_t rbx;
+    std::uint64_t rbp;
+    void (*returnAddress)();
+};
+
+/// Default value of the MXCSR register defined by the System V ABI.
+static constexpr std::uint32_t cDefaultMxcsr = 0x1f80;
+
+/// Default value of the x87 FPU control word defined by the System V ABI.
+static constexpr std::uint32_t cDefaultFpuControlWord = 0x037f;
+
+/// Required alignment of the stack pointer at the function call.
+static constexpr std::uintptr_t cStackAlignment = 16;
+
+OsalError osalFiberContextCreate(OsalFiberContext* context,
+                                 void* stack,
+                                 size_t stackSize,
+                                 void (*func)(void*),
+                                 void* param)
+{
+    if (context == nullptr || stack == nullptr || stackSize < cMinStackSize || func == nullptr)
+        return OsalError::eInvalidArgument;
+
+    // After returning to osalFiberEntry() stack pointer has to be aligned, so that "callq" creates a valid frame.
+    auto top = (reinterpret_cast<std::uintptr_t>(stack) + stackSize) & ~(cStackAlignment - 1);
+    auto* frame = reinterpret_cast<InitialFrame*>(top - sizeof(std::uint64_t) - offsetof(InitialFrame, returnAddress));
+    *frame = {cDefaultMxcsr, cDefaultFpuControlWord, func, param, 0, 0, 0, 0, osalFiberEntry};
+
+    context->impl.stackPointer = frame;
+    context->initialized = true;
+    return OsalError::eOk;
+}
+
+OsalError osalFiberContextSwitch(OsalFiberContext* from, OsalFiberContext* to)
+{
+    if (from == nullptr || to == nullptr || !to->initialized)
+        return OsalError::eInvalidArgument;
+
+    from->initialized = true;
+    osalFiberSwitchStack(&from->impl.stackPointer, to->impl.stackPointer);
+    return OsalError::eOk;
+}
+#else
+    #include <ucontext.h>
+
+/// Number of bits in the single argument passed by makecontext().
+static constexpr unsigned int cArgumentBits = 32;
+
+/// Calls the fiber function, which pointer and argument are split into 32-bit halves by makecontext().
+static void fiberEntry(unsigned int funcHigh, unsigned int funcLow, unsigned int paramHigh, unsigned int paramLow)
+{
+    auto func = (std::uintptr_t{funcHigh} << cArgumentBits) | funcLow;
+    auto param = (std::uintptr_t{paramHigh} << cArgumentBits) | paramLow;
+    reinterpret_cast<void (*)(void*)>(func)(reinterpret_cast<void*>(param));
+}
+
+OsalError osalFiberContextCreate(OsalFiberContext* context,
+                                 void* stack,
+                                 size_t stackSize,
+                                 void (*func)(void*),
+                                 void* param)
+{
+    if (context == nullptr || stack == nullptr || stackSize < cMinStackSize || func == nullptr)
+        return OsalError::eInvalidArgument;
+
+    if (getcontext(&context->impl.context) != 0)
+        return OsalError::eOsError;
+
+    context->impl.context.uc_stack.ss_sp = stack;
+    context->impl.context.uc_stack.ss_size = stackSize;
+    context->impl.context.uc_link = nullptr;
+
+    auto funcValue = reinterpret_cast<std::uintptr_t>(func);
+    auto paramValue = reinterpret_cast<std::uintptr_t>(param);
+    makecontext(&context->impl.context,
+                reinterpret_cast<void (*)()>(fiberEntry),
+                4,
+                static_cast<unsigned int>(std::uint64_t{funcValue} >> cArgumentBits),
+                static_cast<unsigned int>(funcValue),
+                static_cast<unsigned int>(std::uint64_t{paramValue} >> cArgumentBits),
+                static_cast<unsigned int>(paramValue));
+
+    context->initialized = true;
+    return OsalError::eOk;
+}
+
+OsalError osalFiberContextSwitch(OsalFiberContext* from, OsalFiberContext* to)
+{
+    if (from == nullptr || to == nullptr || !to->initialized)
+        return OsalError::eInvalidArgument;
+
+    from->initialized = true;
+    if (swapcontext(&from->impl.context, &to->impl.context) != 0)
+        return OsalError::eOsError;
+
+    return OsalError::eOk;
+}
+#endif
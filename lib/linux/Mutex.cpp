@@ -32,47 +32,303 @@
 
 #include "osal/Mutex.h"
 
+#include "cpuPriv.hpp"
+#include "futexPriv.hpp"
+#include "osal/Thread.h"
 #include "osal/common/format.hpp"
 #include "osal/common/logger.hpp"
+#include "osal/common/mutexStats.hpp"
 #include "osal/timestamp.h"
+#include "threadPriv.hpp"
+#include "timestampPriv.hpp"
 
+#include <pthread.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cerrno>
-#include <chrono>
+#include <cstdint>
 #include <cstring>
 #include <ctime>
 
-OsalError osalMutexCreate(OsalMutex* mutex, OsalMutexType type)
+/// Locks the futex word of the given mutex in the contended case. If mutex is currently locked, then the calling
+/// thread is put to sleep in the kernel until mutex is released or the specified deadline is reached.
+/// @param impl             Mutex implementation to be locked.
+/// @param deadline         Absolute CLOCK_MONOTONIC deadline of the operation or nullptr for infinite wait.
+/// @return Flag indicating if mutex has been locked.
+static bool lockContended(MutexImpl* impl, const timespec* deadline)
 {
-    if (mutex == nullptr) {
-        MutexLogger::error("Failed to create mutex: mutex=nullptr");
-        return OsalError::eInvalidArgument;
+    std::atomic_ref state(impl->state);
+
+    // Mark mutex as contended (2), so that the owner knows that it has to wake somebody up during unlock.
+    auto value = state.exchange(2, std::memory_order_acquire);
+    while (value != 0) {
+        if (futexWait(&impl->state, 2, deadline) == ETIMEDOUT)
+            return false;
+
+        value = state.exchange(2, std::memory_order_acquire);
     }
 
-    mutex->initialized = false;
+    return true;
+}
+
+/// Tries to lock the futex word of the given mutex by spinning with exponential backoff. Spinning stops, when
+/// the spin budget of the mutex is exhausted.
+/// @param impl             Mutex implementation to be locked.
+/// @return Flag indicating if mutex has been locked.
+static bool lockSpinning(MutexImpl* impl)
+{
+    constexpr std::uint32_t cMaxBackoff = 64;
+
+    std::atomic_ref state(impl->state);
+    auto spinBudget = std::atomic_ref(impl->spinBudget).load(std::memory_order_relaxed);
+    std::uint32_t backoff = 1;
+
+    for (std::uint32_t spins = 0; spins < spinBudget; spins += backoff) {
+        for (std::uint32_t i = 0; i < backoff; ++i)
+            cpuRelax();
+
+        // Try to lock only when the mutex looks free to avoid bouncing the cache line between spinning cores.
+        if (state.load(std::memory_order_relaxed) == 0 && osalMutexImplFastLock(impl))
+            return true;
+
+        backoff = std::min(backoff * 2, cMaxBackoff);
+    }
+
+    return false;
+}
 
-    auto mutexType = (type == OsalMutexType::eRecursive) ? PTHREAD_MUTEX_RECURSIVE : PTHREAD_MUTEX_NORMAL;
+/// Checks if the given mutex is implemented with the pthread mutex.
+/// @param mutex            Mutex to be checked.
+/// @return Flag indicating if the given mutex is implemented with the pthread mutex.
+/// @note Process-shared mutexes always use pthread mutex, because robustness relies on the kernel robust futex list.
+static bool isPthreadMutex(const OsalMutex* mutex)
+{
+    return mutex->protocol != OsalMutexProtocol::eNoPriorityProtocol || mutex->processShared;
+}
+
+/// Locks the given pthread mutex.
+/// @param impl             Mutex implementation to be locked.
+/// @param block            Flag indicating if the calling thread should block, when mutex is locked by someone else.
+/// @param deadline         Absolute CLOCK_MONOTONIC deadline of the operation or nullptr for infinite wait.
+/// @param waitStartNs      Output argument where the timestamp of the start of the contended wait will be stored
+///                         or nullptr if contention shouldn't be detected.
+/// @return Error code of the operation.
+static OsalError lockPthreadMutex(MutexImpl* impl, bool block, const timespec* deadline, std::uint64_t* waitStartNs)
+{
+    // Blocking lock always starts with the non-blocking attempt, so that contention can be detected.
+    int result = pthread_mutex_trylock(&impl->handle);
+    if (block && result == EBUSY) {
+        if (waitStartNs != nullptr)
+            *waitStartNs = osalTimestampNs();
+
+        if (deadline == nullptr)
+            result = pthread_mutex_lock(&impl->handle);
+        else
+            result = pthread_mutex_clocklock(&impl->handle, CLOCK_MONOTONIC, deadline);
+    }
+
+    if (result == EOWNERDEAD) {
+        // Ownership has been transferred to the calling thread, so mutex can be made usable again. Consistency of
+        // the protected data is the responsibility of the caller.
+        pthread_mutex_consistent(&impl->handle);
+        return OsalError::eOwnerDead;
+    }
+
+    switch (result) {
+        case 0: return OsalError::eOk;
+        case EAGAIN: [[fallthrough]];
+        case EBUSY: return OsalError::eLocked;
+        case ETIMEDOUT: return OsalError::eTimeout;
+        case EINVAL: return OsalError::eInvalidArgument;
+        default: return OsalError::eOsError;
+    }
+}
+
+/// Locks the given mutex according to its type.
+/// @param mutex            Mutex to be locked.
+/// @param block            Flag indicating if the calling thread should block, when mutex is locked by someone else.
+/// @param deadline         Absolute CLOCK_MONOTONIC deadline of the operation or nullptr for infinite wait.
+/// @param waitStartNs      Output argument where the timestamp of the start of the contended wait will be stored
+///                         or nullptr if contention shouldn't be detected.
+/// @return Error code of the operation.
+static OsalError acquireMutex(OsalMutex* mutex, bool block, const timespec* deadline, std::uint64_t* waitStartNs)
+{
+    auto& impl = mutex->impl;
+    if (isPthreadMutex(mutex))
+        return lockPthreadMutex(&impl, block, deadline, waitStartNs);
+
+    bool recursive = (mutex->type == OsalMutexType::eRecursive);
+
+    if (recursive && std::atomic_ref(impl.owner).load(std::memory_order_relaxed) == osalThreadId()) {
+        ++impl.count;
+        return OsalError::eOk;
+    }
 
+    if (!osalMutexImplFastLock(&impl)) {
+        if (!block)
+            return OsalError::eLocked;
+
+        if (waitStartNs != nullptr)
+            *waitStartNs = osalTimestampNs();
+
+        bool locked = (mutex->type == OsalMutexType::eAdaptive) && lockSpinning(&impl);
+        if (!locked && !lockContended(&impl, deadline))
+            return OsalError::eTimeout;
+    }
+
+    if (recursive) {
+        std::atomic_ref(impl.owner).store(osalThreadId(), std::memory_order_relaxed);
+        impl.count = 1;
+    }
+
+    return OsalError::eOk;
+}
+
+/// Locks the given mutex and records the acquisition in its statistics, if they are enabled.
+/// @param mutex            Mutex to be locked.
+/// @param block            Flag indicating if the calling thread should block, when mutex is locked by someone else.
+/// @param deadline         Absolute CLOCK_MONOTONIC deadline of the operation or nullptr for infinite wait.
+/// @return Error code of the operation.
+static OsalError lockMutex(OsalMutex* mutex, bool block, const timespec* deadline)
+{
+    auto* stats = mutex->stats;
+    if (stats == nullptr)
+        return acquireMutex(mutex, block, deadline, nullptr);
+
+    // Timestamp is set only when the calling thread had to wait for the mutex.
+    std::uint64_t waitStartNs{};
+    auto error = acquireMutex(mutex, block, deadline, &waitStartNs);
+    if (error == OsalError::eOk)
+        mutexStatsOnLock(stats, waitStartNs != 0, waitStartNs);
+
+    return error;
+}
+
+/// Initializes pthread mutex of the given mutex according to the given configuration.
+/// @param mutex            Mutex to be initialized.
+/// @param config           Configuration of the mutex.
+/// @return Error code of the operation.
+static OsalError createPthreadMutex(OsalMutex* mutex, OsalMutexConfig config)
+{
     pthread_mutexattr_t attr{};
     pthread_mutexattr_init(&attr);
+
+    int mutexType{};
+    switch (config.type) {
+        case OsalMutexType::eRecursive: mutexType = PTHREAD_MUTEX_RECURSIVE; break;
+        case OsalMutexType::eAdaptive: mutexType = PTHREAD_MUTEX_ADAPTIVE_NP; break;
+        default: mutexType = PTHREAD_MUTEX_NORMAL; break;
+    }
+
     [[maybe_unused]] auto result = pthread_mutexattr_settype(&attr, mutexType);
     assert(result == 0);
 
-    pthread_mutex_t handle{};
-    result = pthread_mutex_init(&handle, &attr);
-    assert(result == 0);
+    if (mutex->processShared) {
+        result = pthread_mutexattr_setpshared(&attr, PTHREAD_PROCESS_SHARED);
+        assert(result == 0);
+
+        result = pthread_mutexattr_setrobust(&attr, PTHREAD_MUTEX_ROBUST);
+        assert(result == 0);
+    }
+
+    if (config.protocol == OsalMutexProtocol::ePriorityInheritance) {
+        result = pthread_mutexattr_setprotocol(&attr, PTHREAD_PRIO_INHERIT);
+        assert(result == 0);
+    }
+    else if (config.protocol == OsalMutexProtocol::ePriorityCeiling) {
+        result = pthread_mutexattr_setprotocol(&attr, PTHREAD_PRIO_PROTECT);
+        assert(result == 0);
+
+        result = pthread_mutexattr_setprioceiling(&attr, toNativePriority(config.ceiling));
+        assert(result == 0);
+    }
 
+    result = pthread_mutex_init(&mutex->impl.handle, &attr);
     pthread_mutexattr_destroy(&attr);
-    assert(result == 0);
+    return (result == 0) ? OsalError::eOk : OsalError::eOsError;
+}
+
+/// Initializes the given mutex in place according to the given configuration.
+/// @param mutex            Mutex handle to be initialized.
+/// @param config           Configuration of the mutex.
+/// @param processShared    Flag indicating if mutex should be shared between processes.
+/// @return Error code of the operation.
+static OsalError createMutex(OsalMutex* mutex, OsalMutexConfig config, bool processShared)
+{
+    if (mutex == nullptr) {
+        MutexLogger::error("Failed to create mutex: mutex=nullptr");
+        return OsalError::eInvalidArgument;
+    }
+
+    mutex->initialized = false;
+
+    switch (config.type) {
+        case OsalMutexType::eRecursive: [[fallthrough]];
+        case OsalMutexType::eNonRecursive: [[fallthrough]];
+        case OsalMutexType::eAdaptive: break;
+        default:
+            MutexLogger::error("Failed to create mutex: invalid type");
+            return OsalError::eInvalidArgument;
+    }
+
+    switch (config.protocol) {
+        case OsalMutexProtocol::eNoPriorityProtocol: [[fallthrough]];
+        case OsalMutexProtocol::ePriorityInheritance: break;
+        case OsalMutexProtocol::ePriorityCeiling:
+            if (toNativePriority(config.ceiling) == -1) {
+                MutexLogger::error("Failed to create mutex: invalid ceiling");
+                return OsalError::eInvalidArgument;
+            }
+            break;
+        default:
+            MutexLogger::error("Failed to create mutex: invalid protocol");
+            return OsalError::eInvalidArgument;
+    }
+
+    if (config.type == OsalMutexType::eAdaptive && config.protocol != OsalMutexProtocol::eNoPriorityProtocol) {
+        MutexLogger::error("Failed to create mutex: adaptive mutex cannot use priority protocol");
+        return OsalError::eInvalidArgument;
+    }
+
+    mutex->impl = MutexImpl{};
+    mutex->impl.spinBudget = cOsalMutexDefaultSpinBudget;
+    mutex->type = config.type;
+    mutex->protocol = config.protocol;
+    mutex->stats = nullptr;
+    mutex->processShared = processShared;
+
+    if (isPthreadMutex(mutex)) {
+        if (auto error = createPthreadMutex(mutex, config); error != OsalError::eOk) {
+            MutexLogger::error("Failed to create mutex: pthread mutex initialization failed");
+            return error;
+        }
+    }
 
-    mutex->impl.handle = handle;
-    mutex->type = type;
     mutex->initialized = true;
 
-    MutexLogger::trace("Created mutex: type={}", type);
+    MutexLogger::trace(
+        "Created mutex: type={}, protocol={}, processShared={}", config.type, config.protocol, processShared);
     return OsalError::eOk;
 }
 
+OsalError osalMutexCreate(OsalMutex* mutex, OsalMutexType type)
+{
+    return osalMutexCreateEx(mutex, {type, cOsalMutexDefaultProtocol, cOsalThreadDefaultPriority});
+}
+
+OsalError osalMutexCreateEx(OsalMutex* mutex, OsalMutexConfig config)
+{
+    return createMutex(mutex, config, false);
+}
+
+OsalError osalMutexCreateShared(OsalMutex* mutex, OsalMutexConfig config)
+{
+    return createMutex(mutex, config, true);
+}
+
 OsalError osalMutexDestroy(OsalMutex* mutex)
 {
     if (mutex == nullptr || !mutex->initialized) {
@@ -80,8 +336,13 @@ OsalError osalMutexDestroy(OsalMutex* mutex)
         return OsalError::eInvalidArgument;
     }
 
-    [[maybe_unused]] auto result = pthread_mutex_destroy(&mutex->impl.handle);
-    assert(result == 0);
+    if (isPthreadMutex(mutex)) {
+        [[maybe_unused]] auto result = pthread_mutex_destroy(&mutex->impl.handle);
+        assert(result == 0);
+    }
+
+    if (mutex->stats != nullptr)
+        osalMutexDisableStats(mutex);
 
     std::memset(mutex, 0, sizeof(OsalMutex));
     MutexLogger::trace("Destroyed mutex");
@@ -95,8 +356,16 @@ OsalError osalMutexLock(OsalMutex* mutex)
         return OsalError::eInvalidArgument;
     }
 
-    [[maybe_unused]] auto result = pthread_mutex_lock(&mutex->impl.handle);
-    assert(result == 0);
+    auto error = lockMutex(mutex, true, nullptr);
+    if (error == OsalError::eOwnerDead) {
+        MutexLogger::warning("Locked mutex: previous owner died while holding it");
+        return OsalError::eOwnerDead;
+    }
+
+    if (error != OsalError::eOk) {
+        MutexLogger::error("Failed to lock mutex: error={}", static_cast<int>(error));
+        return error;
+    }
 
     MutexLogger::trace("Locked mutex");
     return OsalError::eOk;
@@ -109,16 +378,21 @@ OsalError osalMutexTryLock(OsalMutex* mutex)
         return OsalError::eInvalidArgument;
     }
 
-    auto result = pthread_mutex_trylock(&mutex->impl.handle);
-    switch (result) {
-        case EAGAIN: [[fallthrough]];
-        case EBUSY:
-            MutexLogger::debug("Failed to lock mutex: mutex locked by another client");
-            return OsalError::eLocked;
-        default: break;
+    auto error = lockMutex(mutex, false, nullptr);
+    if (error == OsalError::eLocked) {
+        MutexLogger::debug("Failed to lock mutex: mutex locked by another client");
+        return OsalError::eLocked;
     }
 
-    assert(result == 0);
+    if (error == OsalError::eOwnerDead) {
+        MutexLogger::warning("Locked mutex: previous owner died while holding it");
+        return OsalError::eOwnerDead;
+    }
+
+    if (error != OsalError::eOk) {
+        MutexLogger::error("Failed to tryLock mutex: error={}", static_cast<int>(error));
+        return error;
+    }
 
     MutexLogger::trace("Locked mutex");
     return OsalError::eOk;
@@ -140,28 +414,34 @@ OsalError osalMutexTryLockIsr(OsalMutex* mutex)
 }
 
 OsalError osalMutexTimedLock(OsalMutex* mutex, uint32_t timeoutMs)
+{
+    return osalMutexTimedLockUntil(mutex, osalTimestampNs() + osalMsToNs(timeoutMs));
+}
+
+OsalError osalMutexTimedLockUntil(OsalMutex* mutex, uint64_t deadlineNs)
 {
     if (mutex == nullptr || !mutex->initialized) {
         MutexLogger::error("Failed to timedLock mutex: invalid argument");
         return OsalError::eInvalidArgument;
     }
 
-    auto toTimespec = [](const auto& timePoint) {
-        auto secs = std::chrono::time_point_cast<std::chrono::seconds>(timePoint);
-        auto ns = std::chrono::time_point_cast<std::chrono::nanoseconds>(timePoint)
-                - std::chrono::time_point_cast<std::chrono::nanoseconds>(secs);
+    auto deadline = toMonotonicTimespec(deadlineNs);
+    auto error = lockMutex(mutex, true, &deadline);
+    if (error == OsalError::eTimeout) {
+        MutexLogger::debug("Failed to timedLock mutex: timeout, deadlineNs={}", deadlineNs);
+        return OsalError::eTimeout;
+    }
 
-        return timespec{int(secs.time_since_epoch().count()), int(ns.count())};
-    };
+    if (error == OsalError::eOwnerDead) {
+        MutexLogger::warning("Locked mutex: previous owner died while holding it");
+        return OsalError::eOwnerDead;
+    }
 
-    auto ts = toTimespec(std::chrono::system_clock::now() + std::chrono::milliseconds{timeoutMs});
-    auto result = pthread_mutex_timedlock(&mutex->impl.handle, &ts);
-    if (result == ETIMEDOUT) {
-        MutexLogger::debug("Failed to timedLock mutex: timeout, timeoutMs={}", timeoutMs);
-        return OsalError::eTimeout;
+    if (error != OsalError::eOk) {
+        MutexLogger::error("Failed to timedLock mutex: error={}", static_cast<int>(error));
+        return error;
     }
 
-    assert(result == 0);
     MutexLogger::trace("Locked mutex");
     return OsalError::eOk;
 }
@@ -173,8 +453,59 @@ OsalError osalMutexUnlock(OsalMutex* mutex)
         return OsalError::eInvalidArgument;
     }
 
-    [[maybe_unused]] auto result = pthread_mutex_unlock(&mutex->impl.handle);
-    assert(result == 0);
+    auto& impl = mutex->impl;
+    auto* stats = mutex->stats;
+    if (isPthreadMutex(mutex)) {
+        MutexStatsRelease release{};
+        if (stats != nullptr)
+            release = mutexStatsPrepareUnlock(stats);
+
+        if (pthread_mutex_unlock(&impl.handle) != 0) {
+            MutexLogger::error("Failed to unlock mutex: mutex is not owned by the calling thread");
+            return OsalError::eNotOwner;
+        }
+
+        if (stats != nullptr)
+            mutexStatsOnUnlock(stats, release);
+
+        MutexLogger::trace("Unlocked mutex");
+        return OsalError::eOk;
+    }
+
+    if (mutex->type == OsalMutexType::eRecursive) {
+        if (std::atomic_ref(impl.owner).load(std::memory_order_relaxed) != osalThreadId()) {
+            MutexLogger::error("Failed to unlock mutex: mutex is not owned by the calling thread");
+            return OsalError::eNotOwner;
+        }
+    }
+
+    MutexStatsRelease release{};
+    if (stats != nullptr)
+        release = mutexStatsPrepareUnlock(stats);
+
+    if (mutex->type == OsalMutexType::eRecursive) {
+        if (--impl.count != 0) {
+            MutexLogger::trace("Unlocked mutex");
+            return OsalError::eOk;
+        }
+
+        std::atomic_ref(impl.owner).store(0, std::memory_order_relaxed);
+    }
+
+    if (!osalMutexImplFastUnlock(&impl)) {
+        auto state = std::atomic_ref(impl.state).exchange(0, std::memory_order_release);
+        if (state == 0) {
+            MutexLogger::error("Failed to unlock mutex: mutex is not locked");
+            return OsalError::eNotLocked;
+        }
+
+        if (state == 2)
+            futexWake(&impl.state);
+    }
+
+    if (stats != nullptr)
+        mutexStatsOnUnlock(stats, release);
+
     MutexLogger::trace("Unlocked mutex");
     return OsalError::eOk;
 }
@@ -188,3 +519,15 @@ OsalError osalMutexUnlockIsr(OsalMutex* mutex)
 
     return osalMutexUnlock(mutex);
 }
+
+OsalError osalMutexSetSpinBudget(OsalMutex* mutex, uint32_t spinBudget)
+{
+    if (mutex == nullptr || !mutex->initialized || mutex->type != OsalMutexType::eAdaptive) {
+        MutexLogger::error("Failed to set spin budget: invalid argument");
+        return OsalError::eInvalidArgument;
+    }
+
+    std::atomic_ref(mutex->impl.spinBudget).store(spinBudget, std::memory_order_relaxed);
+    MutexLogger::trace("Set spin budget: spinBudget={}", spinBudget);
+    return OsalError::eOk;
+}
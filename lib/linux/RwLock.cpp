@@ -0,0 +1,229 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#include "osal/RwLock.h"
+
+#include "osal/timestamp.h"
+#include "timestampPriv.hpp"
+
+#include <pthread.h>
+
+#include <cassert>
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+
+/// Converts result of the pthread locking function to the OSAL error code.
+/// @param result           Result of the pthread locking function.
+/// @return OSAL error code corresponding to the given result.
+static OsalError toOsalError(int result)
+{
+    switch (result) {
+        case 0: return OsalError::eOk;
+        case EAGAIN: [[fallthrough]];
+        case EBUSY: return OsalError::eLocked;
+        case ETIMEDOUT: return OsalError::eTimeout;
+        default: return OsalError::eOsError;
+    }
+}
+
+/// Passes through the turnstile of the given fair reader-writer lock.
+/// @param impl             Reader-writer lock implementation to be used.
+/// @param block            Flag indicating if the calling thread should block, when turnstile is locked.
+/// @param deadline         Absolute CLOCK_MONOTONIC deadline of the operation or nullptr for infinite wait.
+/// @return Error code of the operation.
+/// @note On success turnstile is locked by the calling thread.
+static OsalError lockTurnstile(RwLockImpl* impl, bool block, const timespec* deadline)
+{
+    int result{};
+    if (!block)
+        result = pthread_mutex_trylock(&impl->turnstile);
+    else if (deadline == nullptr)
+        result = pthread_mutex_lock(&impl->turnstile);
+    else
+        result = pthread_mutex_clocklock(&impl->turnstile, CLOCK_MONOTONIC, deadline);
+
+    return toOsalError(result);
+}
+
+/// Locks the given reader-writer lock for reading or writing.
+/// @param rwLock           Reader-writer lock to be locked.
+/// @param write            Flag indicating if the lock should be acquired for writing.
+/// @param block            Flag indicating if the calling thread should block, when lock cannot be acquired.
+/// @param deadline         Absolute CLOCK_MONOTONIC deadline of the operation or nullptr for infinite wait.
+/// @return Error code of the operation.
+static OsalError lockRwLock(OsalRwLock* rwLock, bool write, bool block, const timespec* deadline)
+{
+    if (rwLock == nullptr || !rwLock->initialized)
+        return OsalError::eInvalidArgument;
+
+    auto* impl = &rwLock->impl;
+    bool fair = (rwLock->policy == OsalRwLockPolicy::eFair);
+    if (fair) {
+        if (auto error = lockTurnstile(impl, block, deadline); error != OsalError::eOk)
+            return error;
+    }
+
+    int result{};
+    if (!block)
+        result = write ? pthread_rwlock_trywrlock(&impl->handle) : pthread_rwlock_tryrdlock(&impl->handle);
+    else if (deadline == nullptr)
+        result = write ? pthread_rwlock_wrlock(&impl->handle) : pthread_rwlock_rdlock(&impl->handle);
+    else if (write)
+        result = pthread_rwlock_clockwrlock(&impl->handle, CLOCK_MONOTONIC, deadline);
+    else
+        result = pthread_rwlock_clockrdlock(&impl->handle, CLOCK_MONOTONIC, deadline);
+
+    if (fair)
+        pthread_mutex_unlock(&impl->turnstile);
+
+    return toOsalError(result);
+}
+
+/// Unlocks the given reader-writer lock.
+/// @param rwLock           Reader-writer lock to be unlocked.
+/// @return Error code of the operation.
+static OsalError unlockRwLock(OsalRwLock* rwLock)
+{
+    if (rwLock == nullptr || !rwLock->initialized)
+        return OsalError::eInvalidArgument;
+
+    if (pthread_rwlock_unlock(&rwLock->impl.handle) != 0)
+        return OsalError::eNotLocked;
+
+    return OsalError::eOk;
+}
+
+OsalError osalRwLockCreate(OsalRwLock* rwLock, OsalRwLockPolicy policy)
+{
+    if (rwLock == nullptr)
+        return OsalError::eInvalidArgument;
+
+    rwLock->initialized = false;
+
+    int kind{};
+    switch (policy) {
+        case OsalRwLockPolicy::ePreferReader: kind = PTHREAD_RWLOCK_PREFER_READER_NP; break;
+        // Fair lock orders threads with the turnstile, so the kind of the underlying lock doesn't matter much.
+        case OsalRwLockPolicy::ePreferWriter: [[fallthrough]];
+        case OsalRwLockPolicy::eFair: kind = PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP; break;
+        default: return OsalError::eInvalidArgument;
+    }
+
+    pthread_rwlockattr_t attr{};
+    pthread_rwlockattr_init(&attr);
+    [[maybe_unused]] auto result = pthread_rwlockattr_setkind_np(&attr, kind);
+    assert(result == 0);
+
+    result = pthread_rwlock_init(&rwLock->impl.handle, &attr);
+    pthread_rwlockattr_destroy(&attr);
+    if (result != 0)
+        return OsalError::eOsError;
+
+    if (policy == OsalRwLockPolicy::eFair && pthread_mutex_init(&rwLock->impl.turnstile, nullptr) != 0) {
+        pthread_rwlock_destroy(&rwLock->impl.handle);
+        return OsalError::eOsError;
+    }
+
+    rwLock->policy = policy;
+    rwLock->initialized = true;
+    return OsalError::eOk;
+}
+
+OsalError osalRwLockDestroy(OsalRwLock* rwLock)
+{
+    if (rwLock == nullptr || !rwLock->initialized)
+        return OsalError::eInvalidArgument;
+
+    [[maybe_unused]] auto result = pthread_rwlock_destroy(&rwLock->impl.handle);
+    assert(result == 0);
+
+    if (rwLock->policy == OsalRwLockPolicy::eFair) {
+        result = pthread_mutex_destroy(&rwLock->impl.turnstile);
+        assert(result == 0);
+    }
+
+    std::memset(rwLock, 0, sizeof(OsalRwLock));
+    return OsalError::eOk;
+}
+
+OsalError osalRwLockReadLock(OsalRwLock* rwLock)
+{
+    return lockRwLock(rwLock, false, true, nullptr);
+}
+
+OsalError osalRwLockReadTryLock(OsalRwLock* rwLock)
+{
+    return lockRwLock(rwLock, false, false, nullptr);
+}
+
+OsalError osalRwLockReadTimedLock(OsalRwLock* rwLock, uint32_t timeoutMs)
+{
+    return osalRwLockReadTimedLockUntil(rwLock, osalTimestampNs() + osalMsToNs(timeoutMs));
+}
+
+OsalError osalRwLockReadTimedLockUntil(OsalRwLock* rwLock, uint64_t deadlineNs)
+{
+    auto deadline = toMonotonicTimespec(deadlineNs);
+    return lockRwLock(rwLock, false, true, &deadline);
+}
+
+OsalError osalRwLockReadUnlock(OsalRwLock* rwLock)
+{
+    return unlockRwLock(rwLock);
+}
+
+OsalError osalRwLockWriteLock(OsalRwLock* rwLock)
+{
+    return lockRwLock(rwLock, true, true, nullptr);
+}
+
+OsalError osalRwLockWriteTryLock(OsalRwLock* rwLock)
+{
+    return lockRwLock(rwLock, true, false, nullptr);
+}
+
+OsalError osalRwLockWriteTimedLock(OsalRwLock* rwLock, uint32_t timeoutMs)
+{
+    return osalRwLockWriteTimedLockUntil(rwLock, osalTimestampNs() + osalMsToNs(timeoutMs));
+}
+
+OsalError osalRwLockWriteTimedLockUntil(OsalRwLock* rwLock, uint64_t deadlineNs)
+{
+    auto deadline = toMonotonicTimespec(deadlineNs);
+    return lockRwLock(rwLock, true, true, &deadline);
+}
+
+OsalError osalRwLockWriteUnlock(OsalRwLock* rwLock)
+{
+    return unlockRwLock(rwLock);
+}
@@ -32,35 +32,299 @@
 
 #include "osal/Semaphore.h"
 
+#include "futexPriv.hpp"
 #include "osal/timestamp.h"
+#include "timestampPriv.hpp"
 
-#include <cassert>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <atomic>
 #include <cerrno>
-#include <chrono>
+#include <climits>
+#include <cstdint>
 #include <cstring>
 #include <ctime>
+#include <limits>
 
-OsalError osalSemaphoreCreate(OsalSemaphore* semaphore, unsigned int initialValue)
+/// Flag in the futex word indicating presence of the waiters for a single token.
+static constexpr std::uint32_t cWaitersFlag = 1U << 0;
+
+/// Flag in the futex word indicating presence of the waiters for many tokens.
+static constexpr std::uint32_t cBatchWaitersFlag = 1U << 1;
+
+/// Position of the semaphore value in the futex word.
+static constexpr std::uint32_t cValueShift = 2;
+
+/// Maximal value of the eStandard semaphore.
+static constexpr std::uint32_t cMaxValue = std::numeric_limits<std::uint32_t>::max() >> cValueShift;
+
+/// Returns number of tokens stored in the given futex word.
+/// @param word             Futex word of the semaphore.
+/// @return Number of tokens stored in the given futex word.
+static constexpr std::uint32_t tokens(std::uint32_t word)
+{
+    return word >> cValueShift;
+}
+
+/// Initializes the given semaphore in place.
+/// @param semaphore        Semaphore handle to be initialized.
+/// @param initialValue     Initial value of the semaphore to be created.
+/// @param type             Type of the semaphore to be created.
+/// @param processShared    Flag indicating if semaphore should be shared between processes.
+/// @return Error code of the operation.
+static OsalError
+createSemaphore(OsalSemaphore* semaphore, unsigned int initialValue, OsalSemaphoreType type, bool processShared)
 {
     if (semaphore == nullptr)
         return OsalError::eInvalidArgument;
 
-    sem_t handle{};
-    [[maybe_unused]] auto result = sem_init(&handle, 0, initialValue);
-    assert(result == 0);
+    semaphore->initialized = false;
+
+    // Futex word of the process-shared semaphore is bound to its address, so it has to be initialized in place.
+    semaphore->impl = SemaphoreImpl{};
+    semaphore->impl.processShared = processShared;
+    semaphore->impl.fd = -1;
+
+    switch (type) {
+        case OsalSemaphoreType::eStandard:
+            if (initialValue > cMaxValue)
+                return OsalError::eInvalidArgument;
 
-    semaphore->impl.handle = handle;
+            semaphore->impl.word = initialValue << cValueShift;
+            break;
+        case OsalSemaphoreType::ePollable:
+            // Descriptor is non-blocking, so that waiting can be done with ppoll() and respect the deadline.
+            semaphore->impl.fd = eventfd(initialValue, EFD_SEMAPHORE | EFD_NONBLOCK | EFD_CLOEXEC);
+            if (semaphore->impl.fd == -1)
+                return OsalError::eOsError;
+            break;
+        default: return OsalError::eInvalidArgument;
+    }
+
+    semaphore->type = type;
     semaphore->initialized = true;
     return OsalError::eOk;
 }
 
+/// Checks if the given semaphore is implemented with eventfd.
+/// @param semaphore        Semaphore to be checked.
+/// @return Flag indicating if the given semaphore is implemented with eventfd.
+static bool isPollable(const OsalSemaphore* semaphore)
+{
+    return semaphore->type == OsalSemaphoreType::ePollable;
+}
+
+/// Takes single token from the eventfd semaphore, if it is available.
+/// @param fd               Eventfd descriptor of the semaphore.
+/// @return Flag indicating if token has been taken.
+static bool tryTakeEventToken(int fd)
+{
+    std::uint64_t value{};
+    return read(fd, &value, sizeof(value)) == sizeof(value);
+}
+
+/// Takes single token from the eventfd semaphore. If it is not available, then the calling thread waits in ppoll()
+/// until descriptor becomes readable or the specified deadline is reached.
+/// @param fd               Eventfd descriptor of the semaphore.
+/// @param deadline         Absolute CLOCK_MONOTONIC deadline of the operation or nullptr for infinite wait.
+/// @return Error code of the operation.
+static OsalError takeEventToken(int fd, const timespec* deadline)
+{
+    while (!tryTakeEventToken(fd)) {
+        if (errno != EAGAIN && errno != EINTR)
+            return OsalError::eOsError;
+
+        timespec remaining{};
+        if (deadline != nullptr) {
+            timespec now{};
+            clock_gettime(CLOCK_MONOTONIC, &now);
+
+            constexpr long cNsPerSecond = 1'000'000'000;
+            remaining.tv_sec = deadline->tv_sec - now.tv_sec;
+            remaining.tv_nsec = deadline->tv_nsec - now.tv_nsec;
+            if (remaining.tv_nsec < 0) {
+                --remaining.tv_sec;
+                remaining.tv_nsec += cNsPerSecond;
+            }
+
+            if (remaining.tv_sec < 0 || (remaining.tv_sec == 0 && remaining.tv_nsec == 0))
+                return OsalError::eTimeout;
+        }
+
+        pollfd descriptor{fd, POLLIN, 0};
+        if (ppoll(&descriptor, 1, (deadline != nullptr) ? &remaining : nullptr, nullptr) == -1 && errno != EINTR)
+            return OsalError::eOsError;
+    }
+
+    return OsalError::eOk;
+}
+
+/// Gives the given number of tokens to the eventfd semaphore.
+/// @param fd               Eventfd descriptor of the semaphore.
+/// @param count            Number of tokens to be given.
+/// @return Error code of the operation.
+static OsalError giveEventTokens(int fd, std::uint64_t count)
+{
+    if (count == 0)
+        return OsalError::eOk;
+
+    return (write(fd, &count, sizeof(count)) == sizeof(count)) ? OsalError::eOk : OsalError::eOsError;
+}
+
+/// Takes the given number of tokens from the semaphore, if they are available.
+/// @param impl             Semaphore implementation to be decremented.
+/// @param count            Number of tokens to be taken.
+/// @return Flag indicating if tokens have been taken.
+static bool tryAcquire(SemaphoreImpl* impl, std::uint32_t count)
+{
+    std::atomic_ref word(impl->word);
+
+    auto current = word.load();
+    while (tokens(current) >= count) {
+        if (word.compare_exchange_weak(current, current - (count << cValueShift)))
+            return true;
+    }
+
+    return false;
+}
+
+/// Unregisters the calling thread from the waiters of the given kind and clears the related flag in the futex word,
+/// if it was the last such waiter.
+/// @param impl             Semaphore implementation, which was waited on.
+/// @param counter          Counter of the waiters of the given kind.
+/// @param flag             Flag indicating presence of the waiters of the given kind.
+/// @note Flag is cleared speculatively before the counter is decremented. If another waiter has registered in the
+///       meantime, then flag is set again and waiters are woken up, because some tokens could have been released
+///       while the flag was cleared.
+static void leaveWaiters(SemaphoreImpl* impl, std::uint32_t& counter, std::uint32_t flag)
+{
+    std::atomic_ref word(impl->word);
+    std::atomic_ref waiters(counter);
+
+    auto lastGuess = (waiters.load() == 1);
+    if (lastGuess)
+        word.fetch_and(~flag);
+
+    auto previous = waiters.fetch_sub(1);
+    if (lastGuess && previous > 1) {
+        auto current = word.fetch_or(flag);
+        if (tokens(current) != 0)
+            futexWakeAll(&impl->word, impl->processShared);
+    }
+}
+
+/// Takes the given number of tokens from the semaphore. If they are not available, then the calling thread is put to
+/// sleep in the kernel until enough tokens are released or the specified deadline is reached.
+/// @param impl             Semaphore implementation to be decremented.
+/// @param count            Number of tokens to be taken.
+/// @param deadline         Absolute CLOCK_MONOTONIC deadline of the operation or nullptr for infinite wait.
+/// @return Error code of the operation.
+static OsalError acquire(SemaphoreImpl* impl, std::uint32_t count, const timespec* deadline)
+{
+    if (tryAcquire(impl, count))
+        return OsalError::eOk;
+
+    // Single-token and batch waiters sleep with different futex bitsets, so that they can be woken up separately.
+    auto batch = (count > 1);
+    auto& counter = batch ? impl->batchWaiters : impl->waiters;
+    auto flag = batch ? cBatchWaitersFlag : cWaitersFlag;
+    std::atomic_ref(counter).fetch_add(1);
+
+    // Flag is set in the same word, which is compared by the kernel before going to sleep. This guarantees, that
+    // either the signaling thread sees the flag, or the waiter sees the new value.
+    std::atomic_ref word(impl->word);
+    auto error = OsalError::eOk;
+    while (!tryAcquire(impl, count)) {
+        auto current = word.load();
+        if (tokens(current) >= count)
+            continue;
+
+        if ((current & flag) == 0) {
+            if (!word.compare_exchange_weak(current, current | flag))
+                continue;
+
+            current |= flag;
+        }
+
+        if (futexWait(&impl->word, current, deadline, impl->processShared, flag) == ETIMEDOUT) {
+            error = OsalError::eTimeout;
+            break;
+        }
+    }
+
+    leaveWaiters(impl, counter, flag);
+    return error;
+}
+
+/// Releases the given number of tokens to the semaphore and wakes up waiters, which can be satisfied by them.
+/// @param impl             Semaphore implementation to be incremented.
+/// @param count            Number of tokens to be released.
+/// @return Error code of the operation.
+/// @note If semaphore value would exceed cMaxValue, then nothing is released and OsalError::eOsError is returned.
+/// @note Single-token waiters are woken up first, at most one per released token. Batch waiters are woken up only if
+///       some released tokens are left for them. Demands of the batch waiters are not known, so all of them are woken
+///       up and compete for the tokens.
+/// @note Semaphore may be destroyed by the woken up waiter, so nothing but the futex word is accessed after the tokens
+///       are published.
+static OsalError release(SemaphoreImpl* impl, std::uint32_t count)
+{
+    // Shifted count has to fit into the value bits, otherwise it would overflow into the waiters flags.
+    if (count == 0 || count > cMaxValue)
+        return (count == 0) ? OsalError::eInvalidArgument : OsalError::eOsError;
+
+    auto* futex = &impl->word;
+    auto processShared = impl->processShared;
+    std::atomic_ref word(impl->word);
+
+    auto current = word.load(std::memory_order_relaxed);
+    do {
+        if (tokens(current) > cMaxValue - count)
+            return OsalError::eOsError;
+    } while (!word.compare_exchange_weak(current, current + (count << cValueShift)));
+
+    auto woken = 0;
+    if ((current & cWaitersFlag) != 0)
+        woken = futexWakeBitset(futex, static_cast<int>(count), cWaitersFlag, processShared);
+
+    if ((current & cBatchWaitersFlag) != 0 && static_cast<std::uint32_t>(woken) < count)
+        futexWakeBitset(futex, INT_MAX, cBatchWaitersFlag, processShared);
+
+    return OsalError::eOk;
+}
+
+OsalError osalSemaphoreCreate(OsalSemaphore* semaphore, unsigned int initialValue)
+{
+    return createSemaphore(semaphore, initialValue, cOsalSemaphoreDefaultType, false);
+}
+
+OsalError osalSemaphoreCreateEx(OsalSemaphore* semaphore, unsigned int initialValue, OsalSemaphoreType type)
+{
+    return createSemaphore(semaphore, initialValue, type, false);
+}
+
+OsalError osalSemaphoreCreateShared(OsalSemaphore* semaphore, unsigned int initialValue)
+{
+    return createSemaphore(semaphore, initialValue, OsalSemaphoreType::eStandard, true);
+}
+
+OsalError osalSemaphoreNativeHandle(OsalSemaphore* semaphore, int* handle)
+{
+    if (semaphore == nullptr || !semaphore->initialized || !isPollable(semaphore) || handle == nullptr)
+        return OsalError::eInvalidArgument;
+
+    *handle = semaphore->impl.fd;
+    return OsalError::eOk;
+}
+
 OsalError osalSemaphoreDestroy(OsalSemaphore* semaphore)
 {
     if (semaphore == nullptr || !semaphore->initialized)
         return OsalError::eInvalidArgument;
 
-    [[maybe_unused]] auto result = sem_destroy(&semaphore->impl.handle);
-    assert(result == 0);
+    if (isPollable(semaphore))
+        close(semaphore->impl.fd);
 
     std::memset(semaphore, 0, sizeof(OsalSemaphore));
     return OsalError::eOk;
@@ -68,24 +332,43 @@ OsalError osalSemaphoreDestroy(OsalSemaphore* semaphore)
 
 OsalError osalSemaphoreWait(OsalSemaphore* semaphore)
 {
-    if (semaphore == nullptr || !semaphore->initialized)
+    return osalSemaphoreWaitMany(semaphore, 1);
+}
+
+OsalError osalSemaphoreWaitMany(OsalSemaphore* semaphore, unsigned int count)
+{
+    if (semaphore == nullptr || !semaphore->initialized || count == 0)
         return OsalError::eInvalidArgument;
 
-    [[maybe_unused]] auto result = sem_wait(&semaphore->impl.handle);
-    assert(result == 0);
-    return OsalError::eOk;
+    if (isPollable(semaphore))
+        return (count == 1) ? takeEventToken(semaphore->impl.fd, nullptr) : OsalError::eInvalidArgument;
+
+    return acquire(&semaphore->impl, count, nullptr);
 }
 
 OsalError osalSemaphoreTryWait(OsalSemaphore* semaphore)
 {
-    if (semaphore == nullptr || !semaphore->initialized)
+    return osalSemaphoreTryWaitMany(semaphore, 1);
+}
+
+OsalError osalSemaphoreTryWaitMany(OsalSemaphore* semaphore, unsigned int count)
+{
+    if (semaphore == nullptr || !semaphore->initialized || count == 0)
         return OsalError::eInvalidArgument;
 
-    auto result = sem_trywait(&semaphore->impl.handle);
-    if (result == -1)
+    if (isPollable(semaphore)) {
+        if (count != 1)
+            return OsalError::eInvalidArgument;
+
+        if (tryTakeEventToken(semaphore->impl.fd))
+            return OsalError::eOk;
+
+        return (errno == EAGAIN) ? OsalError::eLocked : OsalError::eOsError;
+    }
+
+    if (!tryAcquire(&semaphore->impl, count))
         return OsalError::eLocked;
 
-    assert(result == 0);
     return OsalError::eOk;
 }
 
@@ -96,34 +379,45 @@ OsalError osalSemaphoreTryWaitIsr(OsalSemaphore* semaphore)
 
 OsalError osalSemaphoreTimedWait(OsalSemaphore* semaphore, uint32_t timeoutMs)
 {
-    if (semaphore == nullptr || !semaphore->initialized)
-        return OsalError::eInvalidArgument;
+    return osalSemaphoreTimedWaitManyUntil(semaphore, 1, osalTimestampNs() + osalMsToNs(timeoutMs));
+}
+
+OsalError osalSemaphoreTimedWaitMany(OsalSemaphore* semaphore, unsigned int count, uint32_t timeoutMs)
+{
+    return osalSemaphoreTimedWaitManyUntil(semaphore, count, osalTimestampNs() + osalMsToNs(timeoutMs));
+}
 
-    auto toTimespec = [](const auto& timePoint) {
-        auto secs = std::chrono::time_point_cast<std::chrono::seconds>(timePoint);
-        auto ns = std::chrono::time_point_cast<std::chrono::nanoseconds>(timePoint)
-                - std::chrono::time_point_cast<std::chrono::nanoseconds>(secs);
+OsalError osalSemaphoreTimedWaitUntil(OsalSemaphore* semaphore, uint64_t deadlineNs)
+{
+    return osalSemaphoreTimedWaitManyUntil(semaphore, 1, deadlineNs);
+}
 
-        return timespec{int(secs.time_since_epoch().count()), int(ns.count())};
-    };
+OsalError osalSemaphoreTimedWaitManyUntil(OsalSemaphore* semaphore, unsigned int count, uint64_t deadlineNs)
+{
+    if (semaphore == nullptr || !semaphore->initialized || count == 0)
+        return OsalError::eInvalidArgument;
 
-    auto ts = toTimespec(std::chrono::system_clock::now() + std::chrono::milliseconds{timeoutMs});
-    auto result = sem_timedwait(&semaphore->impl.handle, &ts);
-    if ((result == -1) && (errno == ETIMEDOUT))
-        return OsalError::eTimeout;
+    auto deadline = toMonotonicTimespec(deadlineNs);
+    if (isPollable(semaphore))
+        return (count == 1) ? takeEventToken(semaphore->impl.fd, &deadline) : OsalError::eInvalidArgument;
 
-    assert(result == 0);
-    return OsalError::eOk;
+    return acquire(&semaphore->impl, count, &deadline);
 }
 
 OsalError osalSemaphoreSignal(OsalSemaphore* semaphore)
 {
-    if (semaphore == nullptr || !semaphore->initialized)
+    return osalSemaphoreSignalMany(semaphore, 1);
+}
+
+OsalError osalSemaphoreSignalMany(OsalSemaphore* semaphore, unsigned int count)
+{
+    if (semaphore == nullptr || !semaphore->initialized || count == 0)
         return OsalError::eInvalidArgument;
 
-    [[maybe_unused]] auto result = sem_post(&semaphore->impl.handle);
-    assert(result == 0);
-    return OsalError::eOk;
+    if (isPollable(semaphore))
+        return giveEventTokens(semaphore->impl.fd, count);
+
+    return release(&semaphore->impl, count);
 }
 
 OsalError osalSemaphoreSignalIsr(OsalSemaphore* semaphore)
@@ -0,0 +1,287 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#include "osal/SpinLock.h"
+
+#include "cpuPriv.hpp"
+
+#include <sched.h>
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
+/// Number of busy-wait iterations, after which waiting thread yields the CPU to let the preempted owner finish.
+static constexpr std::uint32_t cSpinsBeforeYield = 1000;
+
+/// Represents the per-thread pool of the MCS queue nodes.
+struct NodePool {
+    SpinLockNode nodes[cOsalSpinLockMaxNesting];
+    std::uint32_t usedMask;
+};
+
+/// Pool of the MCS queue nodes of the calling thread.
+static thread_local NodePool nodePool; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+/// Performs one iteration of the busy-wait loop.
+/// @param spins            Number of iterations performed so far. It is reset, when thread yields the CPU.
+static void spinWait(std::uint32_t& spins)
+{
+    if (++spins < cSpinsBeforeYield) {
+        cpuRelax();
+        return;
+    }
+
+    spins = 0;
+    sched_yield();
+}
+
+/// Allocates free MCS queue node from the pool of the calling thread.
+/// @return Allocated node or nullptr if calling thread already holds cOsalSpinLockMaxNesting MCS spinlocks.
+static SpinLockNode* allocateNode()
+{
+    for (std::uint32_t i = 0; i < cOsalSpinLockMaxNesting; ++i) {
+        if ((nodePool.usedMask & (1U << i)) == 0) {
+            nodePool.usedMask |= (1U << i);
+            return &nodePool.nodes[i];
+        }
+    }
+
+    return nullptr;
+}
+
+/// Returns the given MCS queue node to the pool of the calling thread.
+/// @param node             Node to be released.
+static void freeNode(SpinLockNode* node)
+{
+    nodePool.usedMask &= ~(1U << static_cast<std::uint32_t>(node - nodePool.nodes));
+}
+
+/// Locks the given ticket spinlock.
+/// @param impl             Spinlock implementation to be locked.
+static void lockTicket(SpinLockImpl* impl)
+{
+    auto ticket = std::atomic_ref(impl->next).fetch_add(1, std::memory_order_relaxed);
+    std::atomic_ref owner(impl->owner);
+    std::uint32_t spins{};
+
+    for (auto current = owner.load(std::memory_order_acquire); current != ticket;
+         current = owner.load(std::memory_order_acquire)) {
+        // Threads further in the queue poll less often, which reduces traffic on the lock cache line.
+        for (auto i = ticket - current; i > 1; --i)
+            cpuRelax();
+
+        spinWait(spins);
+    }
+}
+
+/// Locks the given ticket spinlock if it is not locked by anyone.
+/// @param impl             Spinlock implementation to be locked.
+/// @return Flag indicating if spinlock has been locked.
+static bool tryLockTicket(SpinLockImpl* impl)
+{
+    auto owner = std::atomic_ref(impl->owner).load(std::memory_order_acquire);
+    auto expected = owner;
+    return std::atomic_ref(impl->next).compare_exchange_strong(expected, owner + 1, std::memory_order_acquire);
+}
+
+/// Unlocks the given ticket spinlock.
+/// @param impl             Spinlock implementation to be unlocked.
+/// @return Error code of the operation.
+static OsalError unlockTicket(SpinLockImpl* impl)
+{
+    std::atomic_ref owner(impl->owner);
+    auto current = owner.load(std::memory_order_relaxed);
+    if (current == std::atomic_ref(impl->next).load(std::memory_order_relaxed))
+        return OsalError::eNotLocked;
+
+    owner.store(current + 1, std::memory_order_release);
+    return OsalError::eOk;
+}
+
+/// Locks the given MCS spinlock.
+/// @param impl             Spinlock implementation to be locked.
+/// @param node             Queue node of the calling thread.
+static void lockMcs(SpinLockImpl* impl, SpinLockNode* node)
+{
+    node->next = nullptr;
+    node->locked = 1;
+
+    auto* prev = std::atomic_ref(impl->tail).exchange(node, std::memory_order_acq_rel);
+    if (prev != nullptr) {
+        std::atomic_ref(prev->next).store(node, std::memory_order_release);
+
+        std::uint32_t spins{};
+        while (std::atomic_ref(node->locked).load(std::memory_order_acquire) != 0)
+            spinWait(spins);
+    }
+
+    impl->holder = node;
+}
+
+/// Locks the given MCS spinlock if it is not locked by anyone.
+/// @param impl             Spinlock implementation to be locked.
+/// @param node             Queue node of the calling thread.
+/// @return Flag indicating if spinlock has been locked.
+static bool tryLockMcs(SpinLockImpl* impl, SpinLockNode* node)
+{
+    node->next = nullptr;
+    node->locked = 0;
+
+    SpinLockNode* expected{};
+    if (!std::atomic_ref(impl->tail).compare_exchange_strong(expected, node, std::memory_order_acquire))
+        return false;
+
+    impl->holder = node;
+    return true;
+}
+
+/// Unlocks the given MCS spinlock and hands it over to the next thread in the queue.
+/// @param impl             Spinlock implementation to be unlocked.
+/// @return Error code of the operation.
+static OsalError unlockMcs(SpinLockImpl* impl)
+{
+    if (std::atomic_ref(impl->tail).load(std::memory_order_relaxed) == nullptr)
+        return OsalError::eNotLocked;
+
+    auto* node = impl->holder;
+    auto* next = std::atomic_ref(node->next).load(std::memory_order_acquire);
+    if (next == nullptr) {
+        auto* expected = node;
+        if (std::atomic_ref(impl->tail).compare_exchange_strong(expected, nullptr, std::memory_order_release)) {
+            freeNode(node);
+            return OsalError::eOk;
+        }
+
+        // Next thread has already swapped the tail, but hasn't linked itself to our node yet.
+        std::uint32_t spins{};
+        while ((next = std::atomic_ref(node->next).load(std::memory_order_acquire)) == nullptr)
+            spinWait(spins);
+    }
+
+    std::atomic_ref(next->locked).store(0, std::memory_order_release);
+    freeNode(node);
+    return OsalError::eOk;
+}
+
+OsalError osalSpinLockCreate(OsalSpinLock* spinLock, OsalSpinLockType type)
+{
+    if (spinLock == nullptr)
+        return OsalError::eInvalidArgument;
+
+    spinLock->initialized = false;
+
+    switch (type) {
+        case OsalSpinLockType::eTicket: [[fallthrough]];
+        case OsalSpinLockType::eMcs: break;
+        default: return OsalError::eInvalidArgument;
+    }
+
+    spinLock->impl = SpinLockImpl{};
+    spinLock->type = type;
+    spinLock->initialized = true;
+    return OsalError::eOk;
+}
+
+OsalError osalSpinLockDestroy(OsalSpinLock* spinLock)
+{
+    if (spinLock == nullptr || !spinLock->initialized)
+        return OsalError::eInvalidArgument;
+
+    std::memset(spinLock, 0, sizeof(OsalSpinLock));
+    return OsalError::eOk;
+}
+
+OsalError osalSpinLockLock(OsalSpinLock* spinLock)
+{
+    if (spinLock == nullptr || !spinLock->initialized)
+        return OsalError::eInvalidArgument;
+
+    if (spinLock->type == OsalSpinLockType::eTicket) {
+        lockTicket(&spinLock->impl);
+        return OsalError::eOk;
+    }
+
+    auto* node = allocateNode();
+    if (node == nullptr)
+        return OsalError::eOsError;
+
+    lockMcs(&spinLock->impl, node);
+    return OsalError::eOk;
+}
+
+OsalError osalSpinLockTryLock(OsalSpinLock* spinLock)
+{
+    if (spinLock == nullptr || !spinLock->initialized)
+        return OsalError::eInvalidArgument;
+
+    if (spinLock->type == OsalSpinLockType::eTicket)
+        return tryLockTicket(&spinLock->impl) ? OsalError::eOk : OsalError::eLocked;
+
+    auto* node = allocateNode();
+    if (node == nullptr)
+        return OsalError::eOsError;
+
+    if (!tryLockMcs(&spinLock->impl, node)) {
+        freeNode(node);
+        return OsalError::eLocked;
+    }
+
+    return OsalError::eOk;
+}
+
+OsalError osalSpinLockUnlock(OsalSpinLock* spinLock)
+{
+    if (spinLock == nullptr || !spinLock->initialized)
+        return OsalError::eInvalidArgument;
+
+    if (spinLock->type == OsalSpinLockType::eTicket)
+        return unlockTicket(&spinLock->impl);
+
+    return unlockMcs(&spinLock->impl);
+}
+
+// There are no interrupts in Linux user space, so ISR variants are equivalent to the regular ones.
+OsalError osalSpinLockLockIsr(OsalSpinLock* spinLock)
+{
+    return osalSpinLockLock(spinLock);
+}
+
+OsalError osalSpinLockTryLockIsr(OsalSpinLock* spinLock)
+{
+    return osalSpinLockTryLock(spinLock);
+}
+
+OsalError osalSpinLockUnlockIsr(OsalSpinLock* spinLock)
+{
+    return osalSpinLockUnlock(spinLock);
+}
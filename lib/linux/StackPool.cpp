@@ -0,0 +1,173 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#include "osal/StackPool.h"
+
+#include <pthread.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+/// Number of stacks described by a single word of the free mask.
+static constexpr std::size_t cMaskBits = 64;
+
+/// Rounds the given size up to the multiple of the given alignment.
+/// @param size             Size to be rounded.
+/// @param alignment        Alignment to be used.
+/// @return Rounded size.
+static std::size_t alignUp(std::size_t size, std::size_t alignment)
+{
+    return (size + alignment - 1) / alignment * alignment;
+}
+
+OsalError osalStackPoolCreate(OsalStackPool* pool, OsalStackPoolConfig config)
+{
+    if (pool == nullptr || config.stackSize == 0 || config.count == 0 || config.count > cOsalStackPoolMaxStacks)
+        return OsalError::eInvalidArgument;
+
+    pool->initialized = false;
+
+    auto pageSize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    // Pooled stacks are used as is by the threads, so they have to hold at least the minimal pthread stack.
+    auto stackSize = alignUp(std::max<std::size_t>(config.stackSize, PTHREAD_STACK_MIN), pageSize);
+    auto guardSize = config.guardPages ? pageSize : 0;
+    auto slotSize = guardSize + stackSize;
+    auto memorySize = slotSize * config.count;
+
+    auto* memory
+        = mmap(nullptr, memorySize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_STACK, -1, 0);
+    if (memory == MAP_FAILED)
+        return OsalError::eOsError;
+
+    auto* slots = static_cast<std::uint8_t*>(memory);
+    for (std::size_t i = 0; i < config.count; ++i) {
+        auto* slot = slots + (i * slotSize);
+
+        // Stacks grow downwards, so guard page is placed below each stack.
+        if (guardSize != 0 && mprotect(slot, guardSize, PROT_NONE) != 0) {
+            munmap(memory, memorySize);
+            return OsalError::eOsError;
+        }
+
+        // Writing to each page forces the kernel to back it with physical memory right now.
+        auto* stack = static_cast<volatile std::uint8_t*>(slot + guardSize);
+        for (std::size_t offset = 0; offset < stackSize; offset += pageSize)
+            stack[offset] = 0;
+    }
+
+    std::memset(pool->freeMask, 0, sizeof(pool->freeMask));
+    for (std::size_t i = 0; i < config.count; ++i)
+        pool->freeMask[i / cMaskBits] |= std::uint64_t{1} << (i % cMaskBits);
+
+    pool->impl.memory = memory;
+    pool->impl.memorySize = memorySize;
+    pool->impl.slotSize = slotSize;
+    pool->impl.guardSize = guardSize;
+    pool->stackSize = stackSize;
+    pool->count = config.count;
+    pool->initialized = true;
+    return OsalError::eOk;
+}
+
+OsalError osalStackPoolDestroy(OsalStackPool* pool)
+{
+    if (pool == nullptr || !pool->initialized)
+        return OsalError::eInvalidArgument;
+
+    for (std::size_t i = 0; i < pool->count; ++i) {
+        auto word = std::atomic_ref(pool->freeMask[i / cMaskBits]).load();
+        if ((word & (std::uint64_t{1} << (i % cMaskBits))) == 0)
+            return OsalError::eLocked;
+    }
+
+    if (munmap(pool->impl.memory, pool->impl.memorySize) != 0)
+        return OsalError::eOsError;
+
+    std::memset(pool, 0, sizeof(OsalStackPool));
+    return OsalError::eOk;
+}
+
+OsalError osalStackPoolAcquire(OsalStackPool* pool, void** stack)
+{
+    if (pool == nullptr || !pool->initialized || stack == nullptr)
+        return OsalError::eInvalidArgument;
+
+    for (std::size_t i = 0; i < (pool->count + cMaskBits - 1) / cMaskBits; ++i) {
+        std::atomic_ref word(pool->freeMask[i]);
+        auto current = word.load();
+        while (current != 0) {
+            auto bit = static_cast<std::size_t>(std::countr_zero(current));
+            if (!word.compare_exchange_weak(current, current & ~(std::uint64_t{1} << bit)))
+                continue;
+
+            auto index = (i * cMaskBits) + bit;
+            auto* slot = static_cast<std::uint8_t*>(pool->impl.memory) + (index * pool->impl.slotSize);
+            *stack = slot + pool->impl.guardSize;
+            return OsalError::eOk;
+        }
+    }
+
+    return OsalError::eLocked;
+}
+
+OsalError osalStackPoolRelease(OsalStackPool* pool, void* stack)
+{
+    if (pool == nullptr || !pool->initialized || stack == nullptr)
+        return OsalError::eInvalidArgument;
+
+    auto address = reinterpret_cast<std::uintptr_t>(stack);
+    auto base = reinterpret_cast<std::uintptr_t>(pool->impl.memory) + pool->impl.guardSize;
+    if (address < base || (address - base) % pool->impl.slotSize != 0)
+        return OsalError::eInvalidArgument;
+
+    auto index = (address - base) / pool->impl.slotSize;
+    if (index >= pool->count)
+        return OsalError::eInvalidArgument;
+
+    auto bit = std::uint64_t{1} << (index % cMaskBits);
+    auto previous = std::atomic_ref(pool->freeMask[index / cMaskBits]).fetch_or(bit);
+    return ((previous & bit) == 0) ? OsalError::eOk : OsalError::eInvalidArgument;
+}
+
+size_t osalStackPoolStackSize(const OsalStackPool* pool)
+{
+    if (pool == nullptr || !pool->initialized)
+        return 0;
+
+    return pool->stackSize;
+}
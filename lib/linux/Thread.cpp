@@ -32,39 +32,403 @@
 
 #include "osal/Thread.h"
 
+#include "futexPriv.hpp"
+#include "osal/common/threadRegistry.hpp"
+#include "osal/timestamp.h"
+#include "threadPriv.hpp"
+
+#include <alloca.h>
+#include <fcntl.h>
 #include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cassert>
+#include <cerrno>
 #include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
 #include <cstring>
-#include <functional>
-#include <memory>
+#include <ctime>
+#include <string_view>
+
+#ifndef SCHED_DEADLINE
+    #define SCHED_DEADLINE 6
+#endif
 
 /// Maximal size of the thread name.
-static constexpr std::size_t cMaxThreadName = 15;
+static constexpr std::size_t cMaxThreadName = cOsalThreadNameSize - 1;
+
+/// Free stack space left untouched by prefaultStack() for frames of the calling functions and signal handlers.
+static constexpr std::size_t cStackPrefaultHeadroom = 4 * 1024;
+
+/// Minimal runtime accepted by the kernel for SCHED_DEADLINE threads.
+static constexpr std::uint64_t cMinDeadlineRuntimeNs = 1024;
+
+/// Represents layout of the kernel sched_attr structure used by the sched_setattr() system call.
+/// @note Glibc exposes neither this structure nor the sched_setattr() wrapper in all supported versions, so
+///       it is defined here explicitly.
+struct SchedAttr {
+    std::uint32_t size;
+    std::uint32_t policy;
+    std::uint64_t flags;
+    std::int32_t nice;
+    std::uint32_t priority;
+    std::uint64_t runtime;
+    std::uint64_t deadline;
+    std::uint64_t period;
+};
 
 /// Represents helper wrapper around OSAL thread function and its arguments.
 /// @note This type is necessary, because OsalThreadFunction has different signature than pthread.
 ///       Thus special threadWrapper() function (with pthread compliant signature) is used directly in
 ///       call to pthread_create() and OSAL thread function is passed along with its arguments as the
 ///       argument.
+/// @note Wrapper lives on the creator's stack, which is valid until the created thread sets the done flag. This
+///       way thread creation doesn't allocate any memory.
 struct ThreadWrapperData {
     OsalThreadFunction func{};
     void* param{};
+    const char* name{};
+    OsalThreadPriority priority{};
+    OsalThreadScheduling scheduling{};
+    std::uint32_t done{};
+    OsalError error{OsalError::eOk};
+    std::uint32_t id{};
+    std::uint64_t startTimestampNs{};
+};
+
+/// Represents cached identity of the calling thread.
+/// @note Id and name don't change during the lifetime of the thread, so they are queried from the system only once.
+///       Id is invalidated in the child process after fork(), because there the forking thread gets a new kernel id.
+struct ThreadIdentity {
+    std::uint32_t id{};
+    bool nameCached{};
+    std::array<char, cMaxThreadName + 1> name{};
+    ThreadRegistryEntry* entry{};
 };
 
+/// Identity of the calling thread.
+static thread_local ThreadIdentity currentThread{}; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+/// Number of bytes of the stack, which every created thread pre-faults before invoking its user function.
+std::size_t stackPrefaultSize{}; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+/// Prepares the registry of live threads for fork() by locking it in the forking thread.
+static void onForkPrepare()
+{
+    threadRegistryLock();
+}
+
+/// Releases the registry of live threads in the parent process after fork().
+static void onForkParent()
+{
+    threadRegistryUnlock();
+}
+
+/// Updates the cached identity and the registry of live threads in the child process after fork().
+/// @note Only the forking thread exists in the child process, so all other threads are dropped from the registry.
+static void onForkChild()
+{
+    currentThread.id = 0;
+    threadRegistryReset(currentThread.entry);
+    threadRegistryUnlock();
+}
+
+/// Installs fork handlers, which keep the cached thread identity and the registry of live threads valid.
+/// @note Handlers are installed only once, before the first thread is registered or the first id is cached.
+static void installForkHandlers()
+{
+    static const bool cInstalled = (pthread_atfork(onForkPrepare, onForkParent, onForkChild) == 0);
+    assert(cInstalled);
+}
+
+/// Returns name of the calling thread.
+/// @return Name of the calling thread.
+/// @note Name is cached per thread, so only the first call in each thread queries the system.
+static const char* currentThreadName()
+{
+    if (!currentThread.nameCached) {
+        [[maybe_unused]] auto result
+            = pthread_getname_np(pthread_self(), currentThread.name.data(), currentThread.name.size());
+        assert(result == 0);
+        currentThread.nameCached = true;
+    }
+
+    return currentThread.name.data();
+}
+
+/// Writes to every page of the given number of bytes allocated on the stack of the calling thread.
+/// @param size             Number of bytes to be touched.
+/// @note This function is never inlined, so that the allocated stack space is released right after it returns.
+[[gnu::noinline]] static void touchStack(std::size_t size)
+{
+    auto* stack = static_cast<volatile unsigned char*>(alloca(size));
+    auto pageSize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    for (std::size_t i = 0; i < size; i += pageSize)
+        stack[i] = 0;
+}
+
+bool prefaultStack(std::size_t size)
+{
+    pthread_attr_t attr{};
+    if (pthread_getattr_np(pthread_self(), &attr) != 0)
+        return false;
+
+    void* stackAddress{};
+    std::size_t stackSize{};
+    auto result = pthread_attr_getstack(&attr, &stackAddress, &stackSize);
+    pthread_attr_destroy(&attr);
+    if (result != 0)
+        return false;
+
+    // Stack grows down, so free space is located between its lowest address and the current frame.
+    auto* stackBottom = static_cast<char*>(stackAddress);
+    auto* currentFrame = static_cast<char*>(static_cast<void*>(&attr));
+    auto freeSpace = static_cast<std::size_t>(currentFrame - stackBottom);
+    if (freeSpace > cStackPrefaultHeadroom)
+        touchStack(std::min(size, freeSpace - cStackPrefaultHeadroom));
+
+    return true;
+}
+
+/// Converts OSAL CPU set to the native cpu_set_t.
+/// @param cpus             OSAL CPU set to be converted.
+/// @return Native CPU set corresponding to the given OSAL CPU set.
+static cpu_set_t toNativeCpuSet(const OsalCpuSet& cpus)
+{
+    cpu_set_t nativeCpus{};
+    CPU_ZERO(&nativeCpus);
+    for (std::uint32_t cpu = 0; cpu < std::min<std::size_t>(cOsalMaxCpus, CPU_SETSIZE); ++cpu) {
+        if (osalCpuSetContains(&cpus, cpu))
+            CPU_SET(cpu, &nativeCpus);
+    }
+
+    return nativeCpus;
+}
+
+/// Converts native cpu_set_t to the OSAL CPU set.
+/// @param nativeCpus       Native CPU set to be converted.
+/// @return OSAL CPU set corresponding to the given native CPU set.
+static OsalCpuSet fromNativeCpuSet(const cpu_set_t& nativeCpus)
+{
+    OsalCpuSet cpus{};
+    for (std::uint32_t cpu = 0; cpu < std::min<std::size_t>(cOsalMaxCpus, CPU_SETSIZE); ++cpu) {
+        if (CPU_ISSET(cpu, &nativeCpus))
+            osalCpuSetAdd(&cpus, cpu);
+    }
+
+    return cpus;
+}
+
+/// Checks if the given parameters can be used with SCHED_DEADLINE policy.
+/// @param scheduling       Scheduling parameters to be checked.
+/// @return Flag indicating if the given parameters are valid.
+static bool isValidDeadline(const OsalThreadScheduling& scheduling)
+{
+    auto period = (scheduling.periodNs == 0) ? scheduling.deadlineNs : scheduling.periodNs;
+    return scheduling.runtimeNs >= cMinDeadlineRuntimeNs && scheduling.runtimeNs <= scheduling.deadlineNs
+        && scheduling.deadlineNs <= period;
+}
+
+/// Switches the calling thread to the SCHED_DEADLINE policy with the given parameters.
+/// @param scheduling       Scheduling parameters to be applied.
+/// @return Flag indicating if the policy has been applied.
+/// @note This can fail due to missing privileges, restricted CPU affinity or kernel admission control.
+static bool applyDeadlinePolicy(const OsalThreadScheduling& scheduling)
+{
+    SchedAttr attr{};
+    attr.size = sizeof(attr);
+    attr.policy = SCHED_DEADLINE;
+    attr.runtime = scheduling.runtimeNs;
+    attr.deadline = scheduling.deadlineNs;
+    attr.period = (scheduling.periodNs == 0) ? scheduling.deadlineNs : scheduling.periodNs;
+    return syscall(SYS_sched_setattr, 0, &attr, 0) == 0;
+}
+
+/// Sets nice value of the calling thread according to the given OSAL priority.
+/// @param priority         OSAL priority to be applied.
+/// @note Without CAP_SYS_NICE nice value can be decreased only down to the limit given by RLIMIT_NICE. In that
+///       case the closest allowed value is used.
+static void applyNiceValue(OsalThreadPriority priority)
+{
+    // On Linux nice value is a per-thread attribute and 0 refers to the calling thread.
+    auto nice = toNiceValue(priority);
+    if (setpriority(PRIO_PROCESS, 0, nice) == 0)
+        return;
+
+    constexpr int cNiceLimitBase = 20;
+    constexpr rlim_t cNiceRange = 40;
+    rlimit limit{};
+    if (getrlimit(RLIMIT_NICE, &limit) != 0)
+        return;
+
+    auto minNice = cNiceLimitBase - static_cast<int>(std::min(limit.rlim_cur, cNiceRange));
+    errno = 0;
+    auto currentNice = getpriority(PRIO_PROCESS, 0);
+    if (errno == 0 && std::max(nice, minNice) < currentNice)
+        setpriority(PRIO_PROCESS, 0, std::max(nice, minNice));
+}
+
+/// Applies part of the scheduling configuration, which can be set only from within the created thread.
+/// @param wrapperData      Configuration of the created thread.
+/// @return Error code of the operation.
+/// @note Default policy never reports eSchedulingFallback, so clamping of the nice value doesn't fail thread creation.
+static OsalError applyThreadScheduling(const ThreadWrapperData& wrapperData)
+{
+    switch (wrapperData.scheduling.policy) {
+        case OsalThreadPolicy::ePolicyOther: applyNiceValue(wrapperData.priority); return OsalError::eOk;
+        case OsalThreadPolicy::ePolicyDeadline:
+            if (applyDeadlinePolicy(wrapperData.scheduling))
+                return OsalError::eOk;
+
+            applyNiceValue(wrapperData.priority);
+            return OsalError::eSchedulingFallback;
+        default: return OsalError::eOk;
+    }
+}
+
 /// Helper thread function that has signature required by pthread. It is used as a wrapper for
 /// OSAL thread function.
 /// @param arg          Helper thread arguments.
 /// @return Result of this function is never used so it always returns nullptr.
 static void* threadWrapper(void* arg)
 {
-    auto wrapperData = std::unique_ptr<ThreadWrapperData>(static_cast<ThreadWrapperData*>(arg));
-    wrapperData->func(wrapperData->param);
+    auto* wrapperData = static_cast<ThreadWrapperData*>(arg);
+    auto func = wrapperData->func;
+    auto* param = wrapperData->param;
+
+    // Thread sets its own name, so that it is already valid when the creator returns from osalThreadCreate().
+    if (wrapperData->name != nullptr && std::strcmp(wrapperData->name, "") != 0) {
+        [[maybe_unused]] auto result = pthread_setname_np(pthread_self(), wrapperData->name);
+        assert(result == 0);
+
+        std::strncpy(currentThread.name.data(), wrapperData->name, cMaxThreadName);
+        currentThread.nameCached = true;
+    }
+
+    ThreadRegistryEntry entry{};
+    entry.info.id = osalThreadId();
+    entry.info.priority = wrapperData->priority;
+    entry.info.startTimestampNs = osalTimestampNs();
+    std::strncpy(entry.info.name, currentThreadName(), cOsalThreadInfoNameSize - 1);
+    currentThread.entry = &entry;
+    threadRegistryAdd(&entry);
+
+    // Wrapper lives on the creator's stack, so it must not be accessed after being signaled.
+    wrapperData->id = entry.info.id;
+    wrapperData->startTimestampNs = entry.info.startTimestampNs;
+    wrapperData->error = applyThreadScheduling(*wrapperData);
+    if (stackPrefaultSize != 0)
+        prefaultStack(stackPrefaultSize);
+
+    std::atomic_ref(wrapperData->done).store(1);
+    futexWake(&wrapperData->done);
+
+    func(param);
+
+    threadRegistryRemove(&entry);
+    currentThread.entry = nullptr;
     return nullptr;
 }
 
+/// Reads context switch counters of the given thread from its procfs status file.
+/// @param id               Kernel id of the thread to be queried.
+/// @param stats            Output argument where the counters will be stored.
+/// @return Flag indicating if both counters have been read.
+/// @note File is parsed line by line with a small buffer, so this function can be used also on small thread stacks.
+///       Lines that don't fit into the buffer (e.g. long CPU masks) are skipped.
+static bool readContextSwitches(std::uint32_t id, OsalThreadStats& stats)
+{
+    constexpr std::string_view cVoluntary = "voluntary_ctxt_switches:";
+    constexpr std::string_view cInvoluntary = "nonvoluntary_ctxt_switches:";
+
+    std::array<char, 64> path{};
+    std::snprintf(path.data(), path.size(), "/proc/self/task/%u/status", id);
+    auto fd = open(path.data(), O_RDONLY | O_CLOEXEC);
+    if (fd == -1)
+        return false;
+
+    std::array<char, 256> buffer{};
+    std::size_t size = 0;
+    auto found = 0;
+    ssize_t count{};
+    while ((count = read(fd, buffer.data() + size, buffer.size() - size - 1)) > 0) {
+        size += static_cast<std::size_t>(count);
+        buffer[size] = '\0';
+
+        auto* line = buffer.data();
+        for (auto* end = std::strchr(line, '\n'); end != nullptr; end = std::strchr(line, '\n')) {
+            *end = '\0';
+            if (std::strncmp(line, cVoluntary.data(), cVoluntary.size()) == 0) {
+                stats.voluntarySwitches = std::strtoull(line + cVoluntary.size(), nullptr, 10);
+                ++found;
+            }
+            else if (std::strncmp(line, cInvoluntary.data(), cInvoluntary.size()) == 0) {
+                stats.involuntarySwitches = std::strtoull(line + cInvoluntary.size(), nullptr, 10);
+                ++found;
+            }
+
+            line = end + 1;
+        }
+
+        // Keep incomplete line for the next read, unless it already fills the whole buffer.
+        size = static_cast<std::size_t>(buffer.data() + size - line);
+        std::memmove(buffer.data(), line, size);
+        if (size == buffer.size() - 1)
+            size = 0;
+    }
+
+    close(fd);
+    return found == 2;
+}
+
+/// Reads CPU time consumed by the given thread.
+/// @param handle           Handle of the thread to be queried.
+/// @param stats            Output argument where the CPU time will be stored.
+/// @return Flag indicating if the CPU time has been read.
+static bool readCpuTime(pthread_t handle, OsalThreadStats& stats)
+{
+    clockid_t clock{};
+    timespec cpuTime{};
+    if (pthread_getcpuclockid(handle, &clock) != 0 || clock_gettime(clock, &cpuTime) != 0)
+        return false;
+
+    stats.cpuTimeNs = osalSecToNs(cpuTime.tv_sec) + static_cast<std::uint64_t>(cpuTime.tv_nsec);
+    return true;
+}
+
+/// Sets up native scheduling attributes for the given OSAL scheduling configuration.
+/// @param attr             Native thread attributes to be modified.
+/// @param priority         OSAL thread priority.
+/// @param policy           OSAL scheduling policy.
+/// @note SCHED_DEADLINE cannot be set with pthread attributes, so thread starts as SCHED_OTHER and switches
+///       the policy on its own.
+static void setSchedulingAttributes(pthread_attr_t& attr, OsalThreadPriority priority, OsalThreadPolicy policy)
+{
+    // Without explicit scheduling pthread ignores policy and priority from the attributes and inherits them.
+    [[maybe_unused]] auto result = pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED);
+    assert(result == 0);
+
+    auto nativePolicy = SCHED_OTHER;
+    sched_param schedParam{};
+    if (policy == OsalThreadPolicy::ePolicyFifo || policy == OsalThreadPolicy::ePolicyRoundRobin) {
+        nativePolicy = (policy == OsalThreadPolicy::ePolicyFifo) ? SCHED_FIFO : SCHED_RR;
+        schedParam.sched_priority = toNativePriority(priority, nativePolicy);
+    }
+
+    result = pthread_attr_setschedpolicy(&attr, nativePolicy);
+    assert(result == 0);
+
+    result = pthread_attr_setschedparam(&attr, &schedParam);
+    assert(result == 0);
+}
+
 OsalError osalThreadCreate(OsalThread* thread, OsalThreadConfig config, OsalThreadFunction func, void* arg)
 {
     return osalThreadCreateEx(thread, config, func, arg, nullptr);
@@ -81,17 +445,20 @@ osalThreadCreateEx(OsalThread* thread, OsalThreadConfig config, OsalThreadFuncti
 
     thread->initialized = false;
 
-    const auto cPriorityMin = sched_get_priority_min(SCHED_RR);
-    const auto cPriorityMax = sched_get_priority_max(SCHED_RR);
-    const auto cPriorityStep = (cPriorityMax - cPriorityMin) / 4;
-
-    int priority{};
-    switch (config.priority) {
-        case OsalThreadPriority::eLowest: priority = cPriorityMin; break;
-        case OsalThreadPriority::eLow: priority = cPriorityMin + (cPriorityStep * 1); break;
-        case OsalThreadPriority::eNormal: priority = cPriorityMin + (cPriorityStep * 2); break;
-        case OsalThreadPriority::eHigh: priority = cPriorityMin + (cPriorityStep * 3); break;
-        case OsalThreadPriority::eHighest: priority = cPriorityMax; break;
+    if (toNativePriority(config.priority) == -1)
+        return OsalError::eInvalidArgument;
+
+    installForkHandlers();
+
+    auto policy = config.scheduling.policy;
+    switch (policy) {
+        case OsalThreadPolicy::ePolicyOther:
+        case OsalThreadPolicy::ePolicyFifo:
+        case OsalThreadPolicy::ePolicyRoundRobin: break;
+        case OsalThreadPolicy::ePolicyDeadline:
+            if (!isValidDeadline(config.scheduling))
+                return OsalError::eInvalidArgument;
+            break;
         default: return OsalError::eInvalidArgument;
     }
 
@@ -99,36 +466,61 @@ osalThreadCreateEx(OsalThread* thread, OsalThreadConfig config, OsalThreadFuncti
     [[maybe_unused]] auto result = pthread_attr_init(&attr);
     assert(result == 0);
 
-    result = pthread_attr_setschedpolicy(&attr, SCHED_RR);
-    assert(result == 0);
+    setSchedulingAttributes(attr, config.priority, policy);
 
-    sched_param schedParam{};
-    schedParam.sched_priority = priority;
-    result = pthread_attr_setschedparam(&attr, &schedParam);
-    assert(result == 0);
+    if (config.stack != nullptr && config.stackSize >= static_cast<std::size_t>(PTHREAD_STACK_MIN)) {
+        // Caller-provided stack is used as is. Smaller stacks can't hold the minimal pthread stack, so for them
+        // system allocates its own stack like before custom stacks were supported.
+        result = pthread_attr_setstack(&attr, config.stack, config.stackSize);
+        if (result != 0) {
+            pthread_attr_destroy(&attr);
+            return OsalError::eInvalidArgument;
+        }
+    }
+    else {
+        auto stackSize = std::max<std::size_t>(config.stackSize, PTHREAD_STACK_MIN);
+        result = pthread_attr_setstacksize(&attr, stackSize);
+        assert(result == 0);
+    }
 
-    auto stackSize = std::max<std::size_t>(config.stackSize, PTHREAD_STACK_MIN);
-    result = pthread_attr_setstacksize(&attr, stackSize);
-    assert(result == 0);
+    // Setting affinity before the thread starts guarantees, that it never runs on a CPU outside of the set.
+    if (!osalCpuSetIsEmpty(&config.affinity)) {
+        auto nativeCpus = toNativeCpuSet(config.affinity);
+        result = pthread_attr_setaffinity_np(&attr, sizeof(nativeCpus), &nativeCpus);
+        assert(result == 0);
+    }
 
     pthread_t handle{};
-    auto wrapper = std::make_unique<ThreadWrapperData>();
-    wrapper->func = func;
-    wrapper->param = arg;
-    result = pthread_create(&handle, &attr, threadWrapper, wrapper.release());
-    assert(result == 0);
+    ThreadWrapperData wrapper{func, arg, name, config.priority, config.scheduling, 0, OsalError::eOk};
+    result = pthread_create(&handle, &attr, threadWrapper, &wrapper);
 
-    if (name != nullptr && std::strcmp(name, "") != 0) {
-        result = pthread_setname_np(handle, name);
-        assert(result == 0);
+    // Real-time policies require privileges, so in case of EPERM thread is created as SCHED_OTHER with nice value.
+    auto fallback = false;
+    if (result == EPERM && (policy == OsalThreadPolicy::ePolicyFifo || policy == OsalThreadPolicy::ePolicyRoundRobin)) {
+        fallback = true;
+        wrapper.scheduling.policy = OsalThreadPolicy::ePolicyOther;
+        setSchedulingAttributes(attr, config.priority, OsalThreadPolicy::ePolicyOther);
+        result = pthread_create(&handle, &attr, threadWrapper, &wrapper);
+    }
+
+    if (result != 0) {
+        pthread_attr_destroy(&attr);
+        return (result == EINVAL) ? OsalError::eInvalidArgument : OsalError::eOsError;
     }
 
     result = pthread_attr_destroy(&attr);
     assert(result == 0);
 
+    // Wait until created thread takes its arguments and applies its scheduling configuration. After that wrapper
+    // can be safely released and the outcome of the scheduling setup can be reported.
+    while (std::atomic_ref(wrapper.done).load() == 0)
+        futexWait(&wrapper.done, 0);
+
     thread->impl.handle = handle;
+    thread->impl.id = wrapper.id;
+    thread->impl.startTimestampNs = wrapper.startTimestampNs;
     thread->initialized = true;
-    return OsalError::eOk;
+    return fallback ? OsalError::eSchedulingFallback : wrapper.error;
 }
 
 OsalError osalThreadDestroy(OsalThread* thread)
@@ -151,6 +543,63 @@ OsalError osalThreadJoin(OsalThread* thread)
     return OsalError::eOk;
 }
 
+OsalError osalThreadSetAffinity(OsalThread* thread, const OsalCpuSet* cpus)
+{
+    if (thread == nullptr || !thread->initialized || cpus == nullptr || osalCpuSetIsEmpty(cpus))
+        return OsalError::eInvalidArgument;
+
+    auto nativeCpus = toNativeCpuSet(*cpus);
+    auto result = pthread_setaffinity_np(thread->impl.handle, sizeof(nativeCpus), &nativeCpus);
+    if (result == EINVAL)
+        return OsalError::eInvalidArgument;
+
+    return (result == 0) ? OsalError::eOk : OsalError::eOsError;
+}
+
+OsalError osalThreadGetAffinity(OsalThread* thread, OsalCpuSet* cpus)
+{
+    if (thread == nullptr || !thread->initialized || cpus == nullptr)
+        return OsalError::eInvalidArgument;
+
+    cpu_set_t nativeCpus{};
+    if (pthread_getaffinity_np(thread->impl.handle, sizeof(nativeCpus), &nativeCpus) != 0)
+        return OsalError::eOsError;
+
+    *cpus = fromNativeCpuSet(nativeCpus);
+    return OsalError::eOk;
+}
+
+OsalError osalThreadGetStats(OsalThread* thread, OsalThreadStats* stats)
+{
+    if (thread == nullptr || !thread->initialized || stats == nullptr)
+        return OsalError::eInvalidArgument;
+
+    OsalThreadStats result{};
+    if (pthread_equal(thread->impl.handle, pthread_self()) != 0) {
+        rusage usage{};
+        if (getrusage(RUSAGE_THREAD, &usage) != 0 || !readCpuTime(thread->impl.handle, result))
+            return OsalError::eOsError;
+
+        result.voluntarySwitches = static_cast<std::uint64_t>(usage.ru_nvcsw);
+        result.involuntarySwitches = static_cast<std::uint64_t>(usage.ru_nivcsw);
+    }
+    else {
+        // Kernel id and CPU clock of a finished thread may already belong to another thread. Thread stays registered
+        // until its function returns, so it can't finish while the registry is locked.
+        threadRegistryLock();
+        bool running = threadRegistryContains(thread->impl.id, thread->impl.startTimestampNs)
+                    && readContextSwitches(thread->impl.id, result) && readCpuTime(thread->impl.handle, result);
+        threadRegistryUnlock();
+
+        if (!running)
+            return OsalError::eOsError;
+    }
+
+    result.runtimeNs = osalTimestampNs() - thread->impl.startTimestampNs;
+    *stats = result;
+    return OsalError::eOk;
+}
+
 void osalThreadYield()
 {
     sched_yield();
@@ -158,16 +607,33 @@ void osalThreadYield()
 
 uint32_t osalThreadId()
 {
-    return std::hash<pthread_t>{}(pthread_self());
+    if (currentThread.id == 0) {
+        installForkHandlers();
+        currentThread.id = static_cast<std::uint32_t>(gettid());
+    }
+
+    return currentThread.id;
 }
 
-OsalError osalThreadName(char* name, size_t size)
+uint32_t osalThreadCurrentCpu()
 {
-    std::array<char, cMaxThreadName + 1> buffer{};
-    [[maybe_unused]] auto result = pthread_getname_np(pthread_self(), buffer.data(), buffer.size());
-    assert(result == 0);
+    auto cpu = sched_getcpu();
+    return (cpu == -1) ? 0 : static_cast<std::uint32_t>(cpu);
+}
+
+uint32_t osalThreadCpuCount()
+{
+    cpu_set_t nativeCpus{};
+    if (sched_getaffinity(0, sizeof(nativeCpus), &nativeCpus) == 0)
+        return static_cast<std::uint32_t>(std::max(CPU_COUNT(&nativeCpus), 1));
 
-    std::strncpy(name, buffer.data(), size);
+    auto count = sysconf(_SC_NPROCESSORS_ONLN);
+    return (count < 1) ? 1 : static_cast<std::uint32_t>(count);
+}
+
+OsalError osalThreadName(char* name, size_t size)
+{
+    std::strncpy(name, currentThreadName(), size);
     name[size - 1] = '\0';
     return OsalError::eOk;
 }
@@ -0,0 +1,79 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#include "osal/ThreadLocal.h"
+
+#include <pthread.h>
+
+OsalError osalThreadLocalCreate(OsalThreadLocal* local, void (*destructor)(void*))
+{
+    if (local == nullptr)
+        return OsalError::eInvalidArgument;
+
+    local->initialized = false;
+    if (pthread_key_create(&local->impl.key, destructor) != 0)
+        return OsalError::eOsError;
+
+    local->initialized = true;
+    return OsalError::eOk;
+}
+
+OsalError osalThreadLocalDestroy(OsalThreadLocal* local)
+{
+    if (local == nullptr || !local->initialized)
+        return OsalError::eInvalidArgument;
+
+    if (pthread_key_delete(local->impl.key) != 0)
+        return OsalError::eOsError;
+
+    local->initialized = false;
+    return OsalError::eOk;
+}
+
+void* osalThreadLocalGet(const OsalThreadLocal* local)
+{
+    if (local == nullptr || !local->initialized)
+        return nullptr;
+
+    return pthread_getspecific(local->impl.key);
+}
+
+OsalError osalThreadLocalSet(OsalThreadLocal* local, void* value)
+{
+    if (local == nullptr || !local->initialized)
+        return OsalError::eInvalidArgument;
+
+    if (pthread_setspecific(local->impl.key, value) != 0)
+        return OsalError::eOsError;
+
+    return OsalError::eOk;
+}
@@ -0,0 +1,100 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <climits>
+#include <cstdint>
+#include <ctime>
+
+/// Blocks the calling thread as long as the given futex word contains the expected value.
+/// @param word         Futex word to be waited on.
+/// @param expected     Value that futex word should have in order to block the caller.
+/// @param deadline     Absolute CLOCK_MONOTONIC deadline of the operation or nullptr for infinite wait.
+/// @param shared       Flag indicating if futex word is located in the memory shared between processes.
+/// @param bitset       Bitset of the waiter, which can be used to wake up only selected waiters.
+/// @return Error code returned by the kernel.
+/// @retval 0           Caller was woken up (possibly spuriously).
+/// @retval EAGAIN      Futex word didn't contain the expected value.
+/// @retval EINTR       Caller was interrupted by a signal.
+/// @retval ETIMEDOUT   Deadline has been reached.
+inline int futexWait(std::uint32_t* word,
+                     std::uint32_t expected,
+                     const timespec* deadline = nullptr,
+                     bool shared = false,
+                     std::uint32_t bitset = FUTEX_BITSET_MATCH_ANY)
+{
+    // FUTEX_WAIT_BITSET interprets timeout as an absolute CLOCK_MONOTONIC value, contrary to FUTEX_WAIT.
+    auto result = syscall(SYS_futex,
+                          word,
+                          FUTEX_WAIT_BITSET | (shared ? 0 : FUTEX_PRIVATE_FLAG),
+                          expected,
+                          deadline,
+                          nullptr,
+                          bitset);
+    return (result == 0) ? 0 : errno;
+}
+
+/// Wakes up the given number of threads blocked on the given futex word.
+/// @param word         Futex word to be signaled.
+/// @param count        Maximal number of threads to be woken up.
+/// @param shared       Flag indicating if futex word is located in the memory shared between processes.
+inline void futexWake(std::uint32_t* word, int count = 1, bool shared = false)
+{
+    syscall(SYS_futex, word, FUTEX_WAKE | (shared ? 0 : FUTEX_PRIVATE_FLAG), count, nullptr, nullptr, 0);
+}
+
+/// Wakes up the given number of threads blocked on the given futex word with the bitset matching the given one.
+/// @param word         Futex word to be signaled.
+/// @param count        Maximal number of threads to be woken up.
+/// @param bitset       Bitset, which has to match bitset of the woken up threads.
+/// @param shared       Flag indicating if futex word is located in the memory shared between processes.
+/// @return Number of woken up threads.
+inline int futexWakeBitset(std::uint32_t* word, int count, std::uint32_t bitset, bool shared = false)
+{
+    auto result
+        = syscall(SYS_futex, word, FUTEX_WAKE_BITSET | (shared ? 0 : FUTEX_PRIVATE_FLAG), count, nullptr, nullptr, bitset);
+    return (result < 0) ? 0 : static_cast<int>(result);
+}
+
+/// Wakes up all threads blocked on the given futex word.
+/// @param word         Futex word to be signaled.
+/// @param shared       Flag indicating if futex word is located in the memory shared between processes.
+inline void futexWakeAll(std::uint32_t* word, bool shared = false)
+{
+    futexWake(word, INT_MAX, shared);
+}
@@ -33,8 +33,39 @@
 #pragma once
 
 #include <pthread.h>
+#include <stdbool.h> // NOLINT(modernize-deprecated-headers,hicpp-deprecated-headers)
+#include <stdint.h>  // NOLINT(modernize-deprecated-headers,hicpp-deprecated-headers)
 
 /// Helper class with concrete platform implementation of the mutex handle.
+/// @note Mutex is implemented directly on top of the Linux futex. Value of the "state" word means:
+///       0 - mutex is unlocked, 1 - mutex is locked without waiters, 2 - mutex is locked and has (possible) waiters.
+///       Fields "owner" and "count" are used only by recursive mutexes and "spinBudget" only by adaptive mutexes.
+///       Mutexes with priority protocols are implemented with "handle", because priority inheritance and priority
+///       ceiling require cooperation with the kernel scheduler, which glibc already implements.
 struct MutexImpl {
+    uint32_t state;
+    uint32_t owner;
+    uint32_t count;
+    uint32_t spinBudget;
     pthread_mutex_t handle;
 };
+
+/// Locks the given mutex if it is not locked by anyone. This is the uncontended fast path of the lock operation.
+/// @param impl             Mutex implementation to be locked.
+/// @return Flag indicating if mutex has been locked.
+/// @note This function ignores mutex type, thus it should be used only with non-recursive mutexes.
+static inline bool osalMutexImplFastLock(struct MutexImpl* impl)
+{
+    uint32_t expected = 0;
+    return __atomic_compare_exchange_n(&impl->state, &expected, 1, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+}
+
+/// Unlocks the given mutex if no other thread waits for it. This is the uncontended fast path of the unlock operation.
+/// @param impl             Mutex implementation to be unlocked.
+/// @return Flag indicating if mutex has been unlocked.
+/// @note This function ignores mutex type, thus it should be used only with non-recursive mutexes.
+static inline bool osalMutexImplFastUnlock(struct MutexImpl* impl)
+{
+    uint32_t expected = 1;
+    return __atomic_compare_exchange_n(&impl->state, &expected, 0, false, __ATOMIC_RELEASE, __ATOMIC_RELAXED);
+}
@@ -32,9 +32,19 @@
 
 #pragma once
 
-#include <semaphore.h>
+#include <stdbool.h> // NOLINT(modernize-deprecated-headers,hicpp-deprecated-headers)
+#include <stdint.h>  // NOLINT(modernize-deprecated-headers,hicpp-deprecated-headers)
 
 /// Helper class with concrete platform implementation of the semaphore handle.
+/// @note Futex word holds the value of the semaphore in the upper bits and flags indicating presence of single-token
+///       and batch waiters in the two lowest bits. This way signaling thread touches nothing but the futex word, so
+///       semaphore can be destroyed as soon as the woken waiter returns. Counters of the waiters are modified only by
+///       the waiters themselves.
+/// @note Pollable semaphores use only the eventfd descriptor.
 struct SemaphoreImpl {
-    sem_t handle;
+    uint32_t word;
+    uint32_t waiters;
+    uint32_t batchWaiters;
+    bool processShared;
+    int fd;
 };
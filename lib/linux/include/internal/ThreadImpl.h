@@ -37,8 +37,18 @@
 #endif
 
 #include <pthread.h>
+#include <stddef.h> // NOLINT(modernize-deprecated-headers,hicpp-deprecated-headers)
+#include <stdint.h> // NOLINT(modernize-deprecated-headers,hicpp-deprecated-headers)
+
+/// Maximal size of the thread name (including the NULL-terminator) supported by the platform.
+/// @note Linux limits thread names to 15 characters.
+static const size_t cOsalThreadNameSize = 16;
 
 /// Helper class with concrete platform implementation of the thread handle.
+/// @note Kernel id and start timestamp are reported by the created thread itself, so that runtime statistics of the
+///       thread can be queried without any system call from the creator.
 struct ThreadImpl {
     pthread_t handle;
+    uint32_t id;
+    uint64_t startTimestampNs;
 };
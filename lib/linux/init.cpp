@@ -32,17 +32,109 @@
 
 #include "osal/init.h"
 
+#include "osal/Thread.h"
+#include "threadPriv.hpp"
 #include "timestampPriv.hpp"
 
+#include <malloc.h>
+#include <sys/mman.h>
+#include <sys/prctl.h>
+#include <unistd.h>
+
+#include <cstddef>
+#include <cstdlib>
+
+#ifndef PR_SET_THP_DISABLE
+    #define PR_SET_THP_DISABLE 41
+#endif
+
 /// Initializes the internal state of the timestamp module.
 static void initTimestamp()
 {
     initTime = std::chrono::steady_clock::now();
 }
 
+/// Allocates, touches and releases the heap reserve of the given size.
+/// @param size             Size of the heap reserve in bytes.
+/// @return Flag indicating if the heap reserve has been pre-faulted.
+/// @note Released reserve has to stay in the heap, so the allocator is configured to never trim it and to never
+///       serve allocations with separate mappings.
+static bool prefaultHeap(std::size_t size)
+{
+    if (mallopt(M_TRIM_THRESHOLD, -1) == 0 || mallopt(M_MMAP_MAX, 0) == 0)
+        return false;
+
+    auto* reserve = static_cast<volatile unsigned char*>(std::malloc(size));
+    if (reserve == nullptr)
+        return false;
+
+    auto pageSize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    for (std::size_t i = 0; i < size; i += pageSize)
+        reserve[i] = 0;
+
+    std::free(const_cast<unsigned char*>(reserve));
+    return true;
+}
+
+/// Checks if threads can be created with real-time scheduling policies.
+/// @return Flag indicating if threads can be created with real-time scheduling policies.
+/// @note Privileges, RLIMIT_RTPRIO and real-time bandwidth of the cgroup all affect this, so the only reliable way to
+///       check it is to create a real-time thread.
+static bool isRealtimeSchedulingAvailable()
+{
+    OsalThreadConfig config{OsalThreadPriority::eLowest, cOsalThreadDefaultStackSize, nullptr, {}, {}};
+    config.scheduling.policy = OsalThreadPolicy::ePolicyFifo;
+
+    OsalThread thread{};
+    auto error = osalThreadCreate(&thread, config, [](void*) {}, nullptr);
+    if (error != OsalError::eOk && error != OsalError::eSchedulingFallback)
+        return false;
+
+    osalThreadJoin(&thread);
+    osalThreadDestroy(&thread);
+    return error == OsalError::eOk;
+}
+
 bool osalInit()
+{
+    return osalInitEx(nullptr, nullptr);
+}
+
+bool osalInitEx(const OsalInitConfig* config, OsalInitReport* report)
 {
     initTimestamp();
 
-    return true;
+    OsalInitReport result{};
+    if (report != nullptr)
+        result.realtimeScheduling = isRealtimeSchedulingAvailable();
+
+    auto success = true;
+    if (config != nullptr) {
+        // THP has to be disabled first, so that memory faulted in the next steps is backed by regular pages.
+        if (config->disableTransparentHugePages) {
+            result.transparentHugePagesDisabled = (prctl(PR_SET_THP_DISABLE, 1, 0, 0, 0) == 0);
+            success = success && result.transparentHugePagesDisabled;
+        }
+
+        if (config->lockMemory) {
+            result.memoryLocked = (mlockall(MCL_CURRENT | MCL_FUTURE) == 0);
+            success = success && result.memoryLocked;
+        }
+
+        if (config->heapReserveSize != 0) {
+            result.heapPrefaulted = prefaultHeap(config->heapReserveSize);
+            success = success && result.heapPrefaulted;
+        }
+
+        stackPrefaultSize = config->stackPrefaultSize;
+        if (config->stackPrefaultSize != 0) {
+            result.stackPrefaulted = prefaultStack(config->stackPrefaultSize);
+            success = success && result.stackPrefaulted;
+        }
+    }
+
+    if (report != nullptr)
+        *report = result;
+
+    return success;
 }
@@ -0,0 +1,83 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "osal/Thread.h"
+
+#include <sched.h>
+
+#include <cstddef>
+
+/// Number of bytes of the stack, which every created thread pre-faults before invoking its user function.
+/// @note This value is set during OSAL initialization and 0 means, that stacks are not pre-faulted.
+extern std::size_t stackPrefaultSize; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+/// Touches the given number of bytes of the calling thread's stack, so that later use of it doesn't cause page faults.
+/// @param size             Number of bytes to be pre-faulted. It is clamped to the free space left on the stack.
+/// @return Flag indicating if stack has been pre-faulted.
+bool prefaultStack(std::size_t size);
+
+/// Converts OSAL thread priority to the native SCHED_RR/SCHED_FIFO priority.
+/// @param priority         OSAL thread priority to be converted.
+/// @param policy           Native real-time policy, for which priority should be converted.
+/// @return Native priority corresponding to the given OSAL priority or -1 if the given priority is invalid.
+inline int toNativePriority(OsalThreadPriority priority, int policy = SCHED_RR)
+{
+    const auto cPriorityMin = sched_get_priority_min(policy);
+    const auto cPriorityMax = sched_get_priority_max(policy);
+    const auto cPriorityStep = (cPriorityMax - cPriorityMin) / 4;
+
+    switch (priority) {
+        case OsalThreadPriority::eLowest: return cPriorityMin;
+        case OsalThreadPriority::eLow: return cPriorityMin + (cPriorityStep * 1);
+        case OsalThreadPriority::eNormal: return cPriorityMin + (cPriorityStep * 2);
+        case OsalThreadPriority::eHigh: return cPriorityMin + (cPriorityStep * 3);
+        case OsalThreadPriority::eHighest: return cPriorityMax;
+        default: return -1;
+    }
+}
+
+/// Converts OSAL thread priority to the nice value used by SCHED_OTHER threads.
+/// @param priority         OSAL thread priority to be converted.
+/// @return Nice value corresponding to the given OSAL priority.
+/// @note Priority is expected to be already validated with toNativePriority().
+inline int toNiceValue(OsalThreadPriority priority)
+{
+    switch (priority) {
+        case OsalThreadPriority::eLowest: return 19;
+        case OsalThreadPriority::eLow: return 10;
+        case OsalThreadPriority::eHigh: return -10;
+        case OsalThreadPriority::eHighest: return -20;
+        default: return 0;
+    }
+}
@@ -33,8 +33,22 @@
 #pragma once
 
 #include <chrono>
+#include <cstdint>
+#include <ctime>
 
 /// Internal value of system time latched during OSAL initialization.
 /// @note This value must be properly set by OSAL initialization in order to have correct values
 /// returned from timestamp module.
 extern std::chrono::steady_clock::time_point initTime; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+/// Converts the given OSAL timestamp in ns into absolute CLOCK_MONOTONIC timespec.
+/// @param timestampNs      OSAL timestamp in ns (relative to the call to osalInit()) to be converted.
+/// @return Absolute CLOCK_MONOTONIC timespec corresponding to the given OSAL timestamp.
+/// @note This conversion doesn't read the clock, because std::chrono::steady_clock is based on CLOCK_MONOTONIC.
+inline timespec toMonotonicTimespec(std::uint64_t timestampNs)
+{
+    constexpr std::uint64_t cNsInSec = 1000000000;
+
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(initTime.time_since_epoch()).count() + timestampNs;
+    return timespec{static_cast<std::time_t>(ns / cNsInSec), static_cast<long>(ns % cNsInSec)};
+}
@@ -31,7 +31,7 @@
 TEST_CASE("Errors have proper human readable messages", "[unit][cpp][error]")
 {
     const std::string cUnrecognizedMsg = "(unrecognized error)";
-    constexpr int cErrorsCount = 9;
+    constexpr int cErrorsCount = 11;
 
     for (int i = 0; i < cErrorsCount; ++i) {
         std::error_code error = static_cast<OsalError>(i);
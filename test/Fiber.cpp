@@ -0,0 +1,164 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#include <osal/Error.h>
+#include <osal/Fiber.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <cstddef>
+
+TEST_CASE("Fiber context creation with invalid arguments", "[unit][c][fiber]")
+{
+    alignas(16) std::array<std::byte, 4096> stack{};
+    auto func = [](void* /*unused*/) {};
+
+    OsalFiberContext context{};
+    auto error = osalFiberContextCreate(nullptr, stack.data(), stack.size(), func, nullptr);
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    error = osalFiberContextCreate(&context, nullptr, stack.size(), func, nullptr);
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    error = osalFiberContextCreate(&context, stack.data(), 0, func, nullptr);
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    error = osalFiberContextCreate(&context, stack.data(), stack.size(), nullptr, nullptr);
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    OsalFiberContext uninitialized{};
+    error = osalFiberContextSwitch(&context, &uninitialized);
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    error = osalFiberContextSwitch(nullptr, &uninitialized);
+    REQUIRE(error == OsalError::eInvalidArgument);
+}
+
+#ifdef __linux__
+struct PingPong {
+    OsalFiberContext main;
+    OsalFiberContext fiber;
+    int counter;
+    double value;
+};
+
+static int recursiveSum(int n)
+{
+    // Volatile local array makes sure, that each recursion level really uses the fiber stack.
+    volatile int padding[16]{}; // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+    padding[0] = n;
+    return (n == 0) ? 0 : padding[0] + recursiveSum(n - 1);
+}
+
+TEST_CASE("Switching between thread and fiber", "[unit][c][fiber]")
+{
+    constexpr int cSwitchesCount = 100000;
+    constexpr double cStep = 0.5;
+    constexpr int cRecursionDepth = 100;
+
+    alignas(16) static std::array<std::byte, 64 * 1024> stack{};
+    PingPong pingPong{};
+
+    auto func = [](void* param) {
+        auto* data = static_cast<PingPong*>(param);
+        if (recursiveSum(cRecursionDepth) != cRecursionDepth * (cRecursionDepth + 1) / 2)
+            data->counter = -1;
+
+        double local = 0.0;
+        while (true) {
+            ++data->counter;
+            local += cStep;
+            data->value = local;
+            osalFiberContextSwitch(&data->fiber, &data->main);
+        }
+    };
+
+    auto error = osalFiberContextCreate(&pingPong.fiber, stack.data(), stack.size(), func, &pingPong);
+    REQUIRE(error == OsalError::eOk);
+
+    double local = 0.0;
+    for (int i = 0; i < cSwitchesCount; ++i) {
+        error = osalFiberContextSwitch(&pingPong.main, &pingPong.fiber);
+        if (error != OsalError::eOk)
+            REQUIRE(error == OsalError::eOk);
+
+        // Floating point state has to be preserved on both sides of the switch.
+        local += 2 * cStep;
+    }
+
+    REQUIRE(pingPong.counter == cSwitchesCount);
+    REQUIRE(pingPong.value == cSwitchesCount * cStep);
+    REQUIRE(local == cSwitchesCount * 2 * cStep);
+}
+
+struct Ring {
+    static constexpr std::size_t cFibersCount = 4;
+    static constexpr int cRounds = 1000;
+
+    OsalFiberContext main;
+    std::array<OsalFiberContext, cFibersCount> fibers;
+    std::array<int, cFibersCount> counters;
+    std::size_t current;
+};
+
+TEST_CASE("Switching between fibers", "[unit][c][fiber]")
+{
+    alignas(16) static std::array<std::array<std::byte, 16 * 1024>, Ring::cFibersCount> stacks{};
+    static Ring ring{};
+
+    auto func = [](void* param) {
+        auto index = *static_cast<std::size_t*>(param);
+        for (int i = 0; i < Ring::cRounds; ++i) {
+            ++ring.counters[index];
+            ring.current = (index + 1) % Ring::cFibersCount;
+            osalFiberContextSwitch(&ring.fibers[index], &ring.fibers[ring.current]);
+        }
+
+        osalFiberContextSwitch(&ring.fibers[index], &ring.main);
+    };
+
+    static std::array<std::size_t, Ring::cFibersCount> indexes{};
+    for (std::size_t i = 0; i < Ring::cFibersCount; ++i) {
+        indexes[i] = i;
+        auto error = osalFiberContextCreate(&ring.fibers[i], stacks[i].data(), stacks[i].size(), func, &indexes[i]);
+        REQUIRE(error == OsalError::eOk);
+    }
+
+    auto error = osalFiberContextSwitch(&ring.main, &ring.fibers[0]);
+    REQUIRE(error == OsalError::eOk);
+
+    // First fiber returns to the main context once the last round of all fibers is finished.
+    for (std::size_t i = 0; i < Ring::cFibersCount; ++i)
+        REQUIRE(ring.counters[i] == Ring::cRounds);
+}
+#endif
@@ -0,0 +1,253 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#include <osal/Error.hpp>
+#include <osal/Fiber.hpp>
+#include <osal/Mutex.hpp>
+#include <osal/Semaphore.hpp>
+#include <osal/Thread.hpp>
+#include <osal/Timeout.hpp>
+#include <osal/sleep.hpp>
+#include <osal/timestamp.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <memory>
+
+#ifdef __linux__
+TEST_CASE("Fibers executed on carrier threads", "[unit][cpp][fiber]")
+{
+    constexpr int cFibersCount = 10000;
+    std::atomic<int> counter{};
+    std::atomic<int> outside{};
+
+    osal::FiberScheduler<4> scheduler("fiber");
+    REQUIRE(!scheduler.insideFiber());
+
+    auto start = osal::timestamp();
+    for (int i = 0; i < cFibersCount; ++i) {
+        auto error = scheduler.spawn(
+            [&](int value) {
+                if (!scheduler.insideFiber())
+                    ++outside;
+
+                // Each fiber sleeps, so all of them have to be suspended at the same time.
+                scheduler.sleep(50ms);
+                counter += value;
+            },
+            1);
+        REQUIRE(!error);
+    }
+
+    auto error = scheduler.shutdown();
+    REQUIRE(!error);
+    REQUIRE(counter == cFibersCount);
+    REQUIRE(outside == 0);
+    REQUIRE(scheduler.fibersCount() == 0);
+    REQUIRE(osal::timestamp() - start < 5s);
+
+    error = scheduler.spawn([] {});
+    REQUIRE(error == OsalError::eInvalidArgument);
+}
+
+TEST_CASE("Fibers with move-only arguments and yielding", "[unit][cpp][fiber]")
+{
+    constexpr int cYieldsCount = 100;
+    std::atomic<int> counter{};
+
+    {
+        osal::FiberScheduler<2> scheduler("fiber");
+        auto value = std::make_unique<int>(3);
+        auto error = scheduler.spawn(
+            [&](std::unique_ptr<int> ptr) {
+                for (int i = 0; i < cYieldsCount; ++i) {
+                    counter += *ptr;
+                    scheduler.yield();
+                }
+            },
+            std::move(value));
+        REQUIRE(!error);
+    }
+
+    REQUIRE(counter == 3 * cYieldsCount);
+}
+
+TEST_CASE("Fibers contending for mutex", "[unit][cpp][fiber]")
+{
+    constexpr int cFibersCount = 100;
+    constexpr int cIterations = 20;
+    osal::Mutex mutex;
+    int counter{};
+
+    {
+        osal::FiberScheduler<2> scheduler("fiber");
+        for (int i = 0; i < cFibersCount; ++i) {
+            auto error = scheduler.spawn([&] {
+                for (int j = 0; j < cIterations; ++j) {
+                    auto lockError = scheduler.lock(mutex);
+                    if (lockError)
+                        REQUIRE(!lockError);
+
+                    // Switching to other fibers inside the critical section must not break mutual exclusion.
+                    auto value = counter;
+                    scheduler.yield();
+                    counter = value + 1;
+                    mutex.unlock();
+                }
+            });
+            REQUIRE(!error);
+        }
+    }
+
+    REQUIRE(counter == cFibersCount * cIterations);
+}
+
+TEST_CASE("Fibers waiting with timeouts", "[unit][cpp][fiber]")
+{
+    osal::FiberScheduler<2> scheduler("fiber");
+    osal::Semaphore semaphore{0};
+    osal::Mutex mutex;
+
+    SECTION("Semaphore signaled by other thread")
+    {
+        std::atomic<int> timedOut{};
+        std::atomic<int> acquired{};
+        for (int i = 0; i < 4; ++i) {
+            scheduler.spawn([&] {
+                if (scheduler.wait(semaphore, 10ms) == OsalError::eTimeout)
+                    ++timedOut;
+
+                if (!scheduler.wait(semaphore, 1s))
+                    ++acquired;
+            });
+        }
+
+        osal::sleep(50ms);
+        semaphore.signal(4);
+        scheduler.shutdown();
+        REQUIRE(timedOut == 4);
+        REQUIRE(acquired == 4);
+    }
+
+    SECTION("Mutex locked by other thread")
+    {
+        std::atomic<bool> timedOut{};
+        std::atomic<bool> acquired{};
+        mutex.lock();
+        scheduler.spawn([&] {
+            timedOut = (scheduler.lock(mutex, 10ms) == OsalError::eTimeout);
+            acquired = !scheduler.lock(mutex);
+            if (acquired)
+                mutex.unlock();
+        });
+
+        osal::sleep(50ms);
+        mutex.unlock();
+        scheduler.shutdown();
+        REQUIRE(timedOut);
+        REQUIRE(acquired);
+    }
+
+    SECTION("Timeout")
+    {
+        std::atomic<bool> expired{};
+        auto start = osal::timestamp();
+        scheduler.spawn([&] {
+            osal::Timeout timeout(30ms);
+            expired = !scheduler.wait(timeout) && timeout.isExpired();
+        });
+
+        scheduler.shutdown();
+        REQUIRE(expired);
+        REQUIRE(osal::timestamp() - start >= 30ms);
+    }
+
+    SECTION("Called outside of the fiber")
+    {
+        auto error = scheduler.lock(mutex, 10ms);
+        REQUIRE(!error);
+        mutex.unlock();
+
+        error = scheduler.wait(semaphore, 10ms);
+        REQUIRE(error == OsalError::eTimeout);
+
+        error = scheduler.wait(osal::Timeout(10ms));
+        REQUIRE(!error);
+        scheduler.yield();
+    }
+}
+
+TEST_CASE("Fibers woken up by the scheduler-aware release without polling", "[unit][cpp][fiber]")
+{
+    osal::FiberScheduler<2> scheduler("fiber", osal::Duration::max());
+    osal::Semaphore semaphore{0};
+    osal::Mutex mutex;
+
+    std::atomic<int> acquired{};
+    mutex.lock();
+    for (int i = 0; i < 2; ++i) {
+        scheduler.spawn([&] {
+            if (!scheduler.wait(semaphore))
+                ++acquired;
+
+            if (!scheduler.lock(mutex)) {
+                ++acquired;
+                scheduler.unlock(mutex);
+            }
+        });
+    }
+
+    osal::sleep(30ms);
+    scheduler.signal(semaphore);
+    scheduler.signal(semaphore);
+    scheduler.unlock(mutex);
+
+    auto start = osal::timestamp();
+    scheduler.shutdown();
+    REQUIRE(acquired == 4);
+    REQUIRE(osal::timestamp() - start < 1s);
+}
+
+TEST_CASE("Fiber scheduler started twice", "[unit][cpp][fiber]")
+{
+    osal::FiberScheduler<1> scheduler;
+    auto error = scheduler.spawn([] {});
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    error = scheduler.start("fiber");
+    REQUIRE(!error);
+
+    error = scheduler.start("fiber");
+    REQUIRE(error == OsalError::eThreadAlreadyStarted);
+}
+#endif
@@ -34,10 +34,21 @@
 #include <osal/Mutex.h>
 #include <osal/Thread.hpp>
 #include <osal/sleep.hpp>
+#include <osal/timestamp.h>
 #include <osal/timestamp.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#ifdef __linux__
+    #include <sys/mman.h>
+    #include <sys/wait.h>
+    #include <unistd.h>
+#endif
+
 TEST_CASE("Mutex creation and destruction", "[unit][c][mutex]")
 {
     OsalMutexType type{};
@@ -47,6 +58,11 @@ TEST_CASE("Mutex creation and destruction", "[unit][c][mutex]")
         type = OsalMutexType::eNonRecursive;
     }
 
+    SECTION("Adaptive mutex")
+    {
+        type = OsalMutexType::eAdaptive;
+    }
+
     SECTION("Recursive mutex")
     {
         type = OsalMutexType::eRecursive;
@@ -77,6 +93,11 @@ TEST_CASE("Invalid parameters to mutex creation and destruction functions", "[un
         type = OsalMutexType::eNonRecursive;
     }
 
+    SECTION("Adaptive mutex")
+    {
+        type = OsalMutexType::eAdaptive;
+    }
+
     SECTION("Recursive mutex")
     {
         type = OsalMutexType::eRecursive;
@@ -103,6 +124,11 @@ TEST_CASE("Lock and unlock from one thread", "[unit][c][mutex]")
         type = OsalMutexType::eNonRecursive;
     }
 
+    SECTION("Adaptive mutex")
+    {
+        type = OsalMutexType::eAdaptive;
+    }
+
     SECTION("Recursive mutex")
     {
         type = OsalMutexType::eRecursive;
@@ -141,6 +167,9 @@ TEST_CASE("Invalid arguments passed to mutex functions in one thread", "[unit][c
     error = osalMutexTimedLock(nullptr, 3);
     REQUIRE(error == OsalError::eInvalidArgument);
 
+    error = osalMutexTimedLockUntil(nullptr, osalTimestampNs());
+    REQUIRE(error == OsalError::eInvalidArgument);
+
     error = osalMutexUnlock(nullptr);
     REQUIRE(error == OsalError::eInvalidArgument);
 
@@ -157,6 +186,11 @@ TEST_CASE("Lock called from two threads", "[unit][c][mutex]")
         type = OsalMutexType::eNonRecursive;
     }
 
+    SECTION("Adaptive mutex")
+    {
+        type = OsalMutexType::eAdaptive;
+    }
+
     SECTION("Recursive mutex")
     {
         type = OsalMutexType::eRecursive;
@@ -211,6 +245,11 @@ TEST_CASE("TryLock called from second thread", "[unit][c][mutex]")
         type = OsalMutexType::eNonRecursive;
     }
 
+    SECTION("Adaptive mutex")
+    {
+        type = OsalMutexType::eAdaptive;
+    }
+
     SECTION("Recursive mutex")
     {
         type = OsalMutexType::eRecursive;
@@ -264,6 +303,11 @@ TEST_CASE("TryLock and unlock called from ISR", "[unit][c][mutex]")
         type = OsalMutexType::eNonRecursive;
     }
 
+    SECTION("Adaptive mutex")
+    {
+        type = OsalMutexType::eAdaptive;
+    }
+
     SECTION("Default mutex")
     {
         type = cOsalMutexDefaultType;
@@ -325,6 +369,11 @@ TEST_CASE("TimedLock called from second thread, timeout", "[unit][c][mutex]")
         type = OsalMutexType::eNonRecursive;
     }
 
+    SECTION("Adaptive mutex")
+    {
+        type = OsalMutexType::eAdaptive;
+    }
+
     SECTION("Recursive mutex")
     {
         type = OsalMutexType::eRecursive;
@@ -374,6 +423,11 @@ TEST_CASE("TimedLock called from second thread, success", "[unit][c][mutex]")
         type = OsalMutexType::eNonRecursive;
     }
 
+    SECTION("Adaptive mutex")
+    {
+        type = OsalMutexType::eAdaptive;
+    }
+
     SECTION("Recursive mutex")
     {
         type = OsalMutexType::eRecursive;
@@ -417,3 +471,515 @@ TEST_CASE("TimedLock called from second thread, success", "[unit][c][mutex]")
     error = osalMutexDestroy(&mutex);
     REQUIRE(error == OsalError::eOk);
 }
+
+TEST_CASE("TimedLockUntil called from second thread", "[unit][c][mutex]")
+{
+    OsalMutexType type{};
+
+    SECTION("Non recursive mutex")
+    {
+        type = OsalMutexType::eNonRecursive;
+    }
+
+    SECTION("Adaptive mutex")
+    {
+        type = OsalMutexType::eAdaptive;
+    }
+
+    SECTION("Recursive mutex")
+    {
+        type = OsalMutexType::eRecursive;
+    }
+
+    OsalMutex mutex{};
+    auto error = osalMutexCreate(&mutex, type);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalMutexLock(&mutex);
+    REQUIRE(error == OsalError::eOk);
+
+    auto func = [&mutex] {
+        constexpr std::uint64_t cTimeoutMs = 100;
+        auto deadlineNs = osalTimestampNs() + osalMsToNs(cTimeoutMs);
+
+        auto error = osalMutexTimedLockUntil(&mutex, deadlineNs);
+        if (error != OsalError::eTimeout)
+            REQUIRE(error == OsalError::eTimeout);
+
+        if (osalTimestampNs() < deadlineNs)
+            REQUIRE(osalTimestampNs() >= deadlineNs);
+
+        // Deadline from the past should behave like tryLock().
+        error = osalMutexTimedLockUntil(&mutex, 0);
+        if (error != OsalError::eTimeout)
+            REQUIRE(error == OsalError::eTimeout);
+
+        deadlineNs = osalTimestampNs() + osalMsToNs(cTimeoutMs);
+        error = osalMutexTimedLockUntil(&mutex, deadlineNs);
+        if (error != OsalError::eOk)
+            REQUIRE(error == OsalError::eOk);
+
+        if (osalTimestampNs() > deadlineNs)
+            REQUIRE(osalTimestampNs() <= deadlineNs);
+
+        error = osalMutexUnlock(&mutex);
+        if (error != OsalError::eOk)
+            REQUIRE(error == OsalError::eOk);
+    };
+
+    osal::Thread thread(func);
+    osal::sleep(150ms);
+
+    error = osalMutexUnlock(&mutex);
+    REQUIRE(error == OsalError::eOk);
+
+    thread.join();
+
+    error = osalMutexDestroy(&mutex);
+    REQUIRE(error == OsalError::eOk);
+}
+
+TEST_CASE("Lock called from many threads under contention", "[unit][c][mutex]")
+{
+    OsalMutexType type{};
+
+    SECTION("Non recursive mutex")
+    {
+        type = OsalMutexType::eNonRecursive;
+    }
+
+    SECTION("Adaptive mutex")
+    {
+        type = OsalMutexType::eAdaptive;
+    }
+
+    SECTION("Recursive mutex")
+    {
+        type = OsalMutexType::eRecursive;
+    }
+
+    OsalMutex mutex{};
+    auto error = osalMutexCreate(&mutex, type);
+    REQUIRE(error == OsalError::eOk);
+
+    constexpr int cIterations = 10000;
+    int counter{};
+
+    auto func = [&mutex, &counter] {
+        for (int i = 0; i < cIterations; ++i) {
+            if (auto error = osalMutexLock(&mutex))
+                REQUIRE(!error);
+
+            ++counter;
+
+            if (auto error = osalMutexUnlock(&mutex))
+                REQUIRE(!error);
+        }
+    };
+
+    {
+        osal::Thread thread1(func);
+        osal::Thread thread2(func);
+        osal::Thread thread3(func);
+    }
+
+    REQUIRE(counter == 3 * cIterations);
+
+    error = osalMutexDestroy(&mutex);
+    REQUIRE(error == OsalError::eOk);
+}
+
+TEST_CASE("Recursive mutex unlocked by not owning thread", "[unit][c][mutex]")
+{
+    OsalMutex mutex{};
+    auto error = osalMutexCreate(&mutex, OsalMutexType::eRecursive);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalMutexUnlock(&mutex);
+    REQUIRE(error == OsalError::eNotOwner);
+
+    error = osalMutexLock(&mutex);
+    REQUIRE(error == OsalError::eOk);
+
+    auto func = [&mutex] {
+        auto error = osalMutexUnlock(&mutex);
+        if (error != OsalError::eNotOwner)
+            REQUIRE(error == OsalError::eNotOwner);
+    };
+
+    osal::Thread thread(func);
+    thread.join();
+
+    error = osalMutexUnlock(&mutex);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalMutexDestroy(&mutex);
+    REQUIRE(error == OsalError::eOk);
+}
+
+TEST_CASE("Mutex with priority inheritance", "[unit][c][mutex]")
+{
+    OsalMutexConfig config{};
+
+    SECTION("Non recursive mutex with priority inheritance")
+    {
+        config.type = OsalMutexType::eNonRecursive;
+        config.protocol = OsalMutexProtocol::ePriorityInheritance;
+    }
+
+    SECTION("Recursive mutex with priority inheritance")
+    {
+        config.type = OsalMutexType::eRecursive;
+        config.protocol = OsalMutexProtocol::ePriorityInheritance;
+    }
+
+    OsalMutex mutex{};
+    auto error = osalMutexCreateEx(&mutex, config);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalMutexLock(&mutex);
+    REQUIRE(error == OsalError::eOk);
+
+    auto func = [&mutex] {
+        auto error = osalMutexTryLock(&mutex);
+        if (error != OsalError::eLocked)
+            REQUIRE(error == OsalError::eLocked);
+
+        error = osalMutexTimedLock(&mutex, 500);
+        if (error != OsalError::eOk)
+            REQUIRE(error == OsalError::eOk);
+
+        error = osalMutexUnlock(&mutex);
+        if (error != OsalError::eOk)
+            REQUIRE(error == OsalError::eOk);
+    };
+
+    osal::Thread thread(func);
+    osal::sleep(50ms);
+
+    error = osalMutexUnlock(&mutex);
+    REQUIRE(error == OsalError::eOk);
+
+    thread.join();
+
+    error = osalMutexDestroy(&mutex);
+    REQUIRE(error == OsalError::eOk);
+}
+
+TEST_CASE("Mutex with priority ceiling", "[unit][c][mutex]")
+{
+    OsalMutexType type{};
+
+    SECTION("Non recursive mutex")
+    {
+        type = OsalMutexType::eNonRecursive;
+    }
+
+    SECTION("Recursive mutex")
+    {
+        type = OsalMutexType::eRecursive;
+    }
+
+    OsalMutex mutex{};
+    auto error = osalMutexCreateEx(&mutex, {type, OsalMutexProtocol::ePriorityCeiling, OsalThreadPriority::eHighest});
+    REQUIRE(error == OsalError::eOk);
+
+    // Priority ceiling can be applied only to threads with real-time scheduling policy.
+    error = osalMutexLock(&mutex);
+    if (error == OsalError::eOk) {
+        error = osalMutexUnlock(&mutex);
+        REQUIRE(error == OsalError::eOk);
+    }
+    else {
+        REQUIRE(error == OsalError::eInvalidArgument);
+    }
+
+    error = osalMutexDestroy(&mutex);
+    REQUIRE(error == OsalError::eOk);
+}
+
+TEST_CASE("Invalid mutex configurations", "[unit][c][mutex]")
+{
+    OsalMutexConfig config{};
+
+    SECTION("Adaptive mutex with priority inheritance")
+    {
+        config = {OsalMutexType::eAdaptive, OsalMutexProtocol::ePriorityInheritance, cOsalThreadDefaultPriority};
+    }
+
+    SECTION("Adaptive mutex with priority ceiling")
+    {
+        config = {OsalMutexType::eAdaptive, OsalMutexProtocol::ePriorityCeiling, cOsalThreadDefaultPriority};
+    }
+
+    SECTION("Invalid priority ceiling")
+    {
+        config = {OsalMutexType::eNonRecursive, OsalMutexProtocol::ePriorityCeiling, static_cast<OsalThreadPriority>(-1)};
+    }
+
+    SECTION("Invalid protocol")
+    {
+        config = {OsalMutexType::eNonRecursive, static_cast<OsalMutexProtocol>(-1), cOsalThreadDefaultPriority};
+    }
+
+    OsalMutex mutex{};
+    auto error = osalMutexCreateEx(&mutex, config);
+    REQUIRE(error == OsalError::eInvalidArgument);
+}
+
+TEST_CASE("Mutex statistics", "[unit][c][mutex]")
+{
+    OsalMutexType type{};
+
+    SECTION("Non recursive mutex")
+    {
+        type = OsalMutexType::eNonRecursive;
+    }
+
+    SECTION("Adaptive mutex")
+    {
+        type = OsalMutexType::eAdaptive;
+    }
+
+    SECTION("Recursive mutex")
+    {
+        type = OsalMutexType::eRecursive;
+    }
+
+    OsalMutex mutex{};
+    auto error = osalMutexCreate(&mutex, type);
+    REQUIRE(error == OsalError::eOk);
+
+    OsalMutexStats stats{};
+    OsalMutexStats snapshot{};
+    error = osalMutexGetStats(&mutex, &snapshot);
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    error = osalMutexEnableStats(&mutex, &stats, "test");
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalMutexEnableStats(&mutex, &stats, "test");
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    error = osalMutexLock(&mutex);
+    REQUIRE(error == OsalError::eOk);
+
+    auto func = [&mutex] {
+        auto error = osalMutexLock(&mutex);
+        if (error != OsalError::eOk)
+            REQUIRE(error == OsalError::eOk);
+
+        error = osalMutexUnlock(&mutex);
+        if (error != OsalError::eOk)
+            REQUIRE(error == OsalError::eOk);
+    };
+
+    osal::Thread thread(func);
+    osal::sleep(50ms);
+
+    error = osalMutexUnlock(&mutex);
+    REQUIRE(error == OsalError::eOk);
+
+    thread.join();
+
+    error = osalMutexTryLock(&mutex);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalMutexUnlock(&mutex);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalMutexGetStats(&mutex, &snapshot);
+    REQUIRE(error == OsalError::eOk);
+    REQUIRE(std::string_view(snapshot.name) == "test");
+    REQUIRE(snapshot.acquisitions == 3);
+    REQUIRE(snapshot.contentions == 1);
+    REQUIRE(snapshot.maxHoldNs >= osalMsToNs(50));
+
+    std::uint64_t waits{};
+    std::uint64_t holds{};
+    for (std::size_t i = 0; i < cOsalMutexStatsBuckets; ++i) {
+        waits += snapshot.waitHistogram[i];
+        holds += snapshot.holdHistogram[i];
+    }
+
+    REQUIRE(waits == 3);
+    REQUIRE(holds == 3);
+    REQUIRE(snapshot.waitHistogram[0] == 2);
+
+    OsalMutexStats top{};
+    REQUIRE(osalMutexStatsTopContended(&top, 1) == 1);
+    REQUIRE(top.contentions >= 1);
+
+    error = osalMutexResetStats(&mutex);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalMutexGetStats(&mutex, &snapshot);
+    REQUIRE(error == OsalError::eOk);
+    REQUIRE(snapshot.acquisitions == 0);
+    REQUIRE(snapshot.contentions == 0);
+    REQUIRE(snapshot.maxHoldNs == 0);
+
+    error = osalMutexDisableStats(&mutex);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalMutexDisableStats(&mutex);
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    REQUIRE(osalMutexStatsTopContended(&top, 1) == 0);
+
+    error = osalMutexDestroy(&mutex);
+    REQUIRE(error == OsalError::eOk);
+}
+
+TEST_CASE("Mutex statistics with unlock from not owning thread", "[unit][c][mutex]")
+{
+    OsalMutexConfig config{};
+
+    SECTION("Recursive mutex")
+    {
+        config.type = OsalMutexType::eRecursive;
+    }
+
+    SECTION("Non recursive mutex with priority inheritance")
+    {
+        config.type = OsalMutexType::eNonRecursive;
+        config.protocol = OsalMutexProtocol::ePriorityInheritance;
+    }
+
+    OsalMutex mutex{};
+    auto error = osalMutexCreateEx(&mutex, config);
+    REQUIRE(error == OsalError::eOk);
+
+    OsalMutexStats stats{};
+    error = osalMutexEnableStats(&mutex, &stats, "test");
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalMutexLock(&mutex);
+    REQUIRE(error == OsalError::eOk);
+
+    auto func = [&mutex] {
+        auto error = osalMutexUnlock(&mutex);
+        if (error != OsalError::eNotOwner)
+            REQUIRE(error == OsalError::eNotOwner);
+    };
+
+    osal::Thread thread(func);
+    thread.join();
+
+    OsalMutexStats snapshot{};
+    error = osalMutexGetStats(&mutex, &snapshot);
+    REQUIRE(error == OsalError::eOk);
+    REQUIRE(snapshot.acquisitions == 1);
+
+    std::uint64_t holds{};
+    for (std::size_t i = 0; i < cOsalMutexStatsBuckets; ++i)
+        holds += snapshot.holdHistogram[i];
+
+    REQUIRE(holds == 0);
+
+    error = osalMutexUnlock(&mutex);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalMutexLock(&mutex);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalMutexUnlock(&mutex);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalMutexGetStats(&mutex, &snapshot);
+    REQUIRE(error == OsalError::eOk);
+    REQUIRE(snapshot.acquisitions == 2);
+
+    holds = 0;
+    for (std::size_t i = 0; i < cOsalMutexStatsBuckets; ++i)
+        holds += snapshot.holdHistogram[i];
+
+    REQUIRE(holds == 2);
+
+    error = osalMutexDestroy(&mutex);
+    REQUIRE(error == OsalError::eOk);
+}
+
+TEST_CASE("Process-shared mutex", "[unit][c][mutex]")
+{
+    OsalMutexConfig config{cOsalMutexDefaultType, cOsalMutexDefaultProtocol, cOsalThreadDefaultPriority};
+
+    SECTION("Non recursive mutex") { config.type = OsalMutexType::eNonRecursive; }
+    SECTION("Recursive mutex") { config.type = OsalMutexType::eRecursive; }
+    SECTION("Adaptive mutex") { config.type = OsalMutexType::eAdaptive; }
+
+    OsalMutex mutex{};
+    auto error = osalMutexCreateShared(&mutex, config);
+    REQUIRE(error == OsalError::eOk);
+
+    OsalMutexStats stats{};
+    error = osalMutexEnableStats(&mutex, &stats, "shared");
+#ifdef __linux__
+    REQUIRE(error == OsalError::eInvalidArgument);
+#else
+    REQUIRE(error == OsalError::eOk);
+#endif
+
+    error = osalMutexLock(&mutex);
+    REQUIRE(error == OsalError::eOk);
+
+    auto func = [&mutex] {
+        auto threadError = osalMutexTryLock(&mutex);
+        if (threadError != OsalError::eLocked)
+            REQUIRE(threadError == OsalError::eLocked);
+    };
+
+    osal::Thread thread(func);
+    auto joinError = thread.join();
+    REQUIRE(!joinError);
+
+    error = osalMutexUnlock(&mutex);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalMutexTimedLock(&mutex, 10);
+    REQUIRE(error == OsalError::eOk);
+    error = osalMutexUnlock(&mutex);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalMutexDestroy(&mutex);
+    REQUIRE(error == OsalError::eOk);
+}
+
+#ifdef __linux__
+TEST_CASE("Process-shared mutex recovered after owner process died", "[unit][c][mutex]")
+{
+    auto* memory = mmap(nullptr, sizeof(OsalMutex), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    REQUIRE(memory != MAP_FAILED);
+
+    auto* mutex = static_cast<OsalMutex*>(memory);
+    OsalMutexConfig config{cOsalMutexDefaultType, cOsalMutexDefaultProtocol, cOsalThreadDefaultPriority};
+    auto error = osalMutexCreateShared(mutex, config);
+    REQUIRE(error == OsalError::eOk);
+
+    auto pid = fork();
+    REQUIRE(pid != -1);
+    if (pid == 0) {
+        // Child terminates while holding the mutex.
+        _exit(osalMutexLock(mutex) == OsalError::eOk ? 0 : 1);
+    }
+
+    int status{};
+    REQUIRE(waitpid(pid, &status, 0) == pid);
+    REQUIRE(WIFEXITED(status));
+    REQUIRE(WEXITSTATUS(status) == 0);
+
+    error = osalMutexTryLock(mutex);
+    REQUIRE(error == OsalError::eOwnerDead);
+    error = osalMutexUnlock(mutex);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalMutexLock(mutex);
+    REQUIRE(error == OsalError::eOk);
+    error = osalMutexUnlock(mutex);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalMutexDestroy(mutex);
+    REQUIRE(error == OsalError::eOk);
+    munmap(memory, sizeof(OsalMutex));
+}
+#endif
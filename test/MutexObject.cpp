@@ -32,12 +32,15 @@
 
 #include <osal/Error.hpp>
 #include <osal/Mutex.hpp>
+#include <osal/ScopedLock.hpp>
 #include <osal/Thread.hpp>
 #include <osal/sleep.hpp>
 #include <osal/timestamp.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <cstdint>
+#include <string_view>
 #include <utility>
 
 TEST_CASE("Mutex creation and destruction in C++", "[unit][cpp][mutex]")
@@ -49,6 +52,11 @@ TEST_CASE("Mutex creation and destruction in C++", "[unit][cpp][mutex]")
         type = OsalMutexType::eNonRecursive;
     }
 
+    SECTION("Adaptive mutex")
+    {
+        type = OsalMutexType::eAdaptive;
+    }
+
     SECTION("Recursive mutex")
     {
         type = OsalMutexType::eRecursive;
@@ -98,6 +106,11 @@ TEST_CASE("Lock called from two threads in C++", "[unit][cpp][mutex]")
         type = OsalMutexType::eNonRecursive;
     }
 
+    SECTION("Adaptive mutex")
+    {
+        type = OsalMutexType::eAdaptive;
+    }
+
     SECTION("Recursive mutex")
     {
         type = OsalMutexType::eRecursive;
@@ -143,6 +156,11 @@ TEST_CASE("TryLock called from second threads in C++", "[unit][cpp][mutex]")
         type = OsalMutexType::eNonRecursive;
     }
 
+    SECTION("Adaptive mutex")
+    {
+        type = OsalMutexType::eAdaptive;
+    }
+
     SECTION("Recursive mutex")
     {
         type = OsalMutexType::eRecursive;
@@ -190,6 +208,11 @@ TEST_CASE("TryLock and unlock called from ISR in C++", "[unit][cpp][mutex]")
         type = OsalMutexType::eNonRecursive;
     }
 
+    SECTION("Adaptive mutex")
+    {
+        type = OsalMutexType::eAdaptive;
+    }
+
     SECTION("Default mutex")
     {
         type = cOsalMutexDefaultType;
@@ -240,6 +263,11 @@ TEST_CASE("TimedLock called from second thread, timeout in C++", "[unit][cpp][mu
         type = OsalMutexType::eNonRecursive;
     }
 
+    SECTION("Adaptive mutex")
+    {
+        type = OsalMutexType::eAdaptive;
+    }
+
     SECTION("Recursive mutex")
     {
         type = OsalMutexType::eRecursive;
@@ -283,6 +311,11 @@ TEST_CASE("TimedLock called from second thread, success in C++", "[unit][cpp][mu
         type = OsalMutexType::eNonRecursive;
     }
 
+    SECTION("Adaptive mutex")
+    {
+        type = OsalMutexType::eAdaptive;
+    }
+
     SECTION("Recursive mutex")
     {
         type = OsalMutexType::eRecursive;
@@ -333,3 +366,133 @@ TEST_CASE("Timeout used with mutexes in C++", "[unit][cpp][mutex]")
     error = mutex.unlock();
     REQUIRE(!error);
 }
+
+TEST_CASE("Adaptive mutex spin budget in C++", "[unit][cpp][mutex]")
+{
+    osal::Mutex recursiveMutex(OsalMutexType::eRecursive);
+    auto error = recursiveMutex.setSpinBudget(0);
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    std::uint32_t spinBudget{};
+
+    SECTION("Spinning disabled")
+    {
+        spinBudget = 0;
+    }
+
+    SECTION("Default spin budget")
+    {
+        spinBudget = cOsalMutexDefaultSpinBudget;
+    }
+
+    SECTION("Large spin budget")
+    {
+        spinBudget = 100000;
+    }
+
+    osal::Mutex mutex(OsalMutexType::eAdaptive);
+    error = mutex.setSpinBudget(spinBudget);
+    REQUIRE(!error);
+
+    constexpr int cIterations = 10000;
+    int counter{};
+
+    auto func = [&mutex, &counter] {
+        for (int i = 0; i < cIterations; ++i) {
+            osal::ScopedLock lock(mutex);
+            ++counter;
+        }
+    };
+
+    {
+        osal::Thread thread1(func);
+        osal::Thread thread2(func);
+        osal::Thread thread3(func);
+    }
+
+    REQUIRE(counter == 3 * cIterations);
+}
+
+TEST_CASE("Mutex with priority inheritance in C++", "[unit][cpp][mutex]")
+{
+    osal::Mutex mutex({OsalMutexType::eNonRecursive, OsalMutexProtocol::ePriorityInheritance, cOsalThreadDefaultPriority});
+    std::error_code threadError;
+
+    auto func = [&mutex, &threadError] {
+        osal::ScopedLock lock(mutex, 500ms);
+        threadError = lock ? OsalError::eOk : OsalError::eTimeout;
+    };
+
+    osal::Thread thread;
+
+    {
+        osal::ScopedLock lock(mutex);
+        REQUIRE(lock.isAcquired());
+
+        auto error = mutex.tryLock();
+        REQUIRE(error == OsalError::eLocked);
+
+        thread.start(func);
+        osal::sleep(50ms);
+    }
+
+    auto error = thread.join();
+    REQUIRE(!error);
+    REQUIRE(!threadError);
+}
+
+TEST_CASE("Mutex statistics in C++", "[unit][cpp][mutex]")
+{
+    constexpr int cIterations = 1000;
+    osal::Mutex mutex1;
+    osal::Mutex mutex2(OsalMutexType::eRecursive);
+    osal::Mutex mutex3;
+
+    auto error = mutex1.enableStats("mutex1");
+    REQUIRE(!error);
+
+    error = mutex2.enableStats("mutex2");
+    REQUIRE(!error);
+
+    auto func = [&mutex1, &mutex2] {
+        for (int i = 0; i < cIterations; ++i) {
+            osal::ScopedLock lock1(mutex1);
+            osal::ScopedLock lock2(mutex2);
+            osal::ScopedLock lock3(mutex2);
+        }
+    };
+
+    {
+        osal::Thread thread1(func);
+        osal::Thread thread2(func);
+    }
+
+    OsalMutexStats stats{};
+    error = mutex3.stats(stats);
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    error = mutex1.stats(stats);
+    REQUIRE(!error);
+    REQUIRE(stats.acquisitions == 2 * cIterations);
+
+    error = mutex2.stats(stats);
+    REQUIRE(!error);
+    REQUIRE(stats.acquisitions == 2 * cIterations);
+    REQUIRE(stats.contentions == 0);
+
+    auto top = osal::topContendedMutexes(10);
+    REQUIRE(top.size() == 2);
+    REQUIRE(top[0].contentions >= top[1].contentions);
+
+    osal::Mutex moved(std::move(mutex1));
+    error = moved.stats(stats);
+    REQUIRE(!error);
+    REQUIRE(std::string_view(stats.name) == "mutex1");
+
+    error = mutex2.disableStats();
+    REQUIRE(!error);
+
+    top = osal::topContendedMutexes(10);
+    REQUIRE(top.size() == 1);
+    REQUIRE(std::string_view(top[0].name) == "mutex1");
+}
@@ -0,0 +1,160 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#include <osal/Parallel.hpp>
+#include <osal/WorkStealingExecutor.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+using Executor = osal::WorkStealingExecutor<4, 64>;
+
+TEST_CASE("Parallel for visits each index exactly once", "[unit][cpp][parallel]")
+{
+    constexpr std::size_t cSize = 10000;
+    std::array<std::atomic<int>, cSize> visits{};
+
+    Executor executor("pfor");
+
+    SECTION("Explicit grain")
+    {
+        osal::parallelFor(executor, std::size_t{0}, cSize, 100, [&visits](std::size_t i) { ++visits[i]; });
+    }
+
+    SECTION("Automatic grain")
+    {
+        osal::parallelFor(executor, std::size_t{0}, cSize, osal::cAutoGrain, [&visits](std::size_t i) { ++visits[i]; });
+    }
+
+    SECTION("Grain bigger than range")
+    {
+        osal::parallelFor(executor, std::size_t{0}, cSize, 2 * cSize, [&visits](std::size_t i) { ++visits[i]; });
+    }
+
+    SECTION("Executor not running")
+    {
+        executor.shutdown();
+        osal::parallelFor(executor, std::size_t{0}, cSize, 10, [&visits](std::size_t i) { ++visits[i]; });
+    }
+
+    REQUIRE(std::all_of(visits.begin(), visits.end(), [](const auto& count) { return count == 1; }));
+}
+
+TEST_CASE("Parallel for with empty and signed ranges", "[unit][cpp][parallel]")
+{
+    Executor executor("pfor");
+    std::atomic<int> sum{};
+
+    osal::parallelFor(executor, 5, 5, osal::cAutoGrain, [&sum](int i) { sum += i; });
+    REQUIRE(sum == 0);
+
+    osal::parallelFor(executor, 5, 0, osal::cAutoGrain, [&sum](int i) { sum += i; });
+    REQUIRE(sum == 0);
+
+    osal::parallelFor(executor, -100, 101, 7, [&sum](int i) { sum += i; });
+    REQUIRE(sum == 0);
+}
+
+TEST_CASE("Parallel reduce", "[unit][cpp][parallel]")
+{
+    constexpr std::uint64_t cSize = 100000;
+    Executor executor("preduce");
+
+    SECTION("Sum")
+    {
+        auto sum = osal::parallelReduce(
+            executor,
+            std::uint64_t{0},
+            cSize,
+            osal::cAutoGrain,
+            std::uint64_t{0},
+            [](std::uint64_t i) { return i; },
+            [](std::uint64_t a, std::uint64_t b) { return a + b; });
+        REQUIRE(sum == cSize * (cSize - 1) / 2);
+    }
+
+    SECTION("Maximum")
+    {
+        auto maximum = osal::parallelReduce(
+            executor,
+            std::uint64_t{0},
+            cSize,
+            64,
+            std::numeric_limits<std::uint64_t>::min(),
+            [](std::uint64_t i) { return (i * 7919) % cSize; },
+            [](std::uint64_t a, std::uint64_t b) { return std::max(a, b); });
+        REQUIRE(maximum == cSize - 1);
+    }
+
+    SECTION("Non-commutative reduction preserves order")
+    {
+        // Each value represents range [first, last), which can be merged only with the directly following one.
+        struct Range {
+            std::uint64_t first;
+            std::uint64_t last;
+            bool valid;
+        };
+
+        auto result = osal::parallelReduce(
+            executor,
+            std::uint64_t{0},
+            cSize,
+            100,
+            Range{0, 0, true},
+            [](std::uint64_t i) { return Range{i, i + 1, true}; },
+            [](const Range& a, const Range& b) {
+                if (a.first == a.last)
+                    return b;
+
+                if (b.first == b.last)
+                    return a;
+
+                return Range{a.first, b.last, a.valid && b.valid && a.last == b.first};
+            });
+        REQUIRE(result.valid);
+        REQUIRE(result.first == 0);
+        REQUIRE(result.last == cSize);
+    }
+
+    SECTION("Empty range")
+    {
+        auto sum = osal::parallelReduce(
+            executor, 10, 10, osal::cAutoGrain, 42, [](int i) { return i; }, [](int a, int b) { return a + b; });
+        REQUIRE(sum == 42);
+    }
+}
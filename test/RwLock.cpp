@@ -0,0 +1,385 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#include <osal/Error.h>
+#include <osal/RwLock.h>
+#include <osal/Thread.hpp>
+#include <osal/sleep.hpp>
+#include <osal/timestamp.h>
+#include <osal/timestamp.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+TEST_CASE("RwLock creation and destruction", "[unit][c][rwlock]")
+{
+    OsalRwLockPolicy policy{};
+
+    SECTION("Prefer reader policy")
+    {
+        policy = OsalRwLockPolicy::ePreferReader;
+    }
+
+    SECTION("Prefer writer policy")
+    {
+        policy = OsalRwLockPolicy::ePreferWriter;
+    }
+
+    SECTION("Fair policy")
+    {
+        policy = OsalRwLockPolicy::eFair;
+    }
+
+    SECTION("Default policy")
+    {
+        policy = cOsalRwLockDefaultPolicy;
+    }
+
+    OsalRwLock rwLock{};
+    auto error = osalRwLockCreate(&rwLock, policy);
+    REQUIRE(error == OsalError::eOk);
+    REQUIRE(rwLock.initialized);
+
+    error = osalRwLockDestroy(&rwLock);
+    REQUIRE(error == OsalError::eOk);
+    REQUIRE(!rwLock.initialized);
+}
+
+TEST_CASE("Invalid arguments passed to rwlock functions", "[unit][c][rwlock]")
+{
+    auto error = osalRwLockCreate(nullptr, cOsalRwLockDefaultPolicy);
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    OsalRwLock rwLock{};
+    error = osalRwLockCreate(&rwLock, static_cast<OsalRwLockPolicy>(-1));
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    error = osalRwLockDestroy(nullptr);
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    error = osalRwLockDestroy(&rwLock);
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    error = osalRwLockReadLock(nullptr);
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    error = osalRwLockReadTryLock(nullptr);
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    error = osalRwLockReadTimedLock(nullptr, 3);
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    error = osalRwLockReadTimedLockUntil(nullptr, osalTimestampNs());
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    error = osalRwLockReadUnlock(nullptr);
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    error = osalRwLockWriteLock(nullptr);
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    error = osalRwLockWriteTryLock(nullptr);
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    error = osalRwLockWriteTimedLock(nullptr, 3);
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    error = osalRwLockWriteTimedLockUntil(nullptr, osalTimestampNs());
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    error = osalRwLockWriteUnlock(nullptr);
+    REQUIRE(error == OsalError::eInvalidArgument);
+}
+
+TEST_CASE("Readers share the rwlock and writer excludes everyone", "[unit][c][rwlock]")
+{
+    OsalRwLockPolicy policy{};
+
+    SECTION("Prefer reader policy")
+    {
+        policy = OsalRwLockPolicy::ePreferReader;
+    }
+
+    SECTION("Prefer writer policy")
+    {
+        policy = OsalRwLockPolicy::ePreferWriter;
+    }
+
+    SECTION("Fair policy")
+    {
+        policy = OsalRwLockPolicy::eFair;
+    }
+
+    OsalRwLock rwLock{};
+    auto error = osalRwLockCreate(&rwLock, policy);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalRwLockReadLock(&rwLock);
+    REQUIRE(error == OsalError::eOk);
+
+    auto reader = [&rwLock] {
+        auto error = osalRwLockReadTryLock(&rwLock);
+        if (error != OsalError::eOk)
+            REQUIRE(error == OsalError::eOk);
+
+        error = osalRwLockWriteTryLock(&rwLock);
+        if (error != OsalError::eLocked)
+            REQUIRE(error == OsalError::eLocked);
+
+        error = osalRwLockReadUnlock(&rwLock);
+        if (error != OsalError::eOk)
+            REQUIRE(error == OsalError::eOk);
+    };
+
+    {
+        osal::Thread thread(reader);
+    }
+
+    error = osalRwLockReadUnlock(&rwLock);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalRwLockWriteLock(&rwLock);
+    REQUIRE(error == OsalError::eOk);
+
+    auto writer = [&rwLock] {
+        auto error = osalRwLockReadTryLock(&rwLock);
+        if (error != OsalError::eLocked)
+            REQUIRE(error == OsalError::eLocked);
+
+        error = osalRwLockWriteTryLock(&rwLock);
+        if (error != OsalError::eLocked)
+            REQUIRE(error == OsalError::eLocked);
+    };
+
+    {
+        osal::Thread thread(writer);
+    }
+
+    error = osalRwLockWriteUnlock(&rwLock);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalRwLockDestroy(&rwLock);
+    REQUIRE(error == OsalError::eOk);
+}
+
+TEST_CASE("RwLock timed lock called from second thread", "[unit][c][rwlock]")
+{
+    OsalRwLockPolicy policy{};
+
+    SECTION("Prefer reader policy")
+    {
+        policy = OsalRwLockPolicy::ePreferReader;
+    }
+
+    SECTION("Prefer writer policy")
+    {
+        policy = OsalRwLockPolicy::ePreferWriter;
+    }
+
+    SECTION("Fair policy")
+    {
+        policy = OsalRwLockPolicy::eFair;
+    }
+
+    OsalRwLock rwLock{};
+    auto error = osalRwLockCreate(&rwLock, policy);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalRwLockWriteLock(&rwLock);
+    REQUIRE(error == OsalError::eOk);
+
+    auto func = [&rwLock] {
+        auto start = osal::timestamp();
+
+        constexpr std::uint32_t cTimeoutMs = 100;
+        auto error = osalRwLockReadTimedLock(&rwLock, cTimeoutMs);
+        if (error != OsalError::eTimeout)
+            REQUIRE(error == OsalError::eTimeout);
+
+        error = osalRwLockWriteTimedLock(&rwLock, cTimeoutMs);
+        if (error != OsalError::eTimeout)
+            REQUIRE(error == OsalError::eTimeout);
+
+        auto end = osal::timestamp();
+        if ((end - start) < 200ms)
+            REQUIRE((end - start) >= 200ms);
+
+        auto deadlineNs = osalTimestampNs() + osalMsToNs(500);
+        error = osalRwLockReadTimedLockUntil(&rwLock, deadlineNs);
+        if (error != OsalError::eOk)
+            REQUIRE(error == OsalError::eOk);
+
+        error = osalRwLockReadUnlock(&rwLock);
+        if (error != OsalError::eOk)
+            REQUIRE(error == OsalError::eOk);
+    };
+
+    osal::Thread thread(func);
+    osal::sleep(300ms);
+
+    error = osalRwLockWriteUnlock(&rwLock);
+    REQUIRE(error == OsalError::eOk);
+
+    thread.join();
+
+    error = osalRwLockWriteTimedLockUntil(&rwLock, osalTimestampNs());
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalRwLockWriteUnlock(&rwLock);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalRwLockDestroy(&rwLock);
+    REQUIRE(error == OsalError::eOk);
+}
+
+TEST_CASE("Waiting writer blocks new readers", "[unit][c][rwlock]")
+{
+    OsalRwLockPolicy policy{};
+
+    SECTION("Prefer writer policy")
+    {
+        policy = OsalRwLockPolicy::ePreferWriter;
+    }
+
+    SECTION("Fair policy")
+    {
+        policy = OsalRwLockPolicy::eFair;
+    }
+
+    OsalRwLock rwLock{};
+    auto error = osalRwLockCreate(&rwLock, policy);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalRwLockReadLock(&rwLock);
+    REQUIRE(error == OsalError::eOk);
+
+    std::atomic_bool writerLocked{};
+    auto writer = [&rwLock, &writerLocked] {
+        auto error = osalRwLockWriteLock(&rwLock);
+        if (error != OsalError::eOk)
+            REQUIRE(error == OsalError::eOk);
+
+        writerLocked = true;
+        error = osalRwLockWriteUnlock(&rwLock);
+        if (error != OsalError::eOk)
+            REQUIRE(error == OsalError::eOk);
+    };
+
+    osal::Thread writerThread(writer);
+    osal::sleep(100ms);
+
+    auto reader = [&rwLock] {
+        auto error = osalRwLockReadTryLock(&rwLock);
+        if (error != OsalError::eLocked)
+            REQUIRE(error == OsalError::eLocked);
+    };
+
+    {
+        osal::Thread readerThread(reader);
+    }
+
+    REQUIRE(!writerLocked);
+
+    error = osalRwLockReadUnlock(&rwLock);
+    REQUIRE(error == OsalError::eOk);
+
+    writerThread.join();
+    REQUIRE(writerLocked);
+
+    error = osalRwLockDestroy(&rwLock);
+    REQUIRE(error == OsalError::eOk);
+}
+
+TEST_CASE("RwLock used from many threads", "[unit][c][rwlock]")
+{
+    OsalRwLockPolicy policy{};
+
+    SECTION("Prefer reader policy")
+    {
+        policy = OsalRwLockPolicy::ePreferReader;
+    }
+
+    SECTION("Prefer writer policy")
+    {
+        policy = OsalRwLockPolicy::ePreferWriter;
+    }
+
+    SECTION("Fair policy")
+    {
+        policy = OsalRwLockPolicy::eFair;
+    }
+
+    OsalRwLock rwLock{};
+    auto error = osalRwLockCreate(&rwLock, policy);
+    REQUIRE(error == OsalError::eOk);
+
+    constexpr int cIterations = 2000;
+    int value1{};
+    int value2{};
+    std::atomic_int mismatches{};
+
+    auto writer = [&] {
+        for (int i = 0; i < cIterations; ++i) {
+            osalRwLockWriteLock(&rwLock);
+            ++value1;
+            ++value2;
+            osalRwLockWriteUnlock(&rwLock);
+        }
+    };
+
+    auto reader = [&] {
+        for (int i = 0; i < cIterations; ++i) {
+            osalRwLockReadLock(&rwLock);
+            if (value1 != value2)
+                ++mismatches;
+
+            osalRwLockReadUnlock(&rwLock);
+        }
+    };
+
+    {
+        osal::Thread writer1(writer);
+        osal::Thread reader1(reader);
+        osal::Thread reader2(reader);
+        osal::Thread writer2(writer);
+        osal::Thread reader3(reader);
+    }
+
+    REQUIRE(value1 == 2 * cIterations);
+    REQUIRE(value2 == 2 * cIterations);
+    REQUIRE(mismatches == 0);
+
+    error = osalRwLockDestroy(&rwLock);
+    REQUIRE(error == OsalError::eOk);
+}
@@ -31,13 +31,18 @@
 /////////////////////////////////////////////////////////////////////////////////////
 
 #include <osal/Error.hpp>
+#include <osal/Lockable.hpp>
 #include <osal/Mutex.hpp>
 #include <osal/ScopedLock.hpp>
+#include <osal/SpinLock.hpp>
 #include <osal/Thread.hpp>
 #include <osal/sleep.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <atomic>
+#include <mutex>
+
 TEST_CASE("Create and destroy lock", "[unit][cpp][mutex]")
 {
     osal::Mutex mutex;
@@ -117,3 +122,163 @@ TEST_CASE("Non-recursive success waitLock() thread with ScopedLock in C++", "[un
     REQUIRE(!error);
     REQUIRE(!threadError);
 }
+
+TEST_CASE("Lock multiple mutexes with ScopedLock", "[unit][cpp][mutex]")
+{
+    osal::Mutex mutex1;
+    osal::Mutex mutex2;
+    osal::Mutex mutex3;
+
+    {
+        osal::ScopedLock lock(mutex1, mutex2, mutex3);
+        bool locked = lock;
+        REQUIRE(locked);
+
+        REQUIRE(mutex1.tryLock() == OsalError::eLocked);
+        REQUIRE(mutex2.tryLock() == OsalError::eLocked);
+        REQUIRE(mutex3.tryLock() == OsalError::eLocked);
+    }
+
+    REQUIRE(!mutex1.tryLock());
+    REQUIRE(!mutex2.tryLock());
+    REQUIRE(!mutex3.tryLock());
+    REQUIRE(!mutex1.unlock());
+    REQUIRE(!mutex2.unlock());
+    REQUIRE(!mutex3.unlock());
+}
+
+TEST_CASE("Lock mutex and spinlock with ScopedLock", "[unit][cpp][mutex]")
+{
+    osal::Mutex mutex;
+    osal::SpinLock spinLock;
+
+    {
+        osal::ScopedLock lock(mutex, spinLock);
+        bool locked = lock;
+        REQUIRE(locked);
+
+        REQUIRE(mutex.tryLock() == OsalError::eLocked);
+        REQUIRE(spinLock.tryLock() == OsalError::eLocked);
+    }
+
+    REQUIRE(!spinLock.tryLock());
+    REQUIRE(!spinLock.unlock());
+}
+
+TEST_CASE("Lock multiple mutexes with ScopedLock and timeout", "[unit][cpp][mutex]")
+{
+    osal::Mutex mutex1;
+    osal::Mutex mutex2;
+
+    {
+        osal::ScopedLock lock(mutex1, mutex2, 100ms);
+        bool locked = lock;
+        REQUIRE(locked);
+    }
+
+    auto error = mutex2.lock();
+    REQUIRE(!error);
+
+    osal::Thread thread;
+    thread.start([&] {
+        auto start = osal::timestamp();
+        osal::ScopedLock lock(mutex1, mutex2, 100ms);
+        auto elapsed = osal::timestamp() - start;
+        bool locked = lock;
+        if (locked)
+            REQUIRE(!locked);
+
+        if (elapsed < 100ms)
+            REQUIRE(elapsed >= 100ms);
+
+        // Back-off must leave the free mutex unlocked.
+        error = mutex1.tryLock();
+        if (!error)
+            error = mutex1.unlock();
+    });
+
+    error = thread.join();
+    REQUIRE(!error);
+    REQUIRE(!mutex2.unlock());
+}
+
+TEST_CASE("Lock multiple mutexes with ScopedLock in opposite order from two threads", "[unit][cpp][mutex]")
+{
+    constexpr int cIterations = 1000;
+    osal::Mutex mutex1;
+    osal::Mutex mutex2;
+    int counter{};
+    std::atomic_int failures{};
+
+    auto func = [&](osal::Mutex& first, osal::Mutex& second) {
+        for (int i = 0; i < cIterations; ++i) {
+            osal::ScopedLock lock(first, second);
+            if (!lock) {
+                ++failures;
+                continue;
+            }
+
+            ++counter;
+        }
+    };
+
+    osal::Thread thread1;
+    osal::Thread thread2;
+    auto error = thread1.start(func, std::ref(mutex1), std::ref(mutex2));
+    REQUIRE(!error);
+    error = thread2.start(func, std::ref(mutex2), std::ref(mutex1));
+    REQUIRE(!error);
+
+    error = thread1.join();
+    REQUIRE(!error);
+    error = thread2.join();
+    REQUIRE(!error);
+
+    REQUIRE(failures == 0);
+    REQUIRE(counter == 2 * cIterations);
+}
+
+TEST_CASE("Use OSAL mutexes with std algorithms via lockable adapters", "[unit][cpp][mutex]")
+{
+    osal::Mutex mutex1;
+    osal::Mutex mutex2;
+    osal::LockableAdapter adapter1(mutex1);
+    osal::TimedLockableAdapter adapter2(mutex2);
+
+    SECTION("std::scoped_lock")
+    {
+        {
+            std::scoped_lock lock(adapter1, adapter2);
+            REQUIRE(mutex1.tryLock() == OsalError::eLocked);
+            REQUIRE(mutex2.tryLock() == OsalError::eLocked);
+        }
+
+        REQUIRE(adapter1.try_lock());
+        adapter1.unlock();
+    }
+
+    SECTION("std::lock")
+    {
+        std::lock(adapter1, adapter2);
+        REQUIRE(mutex1.tryLock() == OsalError::eLocked);
+        REQUIRE(mutex2.tryLock() == OsalError::eLocked);
+        adapter1.unlock();
+        adapter2.unlock();
+    }
+
+    SECTION("std::unique_lock with timeout")
+    {
+        REQUIRE(!mutex2.lock());
+
+        {
+            std::unique_lock lock(adapter2, std::defer_lock);
+            REQUIRE(!lock.try_lock_for(50ms));
+            REQUIRE(!lock.try_lock_until(std::chrono::steady_clock::now() + 50ms));
+        }
+
+        REQUIRE(!mutex2.unlock());
+
+        std::unique_lock lock(adapter2, 50ms);
+        REQUIRE(lock.owns_lock());
+    }
+}
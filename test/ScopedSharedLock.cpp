@@ -0,0 +1,90 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#include <osal/Error.hpp>
+#include <osal/ScopedSharedLock.hpp>
+#include <osal/SharedMutex.hpp>
+#include <osal/Thread.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("Create and destroy shared lock", "[unit][cpp][rwlock]")
+{
+    osal::SharedMutex mutex;
+
+    {
+        osal::ScopedSharedLock lock1(mutex);
+        osal::ScopedSharedLock lock2(mutex);
+        bool locked = lock1 && lock2;
+        bool acquired = lock1.isAcquired() && lock2.isAcquired();
+
+        REQUIRE(locked);
+        REQUIRE(acquired);
+
+        auto error = mutex.tryLock();
+        REQUIRE(error == OsalError::eLocked);
+    }
+
+    auto error = mutex.tryLock();
+    REQUIRE(!error);
+
+    error = mutex.unlock();
+    REQUIRE(!error);
+}
+
+TEST_CASE("Create shared lock with timeout", "[unit][cpp][rwlock]")
+{
+    osal::SharedMutex mutex;
+
+    {
+        osal::ScopedSharedLock lock(mutex, 100ms);
+        bool locked = lock;
+        REQUIRE(locked);
+    }
+
+    auto error = mutex.lock();
+    REQUIRE(!error);
+
+    auto func = [&mutex] {
+        osal::ScopedSharedLock lock(mutex, 100ms);
+        bool locked = lock;
+        if (locked)
+            REQUIRE(!locked);
+    };
+
+    {
+        osal::Thread thread(func);
+    }
+
+    error = mutex.unlock();
+    REQUIRE(!error);
+}
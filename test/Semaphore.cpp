@@ -34,10 +34,24 @@
 #include <osal/Semaphore.h>
 #include <osal/Thread.hpp>
 #include <osal/sleep.hpp>
+#include <osal/timestamp.h>
 #include <osal/timestamp.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <array>
+#include <atomic>
+#include <climits>
+#include <cstddef>
+#include <memory>
+
+#ifdef __linux__
+    #include <sys/epoll.h>
+    #include <sys/mman.h>
+    #include <sys/wait.h>
+    #include <unistd.h>
+#endif
+
 TEST_CASE("Semaphore creation and destruction", "[unit][c][semaphore]")
 {
     unsigned int initialValue{};
@@ -124,6 +138,9 @@ TEST_CASE("Invalid arguments passed to semaphore functions in one thread", "[uni
     error = osalSemaphoreTimedWait(nullptr, 3);
     REQUIRE(error == OsalError::eInvalidArgument);
 
+    error = osalSemaphoreTimedWaitUntil(nullptr, osalTimestampNs());
+    REQUIRE(error == OsalError::eInvalidArgument);
+
     error = osalSemaphoreSignal(nullptr);
     REQUIRE(error == OsalError::eInvalidArgument);
 
@@ -491,3 +508,433 @@ TEST_CASE("TimedWait called from second thread, success", "[unit][c][semaphore]"
     error = osalSemaphoreDestroy(&semaphore);
     REQUIRE(error == OsalError::eOk);
 }
+
+TEST_CASE("TimedWaitUntil called from second thread", "[unit][c][semaphore]")
+{
+    OsalSemaphore semaphore{};
+    auto error = osalSemaphoreCreate(&semaphore, 0);
+    REQUIRE(error == OsalError::eOk);
+
+    auto func = [&semaphore] {
+        constexpr std::uint64_t cTimeoutMs = 100;
+        auto deadlineNs = osalTimestampNs() + osalMsToNs(cTimeoutMs);
+
+        auto error = osalSemaphoreTimedWaitUntil(&semaphore, deadlineNs);
+        if (error != OsalError::eTimeout)
+            REQUIRE(error == OsalError::eTimeout);
+
+        if (osalTimestampNs() < deadlineNs)
+            REQUIRE(osalTimestampNs() >= deadlineNs);
+
+        // Deadline from the past should behave like tryWait().
+        error = osalSemaphoreTimedWaitUntil(&semaphore, 0);
+        if (error != OsalError::eTimeout)
+            REQUIRE(error == OsalError::eTimeout);
+
+        deadlineNs = osalTimestampNs() + osalMsToNs(cTimeoutMs);
+        error = osalSemaphoreTimedWaitUntil(&semaphore, deadlineNs);
+        if (error != OsalError::eOk)
+            REQUIRE(error == OsalError::eOk);
+
+        if (osalTimestampNs() > deadlineNs)
+            REQUIRE(osalTimestampNs() <= deadlineNs);
+    };
+
+    osal::Thread thread(func);
+    osal::sleep(150ms);
+
+    error = osalSemaphoreSignal(&semaphore);
+    REQUIRE(error == OsalError::eOk);
+
+    thread.join();
+
+    error = osalSemaphoreDestroy(&semaphore);
+    REQUIRE(error == OsalError::eOk);
+}
+
+TEST_CASE("Wait and signal many tokens from one thread", "[unit][c][semaphore]")
+{
+    constexpr unsigned int cBatchSize = 64;
+
+    OsalSemaphore semaphore{};
+    auto error = osalSemaphoreCreate(&semaphore, 0);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalSemaphoreSignalMany(&semaphore, cBatchSize);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalSemaphoreTryWaitMany(&semaphore, cBatchSize + 1);
+    REQUIRE(error == OsalError::eLocked);
+
+    error = osalSemaphoreTimedWaitMany(&semaphore, cBatchSize + 1, 10);
+    REQUIRE(error == OsalError::eTimeout);
+
+    error = osalSemaphoreTryWaitMany(&semaphore, cBatchSize / 2);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalSemaphoreWaitMany(&semaphore, cBatchSize / 2 - 1);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalSemaphoreTimedWaitManyUntil(&semaphore, 1, osalTimestampNs());
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalSemaphoreTryWait(&semaphore);
+    REQUIRE(error == OsalError::eLocked);
+
+    error = osalSemaphoreWaitMany(&semaphore, 0);
+    REQUIRE(error == OsalError::eInvalidArgument);
+    error = osalSemaphoreTryWaitMany(&semaphore, 0);
+    REQUIRE(error == OsalError::eInvalidArgument);
+    error = osalSemaphoreTimedWaitMany(&semaphore, 0, 10);
+    REQUIRE(error == OsalError::eInvalidArgument);
+    error = osalSemaphoreSignalMany(&semaphore, 0);
+    REQUIRE(error == OsalError::eInvalidArgument);
+    error = osalSemaphoreSignalMany(nullptr, 1);
+    REQUIRE(error == OsalError::eInvalidArgument);
+    error = osalSemaphoreWaitMany(nullptr, 1);
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    error = osalSemaphoreDestroy(&semaphore);
+    REQUIRE(error == OsalError::eOk);
+}
+
+#ifdef __linux__
+TEST_CASE("SignalMany beyond the maximal semaphore value", "[unit][c][semaphore]")
+{
+    constexpr unsigned int cMaxValue = (1U << 30U) - 1;
+
+    OsalSemaphore semaphore{};
+    auto error = osalSemaphoreCreate(&semaphore, 1);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalSemaphoreSignalMany(&semaphore, UINT_MAX);
+    REQUIRE(error == OsalError::eOsError);
+
+    error = osalSemaphoreSignalMany(&semaphore, cMaxValue);
+    REQUIRE(error == OsalError::eOsError);
+
+    error = osalSemaphoreSignalMany(&semaphore, cMaxValue - 1);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalSemaphoreSignal(&semaphore);
+    REQUIRE(error == OsalError::eOsError);
+
+    // Failed signals must leave the value and the waiters flags untouched.
+    error = osalSemaphoreTryWaitMany(&semaphore, cMaxValue);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalSemaphoreTryWait(&semaphore);
+    REQUIRE(error == OsalError::eLocked);
+
+    error = osalSemaphoreDestroy(&semaphore);
+    REQUIRE(error == OsalError::eOk);
+}
+#endif
+
+TEST_CASE("WaitMany called from second thread", "[unit][c][semaphore]")
+{
+    constexpr unsigned int cCount = 3;
+
+    OsalSemaphore semaphore{};
+    auto error = osalSemaphoreCreate(&semaphore, 0);
+    REQUIRE(error == OsalError::eOk);
+
+    std::atomic_bool acquired{};
+    auto func = [&] {
+        auto error = osalSemaphoreWaitMany(&semaphore, cCount);
+        if (error != OsalError::eOk)
+            REQUIRE(error == OsalError::eOk);
+
+        acquired = true;
+    };
+
+    osal::Thread thread(func);
+
+    for (unsigned int i = 0; i < cCount - 1; ++i) {
+        error = osalSemaphoreSignal(&semaphore);
+        REQUIRE(error == OsalError::eOk);
+        osal::sleep(20ms);
+        REQUIRE(!acquired);
+    }
+
+    error = osalSemaphoreSignal(&semaphore);
+    REQUIRE(error == OsalError::eOk);
+
+    thread.join();
+    REQUIRE(acquired);
+
+    error = osalSemaphoreTryWait(&semaphore);
+    REQUIRE(error == OsalError::eLocked);
+
+    error = osalSemaphoreDestroy(&semaphore);
+    REQUIRE(error == OsalError::eOk);
+}
+
+TEST_CASE("SignalMany wakes many waiting threads", "[unit][c][semaphore]")
+{
+    constexpr unsigned int cThreadsCount = 8;
+    constexpr unsigned int cTokensPerThread = 8;
+
+    OsalSemaphore semaphore{};
+    auto error = osalSemaphoreCreate(&semaphore, 0);
+    REQUIRE(error == OsalError::eOk);
+
+    std::atomic_uint acquired{};
+    auto func = [&] {
+        for (unsigned int i = 0; i < cTokensPerThread; ++i) {
+            auto error = osalSemaphoreTimedWait(&semaphore, 1000);
+            if (error != OsalError::eOk)
+                REQUIRE(error == OsalError::eOk);
+
+            ++acquired;
+        }
+    };
+
+    std::array<osal::Thread<>, cThreadsCount> threads;
+    for (auto& thread : threads) {
+        auto startError = thread.start(func);
+        REQUIRE(!startError);
+    }
+
+    osal::sleep(50ms);
+    error = osalSemaphoreSignalMany(&semaphore, cThreadsCount * cTokensPerThread);
+    REQUIRE(error == OsalError::eOk);
+
+    for (auto& thread : threads)
+        thread.join();
+
+    REQUIRE(acquired == cThreadsCount * cTokensPerThread);
+
+    error = osalSemaphoreDestroy(&semaphore);
+    REQUIRE(error == OsalError::eOk);
+}
+
+TEST_CASE("Single-token and batch waiters share released tokens", "[unit][c][semaphore]")
+{
+    constexpr unsigned int cBatchSize = 3;
+
+    OsalSemaphore semaphore{};
+    auto error = osalSemaphoreCreate(&semaphore, 0);
+    REQUIRE(error == OsalError::eOk);
+
+    std::atomic_uint acquired{};
+    auto single = [&] {
+        auto error = osalSemaphoreTimedWait(&semaphore, 1000);
+        if (error != OsalError::eOk)
+            REQUIRE(error == OsalError::eOk);
+
+        ++acquired;
+    };
+
+    auto batch = [&] {
+        auto error = osalSemaphoreTimedWaitMany(&semaphore, cBatchSize, 1000);
+        if (error != OsalError::eOk)
+            REQUIRE(error == OsalError::eOk);
+
+        acquired += cBatchSize;
+    };
+
+    osal::Thread singleThread(single);
+    osal::Thread batchThread(batch);
+    osal::sleep(20ms);
+
+    // First token goes to the single-token waiter, remaining ones are left for the batch waiter.
+    error = osalSemaphoreSignal(&semaphore);
+    REQUIRE(error == OsalError::eOk);
+    singleThread.join();
+    REQUIRE(acquired == 1);
+
+    error = osalSemaphoreSignalMany(&semaphore, cBatchSize);
+    REQUIRE(error == OsalError::eOk);
+    batchThread.join();
+    REQUIRE(acquired == 1 + cBatchSize);
+
+    error = osalSemaphoreDestroy(&semaphore);
+    REQUIRE(error == OsalError::eOk);
+}
+
+TEST_CASE("Semaphore destroyed right after wait returns", "[unit][c][semaphore]")
+{
+    constexpr int cIterations = 1000;
+
+    for (int i = 0; i < cIterations; ++i) {
+        auto semaphore = std::make_unique<OsalSemaphore>();
+        auto error = osalSemaphoreCreate(semaphore.get(), 0);
+        REQUIRE(error == OsalError::eOk);
+
+        osal::Thread thread([&semaphore] { osalSemaphoreSignal(semaphore.get()); });
+
+        // Signaling thread may still be inside osalSemaphoreSignal(), when the semaphore is released.
+        error = osalSemaphoreWait(semaphore.get());
+        REQUIRE(error == OsalError::eOk);
+        error = osalSemaphoreDestroy(semaphore.get());
+        REQUIRE(error == OsalError::eOk);
+        semaphore.reset();
+
+        thread.join();
+    }
+}
+
+TEST_CASE("Process-shared semaphore", "[unit][c][semaphore]")
+{
+    OsalSemaphore semaphore{};
+    auto error = osalSemaphoreCreateShared(&semaphore, 1);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalSemaphoreTryWait(&semaphore);
+    REQUIRE(error == OsalError::eOk);
+    error = osalSemaphoreTryWait(&semaphore);
+    REQUIRE(error == OsalError::eLocked);
+
+    error = osalSemaphoreSignal(&semaphore);
+    REQUIRE(error == OsalError::eOk);
+    error = osalSemaphoreWait(&semaphore);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalSemaphoreDestroy(&semaphore);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalSemaphoreCreateShared(nullptr, 0);
+    REQUIRE(error == OsalError::eInvalidArgument);
+}
+
+#ifdef __linux__
+TEST_CASE("Process-shared semaphore used by two processes", "[unit][c][semaphore]")
+{
+    constexpr int cIterations = 100;
+    constexpr std::size_t cSize = 2 * sizeof(OsalSemaphore);
+
+    auto* memory = mmap(nullptr, cSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    REQUIRE(memory != MAP_FAILED);
+
+    auto* ping = static_cast<OsalSemaphore*>(memory);
+    auto* pong = ping + 1;
+    REQUIRE(osalSemaphoreCreateShared(ping, 0) == OsalError::eOk);
+    REQUIRE(osalSemaphoreCreateShared(pong, 0) == OsalError::eOk);
+
+    auto pid = fork();
+    REQUIRE(pid != -1);
+    if (pid == 0) {
+        for (int i = 0; i < cIterations; ++i) {
+            if (osalSemaphoreTimedWait(ping, 1000) != OsalError::eOk || osalSemaphoreSignal(pong) != OsalError::eOk)
+                _exit(1);
+        }
+
+        _exit(0);
+    }
+
+    for (int i = 0; i < cIterations; ++i) {
+        REQUIRE(osalSemaphoreSignal(ping) == OsalError::eOk);
+        REQUIRE(osalSemaphoreTimedWait(pong, 1000) == OsalError::eOk);
+    }
+
+    int status{};
+    REQUIRE(waitpid(pid, &status, 0) == pid);
+    REQUIRE(WIFEXITED(status));
+    REQUIRE(WEXITSTATUS(status) == 0);
+
+    REQUIRE(osalSemaphoreDestroy(ping) == OsalError::eOk);
+    REQUIRE(osalSemaphoreDestroy(pong) == OsalError::eOk);
+    munmap(memory, cSize);
+}
+#endif
+
+#ifdef __linux__
+TEST_CASE("Pollable semaphore", "[unit][c][semaphore]")
+{
+    OsalSemaphore semaphore{};
+    auto error = osalSemaphoreCreateEx(&semaphore, 2, OsalSemaphoreType::ePollable);
+    REQUIRE(error == OsalError::eOk);
+
+    // Eventfd can't take many tokens at once.
+    error = osalSemaphoreTryWaitMany(&semaphore, 2);
+    REQUIRE(error == OsalError::eInvalidArgument);
+    error = osalSemaphoreWaitMany(&semaphore, 2);
+    REQUIRE(error == OsalError::eInvalidArgument);
+    error = osalSemaphoreTimedWaitMany(&semaphore, 2, 10);
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    error = osalSemaphoreWait(&semaphore);
+    REQUIRE(error == OsalError::eOk);
+    error = osalSemaphoreTryWait(&semaphore);
+    REQUIRE(error == OsalError::eOk);
+    error = osalSemaphoreTryWait(&semaphore);
+    REQUIRE(error == OsalError::eLocked);
+
+    auto start = osalTimestampNs();
+    error = osalSemaphoreTimedWait(&semaphore, 50);
+    REQUIRE(error == OsalError::eTimeout);
+    REQUIRE(osalTimestampNs() - start >= osalMsToNs(50));
+
+    error = osalSemaphoreSignalMany(&semaphore, 4);
+    REQUIRE(error == OsalError::eOk);
+    for (int i = 0; i < 4; ++i) {
+        error = osalSemaphoreTryWaitMany(&semaphore, 1);
+        REQUIRE(error == OsalError::eOk);
+    }
+
+    error = osalSemaphoreTryWait(&semaphore);
+    REQUIRE(error == OsalError::eLocked);
+
+    error = osalSemaphoreDestroy(&semaphore);
+    REQUIRE(error == OsalError::eOk);
+}
+
+TEST_CASE("Pollable semaphore waited in epoll together with other descriptors", "[unit][c][semaphore]")
+{
+    OsalSemaphore semaphore{};
+    auto error = osalSemaphoreCreateEx(&semaphore, 0, OsalSemaphoreType::ePollable);
+    REQUIRE(error == OsalError::eOk);
+
+    int handle{};
+    error = osalSemaphoreNativeHandle(&semaphore, &handle);
+    REQUIRE(error == OsalError::eOk);
+    REQUIRE(handle >= 0);
+
+    std::array<int, 2> pipeFds{};
+    REQUIRE(pipe(pipeFds.data()) == 0);
+
+    auto epollFd = epoll_create1(0);
+    REQUIRE(epollFd >= 0);
+
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.fd = handle;
+    REQUIRE(epoll_ctl(epollFd, EPOLL_CTL_ADD, handle, &event) == 0);
+    event.data.fd = pipeFds[0];
+    REQUIRE(epoll_ctl(epollFd, EPOLL_CTL_ADD, pipeFds[0], &event) == 0);
+
+    REQUIRE(epoll_wait(epollFd, &event, 1, 0) == 0);
+
+    osal::Thread thread([&semaphore] {
+        osal::sleep(50ms);
+        auto error = osalSemaphoreSignal(&semaphore);
+        if (error != OsalError::eOk)
+            REQUIRE(error == OsalError::eOk);
+    });
+
+    REQUIRE(epoll_wait(epollFd, &event, 1, 1000) == 1);
+    REQUIRE(event.data.fd == handle);
+
+    error = osalSemaphoreTryWait(&semaphore);
+    REQUIRE(error == OsalError::eOk);
+    REQUIRE(epoll_wait(epollFd, &event, 1, 0) == 0);
+
+    thread.join();
+
+    close(epollFd);
+    close(pipeFds[0]);
+    close(pipeFds[1]);
+
+    OsalSemaphore standard{};
+    error = osalSemaphoreCreate(&standard, 0);
+    REQUIRE(error == OsalError::eOk);
+    error = osalSemaphoreNativeHandle(&standard, &handle);
+    REQUIRE(error == OsalError::eInvalidArgument);
+    error = osalSemaphoreNativeHandle(&semaphore, nullptr);
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    REQUIRE(osalSemaphoreDestroy(&standard) == OsalError::eOk);
+    REQUIRE(osalSemaphoreDestroy(&semaphore) == OsalError::eOk);
+}
+#endif
@@ -417,3 +417,66 @@ TEST_CASE("Timeout used with semaphores", "[unit][cpp][semaphore]")
     REQUIRE(error == OsalError::eTimeout);
     REQUIRE(timeout.isExpired());
 }
+
+TEST_CASE("Wait and signal many tokens in C++", "[unit][cpp][semaphore]")
+{
+    osal::Semaphore semaphore(0);
+
+    auto func = [&semaphore] {
+        if (auto error = semaphore.timedWait(4, 500ms))
+            REQUIRE(!error);
+
+        if (auto error = semaphore.signal(2))
+            REQUIRE(!error);
+    };
+
+    osal::Thread thread(func);
+
+    auto error = semaphore.signal(3);
+    REQUIRE(!error);
+    osal::sleep(50ms);
+
+    error = semaphore.tryWait(3);
+    REQUIRE(!error);
+    error = semaphore.signal(4);
+    REQUIRE(!error);
+
+    thread.join();
+
+    error = semaphore.wait(2);
+    REQUIRE(!error);
+
+    error = semaphore.tryWait(1);
+    REQUIRE(error == OsalError::eLocked);
+
+    error = semaphore.timedWait(1, 50ms);
+    REQUIRE(error == OsalError::eTimeout);
+}
+
+TEST_CASE("Pollable semaphore in C++", "[unit][cpp][semaphore]")
+{
+    osal::Semaphore semaphore(0, OsalSemaphoreType::ePollable);
+
+    int handle{};
+    auto error = semaphore.nativeHandle(handle);
+#ifdef __linux__
+    REQUIRE(!error);
+
+    auto func = [&semaphore] {
+        if (auto error = semaphore.timedWait(500ms))
+            REQUIRE(!error);
+    };
+
+    osal::Thread thread(func);
+    osal::sleep(50ms);
+
+    error = semaphore.signal();
+    REQUIRE(!error);
+    thread.join();
+
+    error = semaphore.tryWait();
+    REQUIRE(error == OsalError::eLocked);
+#else
+    REQUIRE(error == OsalError::eInvalidArgument);
+#endif
+}
@@ -0,0 +1,129 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#include <osal/Error.hpp>
+#include <osal/SeqLock.hpp>
+#include <osal/Thread.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+namespace {
+
+/// Helper type with fields, which are always written with the same value. This way torn reads can be detected.
+struct Sample {
+    std::uint64_t a;
+    std::uint64_t b;
+    std::uint32_t c;
+    std::uint8_t d;
+};
+
+} // namespace
+
+TEST_CASE("SeqLock store and load from one thread", "[unit][cpp][seqlock]")
+{
+    osal::SeqLock<int> seqLock;
+    REQUIRE(seqLock.load() == 0);
+
+    auto sequence = seqLock.sequence();
+    auto error = seqLock.store(5);
+    REQUIRE(!error);
+    REQUIRE(seqLock.load() == 5);
+    REQUIRE(seqLock.sequence() == sequence + 2);
+
+    error = seqLock.update([](int& value) { value *= 3; });
+    REQUIRE(!error);
+    REQUIRE(seqLock.load() == 15);
+
+    int value{};
+    REQUIRE(seqLock.tryLoad(value));
+    REQUIRE(value == 15);
+
+    osal::SeqLock<Sample> sampleLock(Sample{1, 1, 1, 1});
+    auto sample = sampleLock.load();
+    REQUIRE(sample.a == 1);
+    REQUIRE(sample.b == 1);
+    REQUIRE(sample.c == 1);
+    REQUIRE(sample.d == 1);
+}
+
+TEST_CASE("SeqLock readers under contention with writers", "[unit][cpp][seqlock]")
+{
+    constexpr std::uint32_t cWrites = 20000;
+    constexpr int cReads = 50000;
+
+    osal::SeqLock<Sample> seqLock;
+    std::atomic_int tornReads{};
+    std::atomic_bool decreased{};
+
+    auto writer = [&seqLock] {
+        for (std::uint32_t i = 0; i < cWrites; ++i) {
+            seqLock.update([](Sample& sample) {
+                auto next = sample.a + 1;
+                sample = Sample{next, next, static_cast<std::uint32_t>(next), static_cast<std::uint8_t>(next)};
+            });
+        }
+    };
+
+    auto reader = [&seqLock, &tornReads, &decreased] {
+        std::uint64_t last{};
+        for (int i = 0; i < cReads; ++i) {
+            auto sample = seqLock.load();
+            if (sample.a != sample.b || static_cast<std::uint32_t>(sample.a) != sample.c
+                || static_cast<std::uint8_t>(sample.a) != sample.d)
+                ++tornReads;
+
+            if (sample.a < last)
+                decreased = true;
+
+            last = sample.a;
+        }
+    };
+
+    {
+        osal::Thread writer1(writer);
+        osal::Thread reader1(reader);
+        osal::Thread reader2(reader);
+        osal::Thread writer2(writer);
+        osal::Thread reader3(reader);
+        osal::Thread reader4(reader);
+    }
+
+    REQUIRE(tornReads == 0);
+    REQUIRE(!decreased);
+
+    auto sample = seqLock.load();
+    REQUIRE(sample.a == 2 * cWrites);
+    REQUIRE(seqLock.sequence() % 2 == 0);
+}
@@ -0,0 +1,162 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#include <osal/Error.hpp>
+#include <osal/SharedMutex.hpp>
+#include <osal/Thread.hpp>
+#include <osal/sleep.hpp>
+#include <osal/timestamp.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <utility>
+
+TEST_CASE("SharedMutex creation and destruction in C++", "[unit][cpp][rwlock]")
+{
+    SECTION("Default policy")
+    {
+        osal::SharedMutex mutex;
+    }
+
+    SECTION("Prefer reader policy")
+    {
+        osal::SharedMutex mutex(OsalRwLockPolicy::ePreferReader);
+    }
+
+    SECTION("Prefer writer policy")
+    {
+        osal::SharedMutex mutex(OsalRwLockPolicy::ePreferWriter);
+    }
+
+    SECTION("Fair policy")
+    {
+        osal::SharedMutex mutex(OsalRwLockPolicy::eFair);
+    }
+}
+
+TEST_CASE("Moving SharedMutex around in C++", "[unit][cpp][rwlock]")
+{
+    osal::SharedMutex mutex1;
+    auto error = mutex1.lockShared();
+    REQUIRE(!error);
+
+    error = mutex1.unlockShared();
+    REQUIRE(!error);
+
+    osal::SharedMutex mutex2(std::move(mutex1));
+    error = mutex2.lock();
+    REQUIRE(!error);
+
+    error = mutex2.unlock();
+    REQUIRE(!error);
+
+    error = mutex1.lock();
+    REQUIRE(error == OsalError::eInvalidArgument);
+}
+
+TEST_CASE("Shared and exclusive locking from two threads in C++", "[unit][cpp][rwlock]")
+{
+    OsalRwLockPolicy policy{};
+
+    SECTION("Prefer reader policy")
+    {
+        policy = OsalRwLockPolicy::ePreferReader;
+    }
+
+    SECTION("Prefer writer policy")
+    {
+        policy = OsalRwLockPolicy::ePreferWriter;
+    }
+
+    SECTION("Fair policy")
+    {
+        policy = OsalRwLockPolicy::eFair;
+    }
+
+    osal::SharedMutex mutex(policy);
+    auto error = mutex.lockShared();
+    REQUIRE(!error);
+
+    auto reader = [&mutex] {
+        auto error = mutex.tryLockShared();
+        if (error)
+            REQUIRE(!error);
+
+        error = mutex.tryLock();
+        if (error != OsalError::eLocked)
+            REQUIRE(error == OsalError::eLocked);
+
+        error = mutex.timedLock(50ms);
+        if (error != OsalError::eTimeout)
+            REQUIRE(error == OsalError::eTimeout);
+
+        error = mutex.unlockShared();
+        if (error)
+            REQUIRE(!error);
+    };
+
+    {
+        osal::Thread thread(reader);
+    }
+
+    error = mutex.unlockShared();
+    REQUIRE(!error);
+
+    error = mutex.timedLock(osal::Timeout::infinity());
+    REQUIRE(!error);
+
+    auto writer = [&mutex] {
+        auto start = osal::timestamp();
+
+        auto error = mutex.timedLockShared(100ms);
+        if (error != OsalError::eTimeout)
+            REQUIRE(error == OsalError::eTimeout);
+
+        auto end = osal::timestamp();
+        if ((end - start) < 100ms)
+            REQUIRE((end - start) >= 100ms);
+
+        error = mutex.timedLockShared(500ms);
+        if (error)
+            REQUIRE(!error);
+
+        error = mutex.unlockShared();
+        if (error)
+            REQUIRE(!error);
+    };
+
+    osal::Thread thread(writer);
+    osal::sleep(200ms);
+
+    error = mutex.unlock();
+    REQUIRE(!error);
+}
@@ -0,0 +1,240 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#include <osal/Error.h>
+#include <osal/SpinLock.h>
+#include <osal/Thread.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <cstdint>
+
+TEST_CASE("SpinLock creation and destruction", "[unit][c][spinlock]")
+{
+    OsalSpinLockType type{};
+
+    SECTION("Ticket spinlock")
+    {
+        type = OsalSpinLockType::eTicket;
+    }
+
+    SECTION("MCS spinlock")
+    {
+        type = OsalSpinLockType::eMcs;
+    }
+
+    SECTION("Default spinlock")
+    {
+        type = cOsalSpinLockDefaultType;
+    }
+
+    OsalSpinLock spinLock{};
+    auto error = osalSpinLockCreate(&spinLock, type);
+    REQUIRE(error == OsalError::eOk);
+    REQUIRE(spinLock.initialized);
+
+    error = osalSpinLockDestroy(&spinLock);
+    REQUIRE(error == OsalError::eOk);
+    REQUIRE(!spinLock.initialized);
+}
+
+TEST_CASE("Invalid arguments passed to spinlock functions", "[unit][c][spinlock]")
+{
+    auto error = osalSpinLockCreate(nullptr, cOsalSpinLockDefaultType);
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    OsalSpinLock spinLock{};
+    error = osalSpinLockCreate(&spinLock, static_cast<OsalSpinLockType>(-1));
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    error = osalSpinLockDestroy(nullptr);
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    error = osalSpinLockDestroy(&spinLock);
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    error = osalSpinLockLock(nullptr);
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    error = osalSpinLockTryLock(nullptr);
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    error = osalSpinLockUnlock(nullptr);
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    error = osalSpinLockLockIsr(nullptr);
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    error = osalSpinLockTryLockIsr(nullptr);
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    error = osalSpinLockUnlockIsr(nullptr);
+    REQUIRE(error == OsalError::eInvalidArgument);
+}
+
+TEST_CASE("SpinLock lock and unlock from one thread", "[unit][c][spinlock]")
+{
+    OsalSpinLockType type{};
+
+    SECTION("Ticket spinlock")
+    {
+        type = OsalSpinLockType::eTicket;
+    }
+
+    SECTION("MCS spinlock")
+    {
+        type = OsalSpinLockType::eMcs;
+    }
+
+    OsalSpinLock spinLock{};
+    auto error = osalSpinLockCreate(&spinLock, type);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalSpinLockUnlock(&spinLock);
+    REQUIRE(error == OsalError::eNotLocked);
+
+    error = osalSpinLockLock(&spinLock);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalSpinLockTryLock(&spinLock);
+    REQUIRE(error == OsalError::eLocked);
+
+    error = osalSpinLockUnlock(&spinLock);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalSpinLockTryLock(&spinLock);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalSpinLockUnlock(&spinLock);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalSpinLockLockIsr(&spinLock);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalSpinLockTryLockIsr(&spinLock);
+    REQUIRE(error == OsalError::eLocked);
+
+    error = osalSpinLockUnlockIsr(&spinLock);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalSpinLockTryLockIsr(&spinLock);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalSpinLockUnlockIsr(&spinLock);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalSpinLockDestroy(&spinLock);
+    REQUIRE(error == OsalError::eOk);
+}
+
+TEST_CASE("Nested MCS spinlocks", "[unit][c][spinlock]")
+{
+    std::array<OsalSpinLock, cOsalSpinLockMaxNesting + 1> spinLocks{};
+    for (auto& spinLock : spinLocks) {
+        auto error = osalSpinLockCreate(&spinLock, OsalSpinLockType::eMcs);
+        REQUIRE(error == OsalError::eOk);
+    }
+
+    for (std::uint32_t i = 0; i < cOsalSpinLockMaxNesting; ++i) {
+        auto error = osalSpinLockLock(&spinLocks[i]);
+        REQUIRE(error == OsalError::eOk);
+    }
+
+    auto error = osalSpinLockLock(&spinLocks[cOsalSpinLockMaxNesting]);
+    REQUIRE(error == OsalError::eOsError);
+
+    // Unlock in the order different than locking to check, that nodes are returned to the pool correctly.
+    error = osalSpinLockUnlock(&spinLocks[1]);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalSpinLockLock(&spinLocks[cOsalSpinLockMaxNesting]);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalSpinLockUnlock(&spinLocks[cOsalSpinLockMaxNesting]);
+    REQUIRE(error == OsalError::eOk);
+
+    for (std::uint32_t i = 0; i < cOsalSpinLockMaxNesting; ++i) {
+        if (i == 1)
+            continue;
+
+        error = osalSpinLockUnlock(&spinLocks[i]);
+        REQUIRE(error == OsalError::eOk);
+    }
+
+    for (auto& spinLock : spinLocks) {
+        error = osalSpinLockDestroy(&spinLock);
+        REQUIRE(error == OsalError::eOk);
+    }
+}
+
+TEST_CASE("SpinLock used from many threads", "[unit][c][spinlock]")
+{
+    OsalSpinLockType type{};
+
+    SECTION("Ticket spinlock")
+    {
+        type = OsalSpinLockType::eTicket;
+    }
+
+    SECTION("MCS spinlock")
+    {
+        type = OsalSpinLockType::eMcs;
+    }
+
+    OsalSpinLock spinLock{};
+    auto error = osalSpinLockCreate(&spinLock, type);
+    REQUIRE(error == OsalError::eOk);
+
+    constexpr int cIterations = 20000;
+    int counter{};
+
+    auto func = [&spinLock, &counter] {
+        for (int i = 0; i < cIterations; ++i) {
+            osalSpinLockLock(&spinLock);
+            ++counter;
+            osalSpinLockUnlock(&spinLock);
+        }
+    };
+
+    {
+        osal::Thread thread1(func);
+        osal::Thread thread2(func);
+        osal::Thread thread3(func);
+        osal::Thread thread4(func);
+    }
+
+    REQUIRE(counter == 4 * cIterations);
+
+    error = osalSpinLockDestroy(&spinLock);
+    REQUIRE(error == OsalError::eOk);
+}
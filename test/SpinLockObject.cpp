@@ -0,0 +1,124 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#include <osal/Error.hpp>
+#include <osal/ScopedSpinLock.hpp>
+#include <osal/SpinLock.hpp>
+#include <osal/Thread.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <utility>
+
+TEST_CASE("SpinLock creation and destruction in C++", "[unit][cpp][spinlock]")
+{
+    SECTION("Default spinlock")
+    {
+        osal::SpinLock spinLock;
+    }
+
+    SECTION("Ticket spinlock")
+    {
+        osal::SpinLock spinLock(OsalSpinLockType::eTicket);
+    }
+
+    SECTION("MCS spinlock")
+    {
+        osal::SpinLock spinLock(OsalSpinLockType::eMcs);
+    }
+}
+
+TEST_CASE("Moving SpinLock around in C++", "[unit][cpp][spinlock]")
+{
+    osal::SpinLock spinLock1;
+    osal::SpinLock spinLock2(std::move(spinLock1));
+
+    auto error = spinLock2.lock();
+    REQUIRE(!error);
+
+    error = spinLock2.unlock();
+    REQUIRE(!error);
+
+    error = spinLock1.lock();
+    REQUIRE(error == OsalError::eInvalidArgument);
+}
+
+TEST_CASE("SpinLock used with ScopedSpinLock from many threads in C++", "[unit][cpp][spinlock]")
+{
+    OsalSpinLockType type{};
+
+    SECTION("Ticket spinlock")
+    {
+        type = OsalSpinLockType::eTicket;
+    }
+
+    SECTION("MCS spinlock")
+    {
+        type = OsalSpinLockType::eMcs;
+    }
+
+    osal::SpinLock spinLock(type);
+
+    {
+        osal::ScopedSpinLock lock(spinLock);
+        bool locked = lock;
+        REQUIRE(locked);
+        REQUIRE(lock.isAcquired());
+
+        auto error = spinLock.tryLock();
+        REQUIRE(error == OsalError::eLocked);
+    }
+
+    auto error = spinLock.tryLockIsr();
+    REQUIRE(!error);
+
+    error = spinLock.unlockIsr();
+    REQUIRE(!error);
+
+    constexpr int cIterations = 20000;
+    int counter{};
+
+    auto func = [&spinLock, &counter] {
+        for (int i = 0; i < cIterations; ++i) {
+            osal::ScopedSpinLock lock(spinLock);
+            ++counter;
+        }
+    };
+
+    {
+        osal::Thread thread1(func);
+        osal::Thread thread2(func);
+        osal::Thread thread3(func);
+    }
+
+    REQUIRE(counter == 3 * cIterations);
+}
@@ -0,0 +1,298 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#include <osal/Error.h>
+#include <osal/StackPool.h>
+#include <osal/Thread.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <set>
+
+#ifdef __linux__
+    #include <sys/wait.h>
+    #include <unistd.h>
+
+    #include <csignal>
+#endif
+
+TEST_CASE("Stack pool creation and destruction", "[unit][c][stackpool]")
+{
+    constexpr std::size_t cStackSize = 64 * 1024;
+    constexpr std::size_t cCount = 4;
+    bool guardPages{};
+
+    SECTION("Without guard pages")
+    {
+        guardPages = false;
+    }
+
+    SECTION("With guard pages")
+    {
+        guardPages = true;
+    }
+
+    OsalStackPool pool{};
+    auto error = osalStackPoolCreate(&pool, {cStackSize, cCount, guardPages});
+    REQUIRE(error == OsalError::eOk);
+    REQUIRE(osalStackPoolStackSize(&pool) >= cStackSize);
+
+    error = osalStackPoolDestroy(&pool);
+    REQUIRE(error == OsalError::eOk);
+}
+
+TEST_CASE("Stack pool creation with invalid arguments", "[unit][c][stackpool]")
+{
+    constexpr std::size_t cStackSize = 64 * 1024;
+
+    OsalStackPool pool{};
+    auto error = osalStackPoolCreate(nullptr, {cStackSize, 1, false});
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    error = osalStackPoolCreate(&pool, {0, 1, false});
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    error = osalStackPoolCreate(&pool, {cStackSize, 0, false});
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    error = osalStackPoolCreate(&pool, {cStackSize, cOsalStackPoolMaxStacks + 1, false});
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    error = osalStackPoolDestroy(&pool);
+    REQUIRE(error == OsalError::eInvalidArgument);
+    REQUIRE(osalStackPoolStackSize(&pool) == 0);
+}
+
+TEST_CASE("Acquire and release all stacks from the pool", "[unit][c][stackpool]")
+{
+    constexpr std::size_t cStackSize = 16 * 1024;
+    constexpr std::size_t cCount = 70;
+
+    OsalStackPool pool{};
+    auto error = osalStackPoolCreate(&pool, {cStackSize, cCount, true});
+    REQUIRE(error == OsalError::eOk);
+
+    std::array<void*, cCount> stacks{};
+    std::set<void*> unique;
+    for (auto& stack : stacks) {
+        error = osalStackPoolAcquire(&pool, &stack);
+        REQUIRE(error == OsalError::eOk);
+        REQUIRE(stack != nullptr);
+        unique.insert(stack);
+    }
+
+    REQUIRE(unique.size() == cCount);
+
+    void* stack{};
+    error = osalStackPoolAcquire(&pool, &stack);
+    REQUIRE(error == OsalError::eLocked);
+
+    error = osalStackPoolDestroy(&pool);
+    REQUIRE(error == OsalError::eLocked);
+
+    error = osalStackPoolRelease(&pool, stacks[0]);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalStackPoolRelease(&pool, stacks[0]);
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    error = osalStackPoolRelease(&pool, static_cast<std::uint8_t*>(stacks[1]) + 1);
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    error = osalStackPoolAcquire(&pool, &stack);
+    REQUIRE(error == OsalError::eOk);
+    REQUIRE(stack == stacks[0]);
+
+    for (auto* acquired : stacks) {
+        error = osalStackPoolRelease(&pool, acquired);
+        REQUIRE(error == OsalError::eOk);
+    }
+
+    error = osalStackPoolDestroy(&pool);
+    REQUIRE(error == OsalError::eOk);
+}
+
+TEST_CASE("Threads running on stacks from the pool", "[unit][c][stackpool]")
+{
+    constexpr std::size_t cStackSize = 64 * 1024;
+    constexpr std::size_t cThreadsCount = 4;
+    constexpr std::size_t cIterations = 3;
+
+    OsalStackPool pool{};
+    auto error = osalStackPoolCreate(&pool, {cStackSize, cThreadsCount, true});
+    REQUIRE(error == OsalError::eOk);
+
+    struct ThreadArgs {
+        void* stack;
+        std::size_t stackSize;
+        bool onStack;
+    };
+
+    auto func = [](void* arg) {
+        auto* args = static_cast<ThreadArgs*>(arg);
+        int local{};
+        auto address = reinterpret_cast<std::uintptr_t>(&local);
+        auto begin = reinterpret_cast<std::uintptr_t>(args->stack);
+        args->onStack = (address >= begin && address < begin + args->stackSize);
+    };
+
+    // Reusing the same stacks many times proves, that they are correctly returned to the pool.
+    for (std::size_t i = 0; i < cIterations; ++i) {
+        std::array<OsalThread, cThreadsCount> threads{};
+        std::array<ThreadArgs, cThreadsCount> args{};
+        for (std::size_t j = 0; j < cThreadsCount; ++j) {
+            error = osalStackPoolAcquire(&pool, &args[j].stack);
+            REQUIRE(error == OsalError::eOk);
+            args[j].stackSize = osalStackPoolStackSize(&pool);
+
+            OsalThreadConfig config{cOsalThreadDefaultPriority, args[j].stackSize, args[j].stack, {}, {}};
+            error = osalThreadCreate(&threads[j], config, func, &args[j]);
+            REQUIRE(error == OsalError::eOk);
+        }
+
+        for (std::size_t j = 0; j < cThreadsCount; ++j) {
+            error = osalThreadJoin(&threads[j]);
+            REQUIRE(error == OsalError::eOk);
+            REQUIRE(args[j].onStack);
+
+            error = osalThreadDestroy(&threads[j]);
+            REQUIRE(error == OsalError::eOk);
+
+            error = osalStackPoolRelease(&pool, args[j].stack);
+            REQUIRE(error == OsalError::eOk);
+        }
+    }
+
+    error = osalStackPoolDestroy(&pool);
+    REQUIRE(error == OsalError::eOk);
+}
+
+TEST_CASE("Thread running on stack from the pool with default stack size", "[unit][c][stackpool]")
+{
+    OsalStackPool pool{};
+    auto error = osalStackPoolCreate(&pool, {cOsalThreadDefaultStackSize, 1, true});
+    REQUIRE(error == OsalError::eOk);
+
+    void* stack{};
+    error = osalStackPoolAcquire(&pool, &stack);
+    REQUIRE(error == OsalError::eOk);
+
+    bool finished{};
+    OsalThread thread{};
+    OsalThreadConfig config{cOsalThreadDefaultPriority, osalStackPoolStackSize(&pool), stack, {}, {}};
+    error = osalThreadCreate(&thread, config, [](void* arg) { *static_cast<bool*>(arg) = true; }, &finished);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalThreadJoin(&thread);
+    REQUIRE(error == OsalError::eOk);
+    REQUIRE(finished);
+
+    error = osalThreadDestroy(&thread);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalStackPoolRelease(&pool, stack);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalStackPoolDestroy(&pool);
+    REQUIRE(error == OsalError::eOk);
+}
+
+#ifdef __linux__
+TEST_CASE("Thread creation with too small custom stack", "[unit][c][stackpool]")
+{
+    constexpr std::size_t cStackSize = 1024;
+    alignas(64) std::array<char, cStackSize> stack{};
+
+    struct ThreadArgs {
+        void* stack;
+        bool onStack;
+    };
+
+    auto func = [](void* arg) {
+        auto* args = static_cast<ThreadArgs*>(arg);
+        int local{};
+        auto address = reinterpret_cast<std::uintptr_t>(&local);
+        auto begin = reinterpret_cast<std::uintptr_t>(args->stack);
+        args->onStack = (address >= begin && address < begin + cStackSize);
+    };
+
+    // Too small stack is ignored and thread runs on the stack allocated by the system.
+    OsalThread thread{};
+    ThreadArgs args{stack.data(), true};
+    OsalThreadConfig config{cOsalThreadDefaultPriority, cStackSize, stack.data(), {}, {}};
+    auto error = osalThreadCreate(&thread, config, func, &args);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalThreadJoin(&thread);
+    REQUIRE(error == OsalError::eOk);
+    REQUIRE(!args.onStack);
+
+    error = osalThreadDestroy(&thread);
+    REQUIRE(error == OsalError::eOk);
+}
+
+TEST_CASE("Stack overflow hits the guard page", "[unit][c][stackpool]")
+{
+    constexpr std::size_t cStackSize = 64 * 1024;
+
+    OsalStackPool pool{};
+    auto error = osalStackPoolCreate(&pool, {cStackSize, 1, true});
+    REQUIRE(error == OsalError::eOk);
+
+    void* stack{};
+    error = osalStackPoolAcquire(&pool, &stack);
+    REQUIRE(error == OsalError::eOk);
+
+    auto pid = fork();
+    REQUIRE(pid != -1);
+    if (pid == 0) {
+        // Writing just below the stack simulates overflow, which has to be caught by the guard page.
+        auto* guard = static_cast<volatile char*>(stack) - 1;
+        *guard = 0;
+        _exit(0);
+    }
+
+    int status{};
+    REQUIRE(waitpid(pid, &status, 0) == pid);
+    REQUIRE(WIFSIGNALED(status));
+    REQUIRE(WTERMSIG(status) == SIGSEGV);
+
+    error = osalStackPoolRelease(&pool, stack);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalStackPoolDestroy(&pool);
+    REQUIRE(error == OsalError::eOk);
+}
+#endif
@@ -0,0 +1,111 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#include <osal/Error.hpp>
+#include <osal/StackPool.hpp>
+#include <osal/Thread.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <utility>
+
+TEST_CASE("Stack pool acquire and release in C++", "[unit][cpp][stackpool]")
+{
+    constexpr std::size_t cStackSize = 64 * 1024;
+
+    osal::StackPool pool(cStackSize, 2);
+    REQUIRE(pool.stackSize() >= cStackSize);
+
+    void* stack1{};
+    auto error = pool.acquire(stack1);
+    REQUIRE(!error);
+
+    void* stack2{};
+    error = pool.acquire(stack2);
+    REQUIRE(!error);
+    REQUIRE(stack1 != stack2);
+
+    void* stack3{};
+    error = pool.acquire(stack3);
+    REQUIRE(error == OsalError::eLocked);
+
+    error = pool.release(stack1);
+    REQUIRE(!error);
+
+    error = pool.release(stack2);
+    REQUIRE(!error);
+
+    osal::StackPool movedPool(std::move(pool));
+    REQUIRE(pool.stackSize() == 0);
+    REQUIRE(movedPool.stackSize() >= cStackSize);
+}
+
+TEST_CASE("Threads started with stacks from the pool in C++", "[unit][cpp][stackpool]")
+{
+    constexpr std::size_t cStackSize = 64 * 1024;
+    constexpr int cIterations = 5;
+
+    osal::StackPool pool(cStackSize, 1);
+
+    for (int i = 0; i < cIterations; ++i) {
+        bool called{};
+        void* stack{};
+        auto func = [&called] { called = true; };
+
+        {
+            osal::Thread thread;
+            auto error = thread.setStackPool(pool);
+            REQUIRE(!error);
+
+            error = thread.start(func);
+            REQUIRE(!error);
+
+            // Pool has only one stack, which is now used by the thread.
+            error = pool.acquire(stack);
+            REQUIRE(error == OsalError::eLocked);
+
+            error = thread.setStackPool(pool);
+            REQUIRE(error == OsalError::eThreadAlreadyStarted);
+
+            error = thread.join();
+            REQUIRE(!error);
+            REQUIRE(called);
+        }
+
+        // Destroyed thread has to return its stack back to the pool.
+        auto error = pool.acquire(stack);
+        REQUIRE(!error);
+        error = pool.release(stack);
+        REQUIRE(!error);
+    }
+}
@@ -0,0 +1,330 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#include <osal/Error.hpp>
+#include <osal/Mutex.hpp>
+#include <osal/Semaphore.hpp>
+#include <osal/Task.hpp>
+#include <osal/TaskScheduler.hpp>
+#include <osal/Thread.hpp>
+#include <osal/Timeout.hpp>
+#include <osal/sleep.hpp>
+#include <osal/timestamp.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <system_error>
+#include <vector>
+
+static osal::Task<int> square(int value)
+{
+    co_return value * value;
+}
+
+static osal::Task<int> sumOfSquares(int count)
+{
+    int sum = 0;
+    for (int i = 1; i <= count; ++i)
+        sum += co_await square(i);
+
+    co_return sum;
+}
+
+static osal::Task<void> storeSumOfSquares(int count, int* result)
+{
+    *result = co_await sumOfSquares(count);
+}
+
+static osal::Task<void> sleepAndCount(osal::TaskScheduler& scheduler, int* counter, std::uint32_t* threadId)
+{
+    co_await scheduler.sleep(20ms);
+    ++(*counter);
+
+    if (*threadId != osal::thread::id())
+        *threadId = 0;
+}
+
+static osal::Task<void> lockAndAppend(osal::TaskScheduler& scheduler,
+                                      osal::Mutex& mutex,
+                                      std::vector<int>* order,
+                                      int value)
+{
+    auto error = co_await scheduler.lock(mutex);
+    if (error)
+        co_return;
+
+    order->push_back(value);
+    co_await scheduler.sleep(10ms);
+    order->push_back(value);
+    mutex.unlock();
+}
+
+static osal::Task<void> lockWithTimeout(osal::TaskScheduler& scheduler,
+                                        osal::Mutex& mutex,
+                                        osal::Timeout timeout,
+                                        std::error_code* result)
+{
+    *result = co_await scheduler.lock(mutex, timeout);
+    if (!*result)
+        mutex.unlock();
+}
+
+static osal::Task<void> waitWithTimeout(osal::TaskScheduler& scheduler,
+                                        osal::Semaphore& semaphore,
+                                        osal::Timeout timeout,
+                                        std::error_code* result)
+{
+    *result = co_await scheduler.wait(semaphore, timeout);
+}
+
+static osal::Task<void> waitForTimeout(osal::TaskScheduler& scheduler, osal::Timeout timeout, bool* expired)
+{
+    auto error = co_await scheduler.wait(timeout);
+    *expired = !error && timeout.isExpired();
+}
+
+static osal::Task<void> sleepAndRecord(osal::TaskScheduler& scheduler, osal::Duration duration, std::vector<int>* order)
+{
+    co_await scheduler.sleep(duration);
+    order->push_back(static_cast<int>(duration.count()));
+}
+
+struct DestructionGuard {
+    bool* destroyed;
+    ~DestructionGuard() { *destroyed = true; }
+};
+
+static osal::Task<void> waitForever(osal::TaskScheduler& scheduler, osal::Semaphore& semaphore, bool* destroyed)
+{
+    DestructionGuard guard{destroyed};
+    co_await scheduler.wait(semaphore);
+}
+
+TEST_CASE("Tasks await other tasks", "[unit][cpp][task]")
+{
+    constexpr int cCount = 10;
+    constexpr int cExpected = 385;
+
+    osal::Task<int> invalid;
+    REQUIRE(!invalid.valid());
+
+    auto task = sumOfSquares(cCount);
+    REQUIRE(task.valid());
+    REQUIRE(!task.done());
+
+    int result{};
+    osal::TaskScheduler scheduler;
+    auto error = scheduler.spawn(storeSumOfSquares(cCount, &result));
+    REQUIRE(!error);
+    REQUIRE(scheduler.tasksCount() == 1);
+
+    error = scheduler.spawn(osal::Task<void>{});
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    error = scheduler.run();
+    REQUIRE(!error);
+    REQUIRE(result == cExpected);
+    REQUIRE(scheduler.tasksCount() == 0);
+}
+
+TEST_CASE("Thousands of sleeping tasks share one thread", "[unit][cpp][task]")
+{
+    constexpr int cTasksCount = 5000;
+    int counter{};
+    std::uint32_t threadId = osal::thread::id();
+
+    osal::TaskScheduler scheduler;
+    for (int i = 0; i < cTasksCount; ++i) {
+        auto error = scheduler.spawn(sleepAndCount(scheduler, &counter, &threadId));
+        REQUIRE(!error);
+    }
+
+    auto start = osal::timestamp();
+    auto error = scheduler.run();
+    REQUIRE(!error);
+    REQUIRE(counter == cTasksCount);
+    REQUIRE(threadId == osal::thread::id());
+    REQUIRE(osal::timestamp() - start >= 20ms);
+    REQUIRE(osal::timestamp() - start < 2s);
+}
+
+TEST_CASE("Tasks awaiting mutex", "[unit][cpp][task]")
+{
+    osal::TaskScheduler scheduler;
+    osal::Mutex mutex;
+
+    SECTION("Mutex shared by tasks")
+    {
+        std::vector<int> order;
+        scheduler.spawn(lockAndAppend(scheduler, mutex, &order, 1));
+        scheduler.spawn(lockAndAppend(scheduler, mutex, &order, 2));
+        scheduler.spawn(lockAndAppend(scheduler, mutex, &order, 3));
+
+        auto error = scheduler.run();
+        REQUIRE(!error);
+        REQUIRE(order.size() == 6);
+        for (std::size_t i = 0; i < order.size(); i += 2)
+            REQUIRE(order[i] == order[i + 1]);
+    }
+
+    SECTION("Mutex locked by other thread")
+    {
+        osal::Semaphore locked{0};
+        osal::Thread thread([&] {
+            mutex.lock();
+            locked.signal();
+            osal::sleep(50ms);
+            mutex.unlock();
+        });
+        locked.wait();
+
+        std::error_code timedOut;
+        std::error_code noWait;
+        std::error_code acquired;
+        scheduler.spawn(lockWithTimeout(scheduler, mutex, 10ms, &timedOut));
+        scheduler.spawn(lockWithTimeout(scheduler, mutex, osal::Timeout::none(), &noWait));
+        scheduler.spawn(lockWithTimeout(scheduler, mutex, osal::Timeout::infinity(), &acquired));
+
+        auto error = scheduler.run();
+        REQUIRE(!error);
+        REQUIRE(timedOut == OsalError::eTimeout);
+        REQUIRE(noWait == OsalError::eTimeout);
+        REQUIRE(!acquired);
+        thread.join();
+    }
+}
+
+TEST_CASE("Tasks awaiting semaphore and timeout", "[unit][cpp][task]")
+{
+    osal::TaskScheduler scheduler;
+    osal::Semaphore semaphore{0};
+
+    SECTION("Semaphore signaled by other thread")
+    {
+        std::error_code timedOut;
+        std::error_code acquired;
+        scheduler.spawn(waitWithTimeout(scheduler, semaphore, 10ms, &timedOut));
+        scheduler.spawn(waitWithTimeout(scheduler, semaphore, 1s, &acquired));
+
+        osal::Thread thread([&semaphore] {
+            osal::sleep(50ms);
+            semaphore.signal();
+        });
+
+        auto error = scheduler.run();
+        REQUIRE(!error);
+        REQUIRE(timedOut == OsalError::eTimeout);
+        REQUIRE(!acquired);
+        thread.join();
+    }
+
+    SECTION("Timeout")
+    {
+        bool expired{};
+        auto start = osal::timestamp();
+        scheduler.spawn(waitForTimeout(scheduler, 30ms, &expired));
+
+        auto error = scheduler.run();
+        REQUIRE(!error);
+        REQUIRE(expired);
+        REQUIRE(osal::timestamp() - start >= 30ms);
+    }
+}
+
+TEST_CASE("Sleeping tasks resumed in the order of their deadlines", "[unit][cpp][task]")
+{
+    osal::TaskScheduler scheduler;
+    std::vector<int> order;
+    for (auto duration : {40ms, 10ms, 30ms, 0ms, 20ms, 50ms, 5ms})
+        scheduler.spawn(sleepAndRecord(scheduler, duration, &order));
+
+    auto error = scheduler.run();
+    REQUIRE(!error);
+    REQUIRE(order.size() == 7);
+    REQUIRE(std::is_sorted(order.begin(), order.end()));
+}
+
+TEST_CASE("Tasks woken up by the scheduler-aware release without polling", "[unit][cpp][task]")
+{
+    osal::TaskScheduler scheduler{osal::Duration::max()};
+    osal::Mutex mutex;
+    osal::Semaphore semaphore{0};
+    osal::Semaphore locked{0};
+
+    std::error_code lockResult{OsalError::eOsError};
+    std::error_code waitResult{OsalError::eOsError};
+    scheduler.spawn(lockWithTimeout(scheduler, mutex, osal::Timeout::infinity(), &lockResult));
+    scheduler.spawn(waitWithTimeout(scheduler, semaphore, osal::Timeout::infinity(), &waitResult));
+
+    osal::Thread thread([&] {
+        mutex.lock();
+        locked.signal();
+        osal::sleep(30ms);
+        scheduler.unlock(mutex);
+        scheduler.signal(semaphore);
+    });
+
+    locked.wait();
+    auto start = osal::timestamp();
+    auto error = scheduler.run();
+    REQUIRE(!error);
+    REQUIRE(!lockResult);
+    REQUIRE(!waitResult);
+    REQUIRE(osal::timestamp() - start < 1s);
+    thread.join();
+}
+
+TEST_CASE("Task scheduler stopped with suspended tasks", "[unit][cpp][task]")
+{
+    osal::Semaphore semaphore{0};
+    bool destroyed{};
+
+    {
+        osal::TaskScheduler scheduler;
+        scheduler.spawn(waitForever(scheduler, semaphore, &destroyed));
+
+        osal::Thread thread([&scheduler] {
+            osal::sleep(20ms);
+            scheduler.stop();
+        });
+
+        auto error = scheduler.run();
+        REQUIRE(!error);
+        REQUIRE(scheduler.tasksCount() == 1);
+        REQUIRE(!destroyed);
+        thread.join();
+    }
+
+    REQUIRE(destroyed);
+}
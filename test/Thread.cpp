@@ -34,10 +34,12 @@
 #include <osal/Semaphore.hpp>
 #include <osal/Thread.h>
 #include <osal/sleep.hpp>
+#include <osal/timestamp.h>
 
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_string.hpp>
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstdint>
@@ -47,13 +49,21 @@
 #include <string_view>
 #include <tuple>
 
+#ifdef __linux__
+    #include <sched.h>
+    #include <sys/resource.h>
+    #include <unistd.h>
+#endif
+
 TEST_CASE("Thread creation and destruction", "[unit][c][thread]")
 {
     auto func = [](void* /*unused*/) {};
 
     OsalThread thread{};
-    auto error
-        = osalThreadCreate(&thread, {cOsalThreadDefaultPriority, cOsalThreadDefaultStackSize, nullptr}, func, nullptr);
+    auto error = osalThreadCreate(&thread,
+                                  {cOsalThreadDefaultPriority, cOsalThreadDefaultStackSize, nullptr, {}, {}},
+                                  func,
+                                  nullptr);
     REQUIRE(error == OsalError::eOk);
 
     error = osalThreadJoin(&thread);
@@ -90,7 +100,7 @@ TEST_CASE("Named thread creation and destruction", "[unit][c][thread]")
 
     OsalThread thread{};
     auto error = osalThreadCreateEx(&thread,
-                                    {cOsalThreadDefaultPriority, cOsalThreadDefaultStackSize, nullptr},
+                                    {cOsalThreadDefaultPriority, cOsalThreadDefaultStackSize, nullptr, {}, {}},
                                     func,
                                     &threadData,
                                     setThreadName.data());
@@ -116,18 +126,20 @@ TEST_CASE("Thread creation with invalid arguments", "[unit][c][thread]")
     auto func = [](void* /*unused*/) {};
 
     OsalThread thread{};
-    auto error
-        = osalThreadCreate(nullptr, {cOsalThreadDefaultPriority, cOsalThreadDefaultStackSize, nullptr}, func, nullptr);
+    auto error = osalThreadCreate(nullptr,
+                                  {cOsalThreadDefaultPriority, cOsalThreadDefaultStackSize, nullptr, {}, {}},
+                                  func,
+                                  nullptr);
     REQUIRE(error == OsalError::eInvalidArgument);
 
     error = osalThreadCreate(&thread,
-                             {cOsalThreadDefaultPriority, cOsalThreadDefaultStackSize, nullptr},
+                             {cOsalThreadDefaultPriority, cOsalThreadDefaultStackSize, nullptr, {}, {}},
                              nullptr,
                              nullptr);
     REQUIRE(error == OsalError::eInvalidArgument);
 
     error = osalThreadCreateEx(&thread,
-                               {cOsalThreadDefaultPriority, cOsalThreadDefaultStackSize, nullptr},
+                               {cOsalThreadDefaultPriority, cOsalThreadDefaultStackSize, nullptr, {}, {}},
                                func,
                                nullptr,
                                "0123456789ABCDEF");
@@ -135,10 +147,24 @@ TEST_CASE("Thread creation with invalid arguments", "[unit][c][thread]")
 
     constexpr int cInvalidPriority = 5;
     error = osalThreadCreate(&thread,
-                             {static_cast<OsalThreadPriority>(cInvalidPriority), cOsalThreadDefaultStackSize, nullptr},
+                             {static_cast<OsalThreadPriority>(cInvalidPriority),
+                              cOsalThreadDefaultStackSize,
+                              nullptr,
+                              {},
+                              {}},
                              func,
                              nullptr);
     REQUIRE(error == OsalError::eInvalidArgument);
+
+    constexpr int cInvalidPolicy = 4;
+    OsalThreadConfig config{cOsalThreadDefaultPriority, cOsalThreadDefaultStackSize, nullptr, {}, {}};
+    config.scheduling.policy = static_cast<OsalThreadPolicy>(cInvalidPolicy);
+    error = osalThreadCreate(&thread, config, func, nullptr);
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    config.scheduling = {OsalThreadPolicy::ePolicyDeadline, 2'000'000, 1'000'000, 0};
+    error = osalThreadCreate(&thread, config, func, nullptr);
+    REQUIRE(error == OsalError::eInvalidArgument);
 }
 
 TEST_CASE("Multiple thread joins", "[unit][c][thread]")
@@ -146,8 +172,10 @@ TEST_CASE("Multiple thread joins", "[unit][c][thread]")
     auto func = [](void* /*unused*/) {};
 
     OsalThread thread{};
-    auto error
-        = osalThreadCreate(&thread, {cOsalThreadDefaultPriority, cOsalThreadDefaultStackSize, nullptr}, func, nullptr);
+    auto error = osalThreadCreate(&thread,
+                                  {cOsalThreadDefaultPriority, cOsalThreadDefaultStackSize, nullptr, {}, {}},
+                                  func,
+                                  nullptr);
     REQUIRE(error == OsalError::eOk);
 
     error = osalThreadJoin(&thread);
@@ -186,7 +214,7 @@ TEST_CASE("Launch 5 threads and check their results", "[unit][c][thread]")
 
     for (std::size_t i = 0; i < threads.size(); ++i) {
         auto error = osalThreadCreate(&threads[i],
-                                      {cOsalThreadDefaultPriority, cOsalThreadDefaultStackSize, nullptr},
+                                      {cOsalThreadDefaultPriority, cOsalThreadDefaultStackSize, nullptr, {}, {}},
                                       func,
                                       &counters[i]);
         REQUIRE(error == OsalError::eOk);
@@ -238,7 +266,8 @@ TEST_CASE("Launch 5 threads with different priorities and check their results",
 
     for (std::size_t i = 0; i < threads.size(); ++i) {
         auto priority = static_cast<OsalThreadPriority>(i / 2);
-        auto error = osalThreadCreate(&threads[i], {priority, cOsalThreadDefaultStackSize, nullptr}, func, &args[i]);
+        auto error
+            = osalThreadCreate(&threads[i], {priority, cOsalThreadDefaultStackSize, nullptr, {}, {}}, func, &args[i]);
         REQUIRE(error == OsalError::eOk);
     }
 
@@ -265,7 +294,7 @@ TEST_CASE("Create threads with all priorities", "[unit][c][thread]")
     for (int i = OsalThreadPriority::eLowest; i <= OsalThreadPriority::eHighest; ++i) {
         OsalThread thread{};
         auto priority = static_cast<OsalThreadPriority>(i / 2);
-        auto error = osalThreadCreate(&thread, {priority, cOsalThreadDefaultStackSize, nullptr}, func, nullptr);
+        auto error = osalThreadCreate(&thread, {priority, cOsalThreadDefaultStackSize, nullptr, {}, {}}, func, nullptr);
         REQUIRE(error == OsalError::eOk);
 
         error = osalThreadJoin(&thread);
@@ -312,7 +341,8 @@ TEST_CASE("Check if thread ids are unique and constant", "[unit][c][thread]")
 
     for (std::size_t i = 0; i < threads.size(); ++i) {
         auto priority = static_cast<OsalThreadPriority>(i / 2);
-        auto error = osalThreadCreate(&threads[i], {priority, cOsalThreadDefaultStackSize, nullptr}, func, &args[i]);
+        auto error
+            = osalThreadCreate(&threads[i], {priority, cOsalThreadDefaultStackSize, nullptr, {}, {}}, func, &args[i]);
         REQUIRE(error == OsalError::eOk);
     }
 
@@ -332,3 +362,412 @@ TEST_CASE("Check if thread ids are unique and constant", "[unit][c][thread]")
 
     REQUIRE(uniqueIds.size() == cThreadsCount);
 }
+
+TEST_CASE("Thread CPU affinity", "[unit][c][thread]")
+{
+    OsalThreadConfig config{cOsalThreadDefaultPriority, cOsalThreadDefaultStackSize, nullptr, {}, {}};
+    osalCpuSetAdd(&config.affinity, 0);
+    REQUIRE(osalCpuSetContains(&config.affinity, 0));
+    REQUIRE(!osalCpuSetContains(&config.affinity, 1));
+    REQUIRE(!osalCpuSetIsEmpty(&config.affinity));
+
+    std::uint32_t cpu = cOsalMaxCpus;
+    auto func = [](void* arg) {
+        osal::sleep(50ms);
+        *static_cast<std::uint32_t*>(arg) = osalThreadCurrentCpu();
+    };
+
+    OsalThread thread{};
+    auto error = osalThreadCreate(&thread, config, func, &cpu);
+    REQUIRE(error == OsalError::eOk);
+
+    OsalCpuSet cpus{};
+    error = osalThreadGetAffinity(&thread, &cpus);
+    REQUIRE(error == OsalError::eOk);
+    REQUIRE(osalCpuSetContains(&cpus, 0));
+    REQUIRE(!osalCpuSetContains(&cpus, 1));
+
+    error = osalThreadSetAffinity(&thread, &config.affinity);
+    REQUIRE(error == OsalError::eOk);
+
+    osalCpuSetClear(&cpus);
+    REQUIRE(osalCpuSetIsEmpty(&cpus));
+    error = osalThreadSetAffinity(&thread, &cpus);
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    osalCpuSetAdd(&cpus, cOsalMaxCpus - 1);
+    error = osalThreadSetAffinity(&thread, &cpus);
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    error = osalThreadSetAffinity(nullptr, &config.affinity);
+    REQUIRE(error == OsalError::eInvalidArgument);
+    error = osalThreadGetAffinity(&thread, nullptr);
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    error = osalThreadJoin(&thread);
+    REQUIRE(error == OsalError::eOk);
+    REQUIRE(cpu == 0);
+
+    error = osalThreadDestroy(&thread);
+    REQUIRE(error == OsalError::eOk);
+
+    OsalThreadConfig invalidConfig{cOsalThreadDefaultPriority, cOsalThreadDefaultStackSize, nullptr, {}, {}};
+    osalCpuSetAdd(&invalidConfig.affinity, cOsalMaxCpus - 1);
+    error = osalThreadCreate(&thread, invalidConfig, func, &cpu);
+    REQUIRE(error == OsalError::eInvalidArgument);
+}
+
+TEST_CASE("Number of available CPUs", "[unit][c][thread]")
+{
+    auto count = osalThreadCpuCount();
+    REQUIRE(count >= 1);
+    REQUIRE(count <= cOsalMaxCpus);
+}
+
+TEST_CASE("Registry of live threads", "[unit][c][thread]")
+{
+    constexpr std::size_t cThreadsCount = 3;
+    constexpr std::size_t cNameSize = 16;
+
+    struct ThreadData {
+        std::array<char, cNameSize> name{};
+        std::uint32_t id{};
+        osal::Semaphore* readySemaphore{};
+        osal::Semaphore* stopSemaphore{};
+    };
+
+    osal::Semaphore readySemaphore{0};
+    osal::Semaphore stopSemaphore{0};
+    std::array<ThreadData, cThreadsCount> threadData{};
+    std::array<OsalThread, cThreadsCount> threads{};
+    std::array<std::string_view, cThreadsCount> names{"registry0", "registry1", "registry2"};
+
+    auto func = [](void* arg) {
+        auto* data = static_cast<ThreadData*>(arg);
+
+        // Name has to be valid right from the start of the thread.
+        osalThreadName(data->name.data(), data->name.size());
+        data->id = osalThreadId();
+        data->readySemaphore->signal();
+        data->stopSemaphore->wait();
+    };
+
+    auto startTimestamp = osalTimestampNs();
+    for (std::size_t i = 0; i < cThreadsCount; ++i) {
+        threadData[i].readySemaphore = &readySemaphore;
+        threadData[i].stopSemaphore = &stopSemaphore;
+        auto priority = static_cast<OsalThreadPriority>(i);
+        auto error = osalThreadCreateEx(&threads[i],
+                                        {priority, cOsalThreadDefaultStackSize, nullptr, {}, {}},
+                                        func,
+                                        &threadData[i],
+                                        names[i].data());
+        REQUIRE(error == OsalError::eOk);
+    }
+
+    for (std::size_t i = 0; i < cThreadsCount; ++i)
+        readySemaphore.wait();
+
+    std::size_t count{};
+    auto error = osalThreadEnumerate(nullptr, 0, &count);
+    REQUIRE(error == OsalError::eOk);
+    REQUIRE(count >= cThreadsCount);
+
+    std::array<OsalThreadInfo, cThreadsCount> tooSmall{};
+    error = osalThreadEnumerate(tooSmall.data(), 1, &count);
+    REQUIRE(error == OsalError::eOk);
+    REQUIRE(count >= cThreadsCount);
+
+    constexpr std::size_t cMaxInfos = 64;
+    std::array<OsalThreadInfo, cMaxInfos> infos{};
+    error = osalThreadEnumerate(infos.data(), infos.size(), &count);
+    REQUIRE(error == OsalError::eOk);
+    REQUIRE(count <= infos.size());
+
+    for (std::size_t i = 0; i < cThreadsCount; ++i) {
+        REQUIRE_THAT(threadData[i].name.data(), Catch::Matchers::Equals(names[i].data()));
+
+        auto it = std::find_if(infos.begin(), infos.begin() + count, [&](const auto& info) {
+            return names[i] == info.name;
+        });
+        REQUIRE(it != infos.begin() + count);
+        REQUIRE(it->id == threadData[i].id);
+        REQUIRE(it->priority == static_cast<OsalThreadPriority>(i));
+        REQUIRE(it->startTimestampNs >= startTimestamp);
+        REQUIRE(it->startTimestampNs <= osalTimestampNs());
+    }
+
+    for (std::size_t i = 0; i < cThreadsCount; ++i)
+        stopSemaphore.signal();
+
+    for (auto& thread : threads) {
+        error = osalThreadJoin(&thread);
+        REQUIRE(error == OsalError::eOk);
+
+        error = osalThreadDestroy(&thread);
+        REQUIRE(error == OsalError::eOk);
+    }
+
+    error = osalThreadEnumerate(infos.data(), infos.size(), &count);
+    REQUIRE(error == OsalError::eOk);
+    for (std::size_t i = 0; i < count; ++i) {
+        auto found = std::find(names.begin(), names.end(), infos[i].name) != names.end();
+        REQUIRE(!found);
+    }
+
+    error = osalThreadEnumerate(nullptr, 1, &count);
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    error = osalThreadEnumerate(infos.data(), infos.size(), nullptr);
+    REQUIRE(error == OsalError::eInvalidArgument);
+}
+
+TEST_CASE("Thread runtime statistics", "[unit][c][thread]")
+{
+    constexpr std::uint64_t cBusyTimeNs = 20'000'000;
+
+    struct ThreadData {
+        OsalThread* thread{};
+        OsalThreadStats stats{};
+        osal::Semaphore readySemaphore{0};
+        osal::Semaphore stopSemaphore{0};
+    };
+
+    auto func = [](void* arg) {
+        auto* data = static_cast<ThreadData*>(arg);
+
+        // Burn some CPU time, so that it is visible in the statistics.
+        do {
+            auto error = osalThreadGetStats(data->thread, &data->stats);
+            if (error != OsalError::eOk)
+                REQUIRE(error == OsalError::eOk);
+        } while (data->stats.cpuTimeNs < cBusyTimeNs && data->stats.runtimeNs < 10 * cBusyTimeNs);
+
+        data->readySemaphore.signal();
+        data->stopSemaphore.wait();
+    };
+
+    OsalThread thread{};
+    ThreadData data{&thread};
+    auto error = osalThreadCreate(&thread,
+                                  {cOsalThreadDefaultPriority, cOsalThreadDefaultStackSize, nullptr, {}, {}},
+                                  func,
+                                  &data);
+    REQUIRE(error == OsalError::eOk);
+
+    data.readySemaphore.wait();
+    REQUIRE(data.stats.runtimeNs >= data.stats.cpuTimeNs);
+
+    OsalThreadStats stats{};
+    error = osalThreadGetStats(&thread, &stats);
+    REQUIRE(error == OsalError::eOk);
+    REQUIRE(stats.cpuTimeNs >= data.stats.cpuTimeNs);
+    REQUIRE(stats.runtimeNs >= data.stats.runtimeNs);
+    REQUIRE(stats.runtimeNs >= stats.cpuTimeNs);
+#ifdef __linux__
+    REQUIRE(stats.cpuTimeNs >= cBusyTimeNs);
+    REQUIRE(stats.voluntarySwitches >= 1);
+    REQUIRE(stats.voluntarySwitches >= data.stats.voluntarySwitches);
+    REQUIRE(stats.involuntarySwitches >= data.stats.involuntarySwitches);
+#endif
+
+    error = osalThreadGetStats(&thread, nullptr);
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    data.stopSemaphore.signal();
+    error = osalThreadJoin(&thread);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalThreadDestroy(&thread);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalThreadGetStats(&thread, &stats);
+    REQUIRE(error == OsalError::eInvalidArgument);
+}
+
+TEST_CASE("Statistics of finished thread not available before join", "[unit][c][thread]")
+{
+    constexpr int cMaxRetries = 1000;
+
+    auto func = [](void* arg) {
+        auto* semaphore = static_cast<osal::Semaphore*>(arg);
+        semaphore->signal();
+    };
+
+    OsalThread thread{};
+    osal::Semaphore semaphore{0};
+    auto error = osalThreadCreate(&thread,
+                                  {cOsalThreadDefaultPriority, cOsalThreadDefaultStackSize, nullptr, {}, {}},
+                                  func,
+                                  &semaphore);
+    REQUIRE(error == OsalError::eOk);
+
+    semaphore.wait();
+
+    // Thread function returns right after signaling, so statistics have to become unavailable without joining.
+    OsalThreadStats stats{};
+    for (int i = 0; i < cMaxRetries; ++i) {
+        error = osalThreadGetStats(&thread, &stats);
+        if (error != OsalError::eOk)
+            break;
+
+        osal::sleep(1ms);
+    }
+
+    REQUIRE(error == OsalError::eOsError);
+
+    error = osalThreadJoin(&thread);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalThreadDestroy(&thread);
+    REQUIRE(error == OsalError::eOk);
+}
+
+TEST_CASE("Thread scheduling policies", "[unit][c][thread]")
+{
+    OsalThreadConfig config{cOsalThreadDefaultPriority, cOsalThreadDefaultStackSize, nullptr, {}, {}};
+    [[maybe_unused]] int expectedPolicy{};
+
+    SECTION("Time-sharing policy")
+    {
+        config.priority = OsalThreadPriority::eLow;
+        config.scheduling.policy = OsalThreadPolicy::ePolicyOther;
+#ifdef __linux__
+        expectedPolicy = SCHED_OTHER;
+#endif
+    }
+
+    SECTION("FIFO policy")
+    {
+        config.priority = OsalThreadPriority::eHighest;
+        config.scheduling.policy = OsalThreadPolicy::ePolicyFifo;
+#ifdef __linux__
+        expectedPolicy = SCHED_FIFO;
+#endif
+    }
+
+    SECTION("Round robin policy")
+    {
+        config.priority = OsalThreadPriority::eHigh;
+        config.scheduling.policy = OsalThreadPolicy::ePolicyRoundRobin;
+#ifdef __linux__
+        expectedPolicy = SCHED_RR;
+#endif
+    }
+
+    SECTION("Deadline policy")
+    {
+        config.scheduling = {OsalThreadPolicy::ePolicyDeadline, 1'000'000, 10'000'000, 10'000'000};
+#ifdef __linux__
+        constexpr int cSchedDeadline = 6;
+        expectedPolicy = cSchedDeadline;
+#endif
+    }
+
+    int policy = -1;
+    auto func = [](void* arg) {
+#ifdef __linux__
+        *static_cast<int*>(arg) = sched_getscheduler(0);
+#else
+        *static_cast<int*>(arg) = 0;
+#endif
+    };
+
+    OsalThread thread{};
+    auto error = osalThreadCreate(&thread, config, func, &policy);
+    REQUIRE((error == OsalError::eOk || error == OsalError::eSchedulingFallback));
+
+    auto joinError = osalThreadJoin(&thread);
+    REQUIRE(joinError == OsalError::eOk);
+    REQUIRE(policy != -1);
+
+#ifdef __linux__
+    // Fallback always means, that thread has been started with the time-sharing policy.
+    REQUIRE(policy == ((error == OsalError::eOk) ? expectedPolicy : SCHED_OTHER));
+#endif
+
+    joinError = osalThreadDestroy(&thread);
+    REQUIRE(joinError == OsalError::eOk);
+}
+
+#ifdef __linux__
+TEST_CASE("Thread priority applied as nice value", "[unit][c][thread]")
+{
+    OsalThreadConfig config{cOsalThreadDefaultPriority, cOsalThreadDefaultStackSize, nullptr, {}, {}};
+    int expectedNice{};
+
+    SECTION("Lowest priority")
+    {
+        config.priority = OsalThreadPriority::eLowest;
+        expectedNice = 19;
+    }
+
+    SECTION("Low priority")
+    {
+        config.priority = OsalThreadPriority::eLow;
+        expectedNice = 10;
+    }
+
+    int nice = -1;
+    auto func = [](void* arg) { *static_cast<int*>(arg) = getpriority(PRIO_PROCESS, 0); };
+
+    OsalThread thread{};
+    auto error = osalThreadCreate(&thread, config, func, &nice);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalThreadJoin(&thread);
+    REQUIRE(error == OsalError::eOk);
+    REQUIRE(nice == expectedNice);
+
+    error = osalThreadDestroy(&thread);
+    REQUIRE(error == OsalError::eOk);
+}
+
+TEST_CASE("Clamped nice value doesn't fail thread creation", "[unit][c][thread]")
+{
+    constexpr int cHighestNice = -20;
+    OsalThreadConfig config{OsalThreadPriority::eHighest, cOsalThreadDefaultStackSize, nullptr, {}, {}};
+
+    int nice = 0;
+    auto func = [](void* arg) { *static_cast<int*>(arg) = getpriority(PRIO_PROCESS, 0); };
+
+    // Without CAP_SYS_NICE requested value is clamped, but thread is still created with the default policy.
+    OsalThread thread{};
+    auto error = osalThreadCreate(&thread, config, func, &nice);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalThreadJoin(&thread);
+    REQUIRE(error == OsalError::eOk);
+    REQUIRE(nice >= cHighestNice);
+
+    error = osalThreadDestroy(&thread);
+    REQUIRE(error == OsalError::eOk);
+}
+
+TEST_CASE("Thread id is the kernel thread id", "[unit][c][thread]")
+{
+    REQUIRE(osalThreadId() == static_cast<std::uint32_t>(gettid()));
+
+    std::uint32_t ids[2]{}; // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+    auto func = [](void* arg) {
+        auto* ids = static_cast<std::uint32_t*>(arg);
+        ids[0] = osalThreadId();
+        ids[1] = static_cast<std::uint32_t>(gettid());
+    };
+
+    OsalThread thread{};
+    auto error = osalThreadCreate(&thread,
+                                  {cOsalThreadDefaultPriority, cOsalThreadDefaultStackSize, nullptr, {}, {}},
+                                  func,
+                                  static_cast<std::uint32_t*>(ids));
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalThreadJoin(&thread);
+    REQUIRE(error == OsalError::eOk);
+    REQUIRE(ids[0] == ids[1]);
+    REQUIRE(ids[0] != osalThreadId());
+
+    error = osalThreadDestroy(&thread);
+    REQUIRE(error == OsalError::eOk);
+}
+#endif
@@ -0,0 +1,146 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#include <osal/Error.h>
+#include <osal/Thread.h>
+#include <osal/ThreadLocal.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+TEST_CASE("Thread-local storage creation and destruction", "[unit][c][threadlocal]")
+{
+    OsalThreadLocal local{};
+    auto error = osalThreadLocalCreate(&local, nullptr);
+    REQUIRE(error == OsalError::eOk);
+    REQUIRE(osalThreadLocalGet(&local) == nullptr);
+
+    error = osalThreadLocalDestroy(&local);
+    REQUIRE(error == OsalError::eOk);
+    REQUIRE(osalThreadLocalGet(&local) == nullptr);
+
+    error = osalThreadLocalDestroy(&local);
+    REQUIRE(error == OsalError::eInvalidArgument);
+}
+
+TEST_CASE("Thread-local storage with invalid arguments", "[unit][c][threadlocal]")
+{
+    int value{};
+    OsalThreadLocal local{};
+
+    auto error = osalThreadLocalCreate(nullptr, nullptr);
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    error = osalThreadLocalDestroy(nullptr);
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    error = osalThreadLocalSet(nullptr, &value);
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    error = osalThreadLocalSet(&local, &value);
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    REQUIRE(osalThreadLocalGet(nullptr) == nullptr);
+    REQUIRE(osalThreadLocalGet(&local) == nullptr);
+}
+
+TEST_CASE("Thread-local storage keeps separate value for each thread", "[unit][c][threadlocal]")
+{
+    constexpr std::size_t cThreadsCount = 4;
+    static std::atomic<int> destroyedCount{};
+    destroyedCount = 0;
+
+    struct ThreadData {
+        OsalThreadLocal* local;
+        int value;
+        bool initiallyEmpty;
+        bool valid;
+    };
+
+    OsalThreadLocal local{};
+    auto error = osalThreadLocalCreate(&local, [](void* value) {
+        ++destroyedCount;
+        static_cast<ThreadData*>(value)->value = -1;
+    });
+    REQUIRE(error == OsalError::eOk);
+
+    int mainValue{};
+    error = osalThreadLocalSet(&local, &mainValue);
+    REQUIRE(error == OsalError::eOk);
+    REQUIRE(osalThreadLocalGet(&local) == &mainValue);
+
+    auto func = [](void* param) {
+        auto* data = static_cast<ThreadData*>(param);
+        data->initiallyEmpty = (osalThreadLocalGet(data->local) == nullptr);
+        osalThreadLocalSet(data->local, data);
+
+        for (int i = 0; i < 1000; ++i) {
+            if (osalThreadLocalGet(data->local) != data)
+                return;
+
+            osalThreadYield();
+        }
+
+        data->valid = true;
+    };
+
+    OsalThreadConfig config{cOsalThreadDefaultPriority, cOsalThreadDefaultStackSize, nullptr, {}, {}};
+    std::array<OsalThread, cThreadsCount> threads{};
+    std::array<ThreadData, cThreadsCount> data{};
+    for (std::size_t i = 0; i < cThreadsCount; ++i) {
+        data[i] = {&local, static_cast<int>(i), false, false};
+        error = osalThreadCreate(&threads[i], config, func, &data[i]);
+        REQUIRE(error == OsalError::eOk);
+    }
+
+    for (std::size_t i = 0; i < cThreadsCount; ++i) {
+        error = osalThreadJoin(&threads[i]);
+        REQUIRE(error == OsalError::eOk);
+
+        error = osalThreadDestroy(&threads[i]);
+        REQUIRE(error == OsalError::eOk);
+
+        REQUIRE(data[i].initiallyEmpty);
+        REQUIRE(data[i].valid);
+        REQUIRE(data[i].value == -1);
+    }
+
+    // Destructor is called only at thread exit, so value of the main thread is untouched.
+    REQUIRE(destroyedCount == cThreadsCount);
+    REQUIRE(osalThreadLocalGet(&local) == &mainValue);
+
+    error = osalThreadLocalDestroy(&local);
+    REQUIRE(error == OsalError::eOk);
+}
@@ -0,0 +1,133 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#include <osal/Error.hpp>
+#include <osal/Thread.hpp>
+#include <osal/ThreadLocal.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <atomic>
+#include <string>
+#include <utility>
+
+namespace {
+
+std::atomic<int> constructedCount{};
+std::atomic<int> destroyedCount{};
+
+struct Counted {
+    Counted() { ++constructedCount; }
+    explicit Counted(int initialValue)
+        : value(initialValue)
+    {
+        ++constructedCount;
+    }
+    Counted(const Counted&) = delete;
+    Counted(Counted&& other) noexcept
+        : value(other.value)
+    {
+        ++constructedCount;
+    }
+    ~Counted() { ++destroyedCount; }
+    Counted& operator=(const Counted&) = delete;
+    Counted& operator=(Counted&&) noexcept = default;
+
+    int value{};
+};
+
+} // namespace
+
+TEST_CASE("Thread-local object created on first access", "[unit][cpp][threadlocal]")
+{
+    osal::ThreadLocal<std::string> local;
+    REQUIRE(!local.exists());
+
+    local->append("main");
+    REQUIRE(local.exists());
+    REQUIRE(*local == "main");
+
+    auto error = local.set("other");
+    REQUIRE(!error);
+    REQUIRE(*local.get() == "other");
+
+    error = local.reset();
+    REQUIRE(!error);
+    REQUIRE(!local.exists());
+    REQUIRE(local->empty());
+}
+
+TEST_CASE("Thread-local objects are separate and destroyed at thread exit", "[unit][cpp][threadlocal]")
+{
+    constexpr int cThreadsCount = 4;
+    constexpr int cIterations = 1000;
+    constructedCount = 0;
+    destroyedCount = 0;
+
+    {
+        osal::ThreadLocal<Counted> local;
+        local->value = -1;
+
+        std::array<osal::Thread<>, cThreadsCount> threads;
+        std::array<int, cThreadsCount> results{};
+        for (int i = 0; i < cThreadsCount; ++i) {
+            auto error = threads[i].start([&local, &results, i] {
+                if (local.exists())
+                    return;
+
+                for (int j = 0; j < cIterations; ++j)
+                    local->value += i;
+
+                results[i] = local->value;
+            });
+            REQUIRE(!error);
+        }
+
+        for (auto& thread : threads)
+            thread.join();
+
+        for (int i = 0; i < cThreadsCount; ++i)
+            REQUIRE(results[i] == i * cIterations);
+
+        REQUIRE(local->value == -1);
+        REQUIRE(constructedCount == cThreadsCount + 1);
+        REQUIRE(destroyedCount == cThreadsCount);
+
+        auto error = local.set(Counted{7});
+        REQUIRE(!error);
+        REQUIRE(local->value == 7);
+    }
+
+    // Instance of the main thread is destroyed together with the ThreadLocal.
+    REQUIRE(destroyedCount == constructedCount);
+}
@@ -38,10 +38,12 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_string.hpp>
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <memory>
 #include <set>
 #include <utility>
 
@@ -165,6 +167,25 @@ TEST_CASE("Thread creation with custom stack", "[unit][cpp][thread]")
         REQUIRE(launched);
     }
 
+    SECTION("Create thread with big custom stack")
+    {
+        // Stack big enough for all supported platforms (e.g. PTHREAD_STACK_MIN) is used as is.
+        constexpr std::size_t cStackSize = 64 * 1024;
+        alignas(64) std::array<char, cStackSize> stack{};
+        osal::Thread<cOsalThreadDefaultPriority, cStackSize> thread;
+
+        auto error = thread.setStack(stack.data());
+        REQUIRE(!error);
+
+        error = thread.start(func);
+        REQUIRE(!error);
+
+        error = thread.join();
+        REQUIRE(!error);
+
+        REQUIRE(launched);
+    }
+
     SECTION("Create thread with nullptr stack")
     {
         osal::Thread thread;
@@ -173,6 +194,61 @@ TEST_CASE("Thread creation with custom stack", "[unit][cpp][thread]")
     }
 }
 
+TEST_CASE("Thread creation with CPU affinity", "[unit][cpp][thread]")
+{
+    std::uint32_t cpu = cOsalMaxCpus;
+    auto func = [&cpu] {
+        osal::sleep(50ms);
+        cpu = osal::thread::currentCpu();
+    };
+
+    osal::Thread thread;
+    auto error = thread.setAffinity({0});
+    REQUIRE(!error);
+
+    OsalCpuSet cpus{};
+    error = thread.affinity(cpus);
+    REQUIRE(!error);
+    REQUIRE(osalCpuSetContains(&cpus, 0));
+
+    error = thread.start(func);
+    REQUIRE(!error);
+
+    error = thread.setAffinity({0});
+    REQUIRE(!error);
+
+    error = thread.setAffinity({});
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    error = thread.affinity(cpus);
+    REQUIRE(!error);
+    REQUIRE(osalCpuSetContains(&cpus, 0));
+
+    error = thread.join();
+    REQUIRE(!error);
+    REQUIRE(cpu == 0);
+}
+
+TEST_CASE("Thread creation with scheduling policy", "[unit][cpp][thread]")
+{
+    bool called{};
+    auto func = [&called] { called = true; };
+
+    osal::Thread<OsalThreadPriority::eHigh> thread;
+    auto error = thread.setScheduling({OsalThreadPolicy::ePolicyRoundRobin, 0, 0, 0});
+    REQUIRE(!error);
+
+    error = thread.start(func);
+    REQUIRE((!error || error == OsalError::eSchedulingFallback));
+
+    error = thread.setScheduling({OsalThreadPolicy::ePolicyOther, 0, 0, 0});
+    REQUIRE(error == OsalError::eThreadAlreadyStarted);
+
+    error = thread.join();
+    REQUIRE(!error);
+    REQUIRE(called);
+}
+
 TEST_CASE("Thread creation with variadic arguments", "[unit][cpp][thread]")
 {
     bool launched = false;
@@ -218,6 +294,32 @@ TEST_CASE("Thread creation with variadic arguments", "[unit][cpp][thread]")
     REQUIRE(counter == expectedCounter);
 }
 
+TEST_CASE("Thread creation with move-only arguments", "[unit][cpp][thread]")
+{
+    constexpr int cValue = 42;
+    int result{};
+
+    SECTION("Move-only argument")
+    {
+        auto func = [&result](std::unique_ptr<int> value) { result = *value; };
+        osal::Thread thread(func, std::make_unique<int>(cValue));
+    }
+
+    SECTION("Move-only function")
+    {
+        auto func = [&result, value = std::make_unique<int>(cValue)] { result = *value; };
+        osal::Thread thread(std::move(func));
+    }
+
+    SECTION("Argument passed by reference")
+    {
+        auto func = [](int& value) { value = cValue; };
+        osal::Thread thread(func, std::ref(result));
+    }
+
+    REQUIRE(result == cValue);
+}
+
 TEST_CASE("Thread creation in C++ with different priorities", "[unit][cpp][thread]")
 {
     bool launched = false;
@@ -450,3 +552,60 @@ TEST_CASE("Check if thread ids are unique and constant in C++", "[unit][cpp][thr
 
     REQUIRE(uniqueIds.size() == cThreadsCount);
 }
+
+TEST_CASE("Enumerate live threads in C++", "[unit][cpp][thread]")
+{
+    osal::Semaphore readySemaphore{0};
+    osal::Semaphore stopSemaphore{0};
+
+    auto func = [&] {
+        readySemaphore.signal();
+        stopSemaphore.wait();
+    };
+
+    std::string_view threadName = "enumerated";
+    osal::Thread<OsalThreadPriority::eHigh> thread(threadName, func);
+    readySemaphore.wait();
+
+    auto isEnumerated = [&] {
+        auto infos = osal::thread::enumerate();
+        return std::any_of(infos.begin(), infos.end(), [&](const auto& info) {
+            return threadName == info.name && info.priority == OsalThreadPriority::eHigh;
+        });
+    };
+
+    REQUIRE(isEnumerated());
+
+    stopSemaphore.signal();
+    auto error = thread.join();
+    REQUIRE(!error);
+    REQUIRE(!isEnumerated());
+}
+
+TEST_CASE("Thread runtime statistics in C++", "[unit][cpp][thread]")
+{
+    osal::Semaphore readySemaphore{0};
+    osal::Semaphore stopSemaphore{0};
+
+    auto func = [&] {
+        readySemaphore.signal();
+        stopSemaphore.wait();
+    };
+
+    osal::Thread thread;
+    OsalThreadStats stats{};
+    auto error = thread.stats(stats);
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    error = thread.start(func);
+    REQUIRE(!error);
+    readySemaphore.wait();
+
+    error = thread.stats(stats);
+    REQUIRE(!error);
+    REQUIRE(stats.runtimeNs >= stats.cpuTimeNs);
+
+    stopSemaphore.signal();
+    error = thread.join();
+    REQUIRE(!error);
+}
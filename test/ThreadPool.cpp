@@ -0,0 +1,211 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#include <osal/Error.hpp>
+#include <osal/Future.hpp>
+#include <osal/Semaphore.hpp>
+#include <osal/Thread.hpp>
+#include <osal/ThreadPool.hpp>
+#include <osal/Timeout.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <string>
+
+TEST_CASE("Thread pool executes all submitted tasks", "[unit][cpp][threadpool]")
+{
+    constexpr int cTasksCount = 1000;
+    std::atomic<int> counter{};
+
+    {
+        osal::ThreadPool<4, 16> pool("pool");
+        for (int i = 0; i < cTasksCount; ++i) {
+            auto error = pool.submit([&counter](int value) { counter += value; }, 1);
+            REQUIRE(!error);
+        }
+
+        auto error = pool.shutdown();
+        REQUIRE(!error);
+        REQUIRE(counter == cTasksCount);
+
+        error = pool.submit([&counter] { ++counter; });
+        REQUIRE(error == OsalError::eInvalidArgument);
+    }
+
+    REQUIRE(counter == cTasksCount);
+}
+
+TEST_CASE("Thread pool delivers results through futures", "[unit][cpp][threadpool]")
+{
+    constexpr int cValue = 21;
+    osal::ThreadPool<2, 4> pool("pool");
+
+    SECTION("Value result")
+    {
+        osal::Future<int> future;
+        REQUIRE(!future.valid());
+
+        auto error = pool.submit(future, [](int value) { return 2 * value; }, cValue);
+        REQUIRE(!error);
+        REQUIRE(future.valid());
+
+        error = future.wait();
+        REQUIRE(!error);
+        REQUIRE(future.ready());
+        REQUIRE(future.get() == 2 * cValue);
+        REQUIRE(!future.valid());
+
+        // Future can be reused once its result has been taken.
+        error = pool.submit(future, [] { return cValue; });
+        REQUIRE(!error);
+        REQUIRE(future.get() == cValue);
+    }
+
+    SECTION("Void result")
+    {
+        bool called{};
+        osal::Future<void> future;
+        auto error = pool.submit(future, [&called] { called = true; });
+        REQUIRE(!error);
+
+        future.get();
+        REQUIRE(called);
+    }
+
+    SECTION("Move-only result and argument")
+    {
+        osal::Future<std::unique_ptr<int>> future;
+        auto func = [](std::unique_ptr<int> value) {
+            *value += 1;
+            return value;
+        };
+
+        auto error = pool.submit(future, func, std::make_unique<int>(cValue));
+        REQUIRE(!error);
+
+        auto result = future.get();
+        REQUIRE(result);
+        REQUIRE(*result == cValue + 1);
+    }
+
+    SECTION("Future bound to pending task")
+    {
+        osal::Semaphore semaphore(0);
+        osal::Future<void> future;
+        auto error = pool.submit(future, [&semaphore] { semaphore.wait(); });
+        REQUIRE(!error);
+
+        error = pool.submit(future, [] {});
+        REQUIRE(error == OsalError::eInvalidArgument);
+
+        error = future.timedWait(10ms);
+        REQUIRE(error == OsalError::eTimeout);
+        REQUIRE(!future.ready());
+
+        semaphore.signal();
+        error = future.timedWait(osal::Timeout::infinity());
+        REQUIRE(!error);
+    }
+}
+
+TEST_CASE("Thread pool with full queue", "[unit][cpp][threadpool]")
+{
+    constexpr std::size_t cQueueSize = 2;
+    osal::ThreadPool<1, cQueueSize> pool("pool");
+    osal::Semaphore blocker(0);
+    osal::Semaphore started(0);
+    std::atomic<int> counter{};
+
+    // First task occupies the only worker, so following tasks stay in the queue.
+    auto error = pool.submit([&] {
+        started.signal();
+        blocker.wait();
+    });
+    REQUIRE(!error);
+    error = started.wait();
+    REQUIRE(!error);
+
+    for (std::size_t i = 0; i < cQueueSize; ++i) {
+        error = pool.timedSubmit(osal::Timeout::none(), [&counter] { ++counter; });
+        REQUIRE(!error);
+    }
+
+    error = pool.timedSubmit(osal::Timeout::none(), [&counter] { ++counter; });
+    REQUIRE(error == OsalError::eTimeout);
+
+    osal::Future<int> future;
+    error = pool.timedSubmit(10ms, future, [] { return 0; });
+    REQUIRE(error == OsalError::eTimeout);
+    REQUIRE(!future.valid());
+
+    // Unblocked submitter waits until worker takes the blocked task out of the queue.
+    osal::Thread submitter([&] {
+        auto submitError = pool.submit([&counter] { ++counter; });
+        if (submitError)
+            REQUIRE(!submitError);
+    });
+
+    blocker.signal();
+    error = submitter.join();
+    REQUIRE(!error);
+
+    error = pool.shutdown();
+    REQUIRE(!error);
+    REQUIRE(counter == cQueueSize + 1);
+}
+
+TEST_CASE("Thread pool start and worker names", "[unit][cpp][threadpool]")
+{
+    osal::ThreadPool<2, 4> pool;
+    auto error = pool.submit([] {});
+    REQUIRE(error == OsalError::eInvalidArgument);
+
+    error = pool.start("verylongpoolname");
+    REQUIRE(!error);
+
+    error = pool.start("pool");
+    REQUIRE(error == OsalError::eThreadAlreadyStarted);
+
+    osal::Future<std::string> future;
+    error = pool.submit(future, [] { return osal::thread::name(); });
+    REQUIRE(!error);
+
+    auto name = future.get();
+    REQUIRE(name.size() == cOsalThreadNameSize - 1);
+    REQUIRE((name == "verylongpoolna0" || name == "verylongpoolna1"));
+
+    REQUIRE(pool.workersCount() == 2);
+    REQUIRE(pool.queueSize() == 4);
+}
@@ -0,0 +1,239 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#include <osal/Error.hpp>
+#include <osal/Thread.hpp>
+#include <osal/WorkStealingExecutor.hpp>
+#include <osal/sleep.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+constexpr std::size_t cStackSize = 256 * 1024;
+using Executor = osal::WorkStealingExecutor<4, 64, cOsalThreadDefaultPriority, cStackSize>;
+
+static void fibonacci(Executor& executor, int n, long& result)
+{
+    constexpr int cSequentialThreshold = 10;
+    if (n < cSequentialThreshold) {
+        long previous = 0;
+        long current = 1;
+        for (int i = 0; i < n; ++i) {
+            auto next = previous + current;
+            previous = current;
+            current = next;
+        }
+
+        result = previous;
+        return;
+    }
+
+    long left{};
+    long right{};
+    osal::TaskGroup group;
+    executor.submit(group, [&executor, n, &left] { fibonacci(executor, n - 1, left); });
+    executor.submit(group, [&executor, n, &right] { fibonacci(executor, n - 2, right); });
+    executor.wait(group);
+    result = left + right;
+}
+
+TEST_CASE("Work-stealing executor runs tasks submitted from outside", "[unit][cpp][workstealing]")
+{
+    constexpr int cTasksCount = 1000;
+    std::atomic<int> counter{};
+
+    Executor executor("steal");
+    REQUIRE(executor.workersCount() == 4);
+
+    osal::TaskGroup group;
+    for (int i = 0; i < cTasksCount; ++i) {
+        auto error = executor.submit(group, [&counter](int value) { counter += value; }, 1);
+        REQUIRE(!error);
+    }
+
+    auto error = executor.wait(group);
+    REQUIRE(!error);
+    REQUIRE(group.pending() == 0);
+    REQUIRE(counter == cTasksCount);
+
+    // Group can be reused once all its tasks are finished.
+    error = executor.submit(group, [&counter] { ++counter; });
+    REQUIRE(!error);
+    error = executor.wait(group);
+    REQUIRE(!error);
+    REQUIRE(counter == cTasksCount + 1);
+}
+
+TEST_CASE("Work-stealing executor handles recursive fork/join", "[unit][cpp][workstealing]")
+{
+    constexpr int cN = 25;
+    constexpr long cExpected = 75025;
+
+    Executor executor("fib");
+
+    SECTION("Started from outside of the executor")
+    {
+        long result{};
+        fibonacci(executor, cN, result);
+        REQUIRE(result == cExpected);
+    }
+
+    SECTION("Started from the worker thread")
+    {
+        long result{};
+        osal::TaskGroup group;
+        auto error = executor.submit(group, [&executor, &result] { fibonacci(executor, cN, result); });
+        REQUIRE(!error);
+
+        error = executor.wait(group);
+        REQUIRE(!error);
+        REQUIRE(result == cExpected);
+    }
+}
+
+TEST_CASE("Work-stealing executor spreads work across workers", "[unit][cpp][workstealing]")
+{
+    constexpr std::size_t cTasksCount = 64;
+    std::atomic<std::size_t> counter{};
+    std::array<std::atomic<std::uint32_t>, cTasksCount> executors{};
+
+    Executor executor("spread");
+    osal::TaskGroup group;
+    auto error = executor.submit(group, [&] {
+        // Tasks pushed to the local deque of one worker have to be stolen by the others.
+        osal::TaskGroup nested;
+        for (std::size_t i = 0; i < cTasksCount; ++i) {
+            executor.submit(nested, [&, i] {
+                executors[i] = osal::thread::id();
+                osal::sleep(std::chrono::milliseconds(1));
+                ++counter;
+            });
+        }
+
+        executor.wait(nested);
+    });
+    REQUIRE(!error);
+
+    error = executor.wait(group);
+    REQUIRE(!error);
+    REQUIRE(counter == cTasksCount);
+    for (const auto& id : executors)
+        REQUIRE(id != 0);
+}
+
+TEST_CASE("Work-stealing executor lifetime", "[unit][cpp][workstealing]")
+{
+    constexpr int cTasksCount = 500;
+    std::atomic<int> counter{};
+
+    SECTION("Shutdown executes all pending tasks")
+    {
+        Executor executor("drain");
+        for (int i = 0; i < cTasksCount; ++i) {
+            auto error = executor.submit([&counter] { ++counter; });
+            REQUIRE(!error);
+        }
+
+        auto error = executor.shutdown();
+        REQUIRE(!error);
+        REQUIRE(counter == cTasksCount);
+
+        error = executor.submit([&counter] { ++counter; });
+        REQUIRE(error == OsalError::eInvalidArgument);
+        REQUIRE(counter == cTasksCount);
+    }
+
+    SECTION("Tasks submitted concurrently with shutdown are executed or rejected")
+    {
+        constexpr std::size_t cSubmittersCount = 4;
+        std::atomic<int> accepted{};
+        osal::TaskGroup group;
+
+        Executor executor("race");
+        std::array<osal::Thread<cOsalThreadDefaultPriority, cStackSize>, cSubmittersCount> submitters;
+        for (auto& submitter : submitters) {
+            auto error = submitter.start([&] {
+                while (!executor.submit(group, [&counter] { ++counter; }))
+                    ++accepted;
+            });
+            REQUIRE(!error);
+        }
+
+        osal::sleep(10ms);
+        auto error = executor.shutdown();
+        REQUIRE(!error);
+
+        for (auto& submitter : submitters) {
+            error = submitter.join();
+            REQUIRE(!error);
+        }
+
+        // Every accepted task has to be executed, otherwise its group would never be finished.
+        REQUIRE(group.pending() == 0);
+        REQUIRE(counter == accepted);
+    }
+
+    SECTION("Executor started twice")
+    {
+        Executor executor;
+        auto error = executor.submit([&counter] { ++counter; });
+        REQUIRE(error == OsalError::eInvalidArgument);
+
+        error = executor.start("twice");
+        REQUIRE(!error);
+
+        error = executor.start("twice");
+        REQUIRE(error == OsalError::eThreadAlreadyStarted);
+
+        error = executor.shutdown();
+        REQUIRE(!error);
+
+        error = executor.start("twice");
+        REQUIRE(error == OsalError::eThreadAlreadyStarted);
+    }
+
+    SECTION("Destructor waits for all tasks")
+    {
+        {
+            Executor executor("dtor");
+            for (int i = 0; i < cTasksCount; ++i)
+                executor.submit([&counter] { ++counter; });
+        }
+
+        REQUIRE(counter == cTasksCount);
+    }
+}
@@ -0,0 +1,120 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright BSD 2-Clause License
+///
+/// Copyright (c) 2023, Kuba Sejdak <kuba.sejdak@gmail.com>
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms, with or without
+/// modification, are permitted provided that the following conditions are met:
+///
+/// 1. Redistributions of source code must retain the above copyright notice, this
+///    list of conditions and the following disclaimer.
+///
+/// 2. Redistributions in binary form must reproduce the above copyright notice,
+///    this list of conditions and the following disclaimer in the documentation
+///    and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+/// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+/// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+/// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+/// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+/// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+/// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+/// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#include <osal/Thread.h>
+#include <osal/Thread.hpp>
+#include <osal/init.h>
+#include <osal/init.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+
+#ifdef __linux__
+    #include <sys/mman.h>
+#endif
+
+TEST_CASE("Initialization with real-time configuration", "[unit][c][init]")
+{
+    constexpr std::size_t cHeapReserveSize = 1024 * 1024;
+    constexpr std::size_t cStackPrefaultSize = 64 * 1024;
+
+    OsalInitConfig config{};
+    config.heapReserveSize = cHeapReserveSize;
+    config.stackPrefaultSize = cStackPrefaultSize;
+    config.disableTransparentHugePages = true;
+
+    OsalInitReport report{};
+    auto success = osalInitEx(&config, &report);
+    REQUIRE(success == (report.heapPrefaulted && report.stackPrefaulted && report.transparentHugePagesDisabled));
+    REQUIRE(report.heapPrefaulted);
+    REQUIRE(report.stackPrefaulted);
+    REQUIRE(!report.memoryLocked);
+
+    // Threads created after the initialization pre-fault their stacks, regardless of the stack size.
+    bool called{};
+    auto func = [](void* arg) { *static_cast<bool*>(arg) = true; };
+
+    OsalThread thread{};
+    auto error = osalThreadCreate(&thread,
+                                  {cOsalThreadDefaultPriority, cOsalThreadDefaultStackSize, nullptr, {}, {}},
+                                  func,
+                                  &called);
+    REQUIRE(error == OsalError::eOk);
+
+    error = osalThreadJoin(&thread);
+    REQUIRE(error == OsalError::eOk);
+    REQUIRE(called);
+
+    error = osalThreadDestroy(&thread);
+    REQUIRE(error == OsalError::eOk);
+
+    config = OsalInitConfig{};
+    success = osalInitEx(&config, nullptr);
+    REQUIRE(success);
+
+    success = osalInitEx(nullptr, nullptr);
+    REQUIRE(success);
+}
+
+TEST_CASE("Initialization with memory locking", "[unit][c][init]")
+{
+    OsalInitConfig config{};
+    config.lockMemory = true;
+
+    OsalInitReport report{};
+    auto success = osalInitEx(&config, &report);
+    REQUIRE(success == report.memoryLocked);
+
+#ifdef __linux__
+    // Memory locking depends on privileges, so it is released to not affect other tests.
+    if (report.memoryLocked)
+        munlockall();
+#endif
+}
+
+TEST_CASE("Real-time scheduling availability in C++", "[unit][cpp][init]")
+{
+    OsalInitReport report{};
+    auto success = osal::init({}, &report);
+    REQUIRE(success);
+
+    osal::Thread<OsalThreadPriority::eLowest> thread;
+    auto error = thread.setScheduling({OsalThreadPolicy::ePolicyFifo, 0, 0, 0});
+    REQUIRE(!error);
+
+    error = thread.start([] {});
+    REQUIRE(error == (report.realtimeScheduling ? OsalError::eOk : OsalError::eSchedulingFallback));
+
+    error = thread.join();
+    REQUIRE(!error);
+}